@@ -0,0 +1,100 @@
+#!/usr/bin/env python3
+#
+# Copyright 2023 Microchip FPGA Embedded Systems Solutions.
+#
+# SPDX-License-Identifier: MIT
+#
+# Compare two UART captures of the DMA benchmarking application, built with
+# CSV_OUTPUT defined, and report the results which got slower.
+#
+# Usage: dma_bench_compare.py [--threshold PERCENT] [--metric NAME] BEFORE AFTER
+#
+# The exit status is 1 if any result regressed by more than the threshold.
+
+import argparse
+import sys
+
+METRICS = ("min", "median", "p99", "max")
+
+
+def load(path):
+    """Return {(application, engine, source, destination, size): stats}."""
+    results = {}
+    application = "unknown"
+
+    with open(path, errors="replace") as capture:
+        for line in capture:
+            fields = [field.strip() for field in line.strip().split(",")]
+
+            if fields[0] == "CONFIG" and len(fields) >= 2:
+                application = fields[1]
+            elif fields[0] == "RESULT" and len(fields) == 11:
+                engine, source, destination = fields[1:4]
+                size, runs = int(fields[4]), int(fields[5])
+                cycles = [int(value) for value in fields[6:10]]
+                key = (application, engine, source, destination, size)
+                results[key] = dict(zip(METRICS, cycles), runs=runs)
+
+    return results
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Flag DMA benchmark results which regressed between two runs.")
+    parser.add_argument("before", help="capture of the reference run")
+    parser.add_argument("after", help="capture of the run being checked")
+    parser.add_argument("--threshold", type=float, default=5.0,
+                        help="percentage increase in cycles counted as a "
+                             "regression (default 5)")
+    parser.add_argument("--metric", choices=METRICS, default="median",
+                        help="statistic compared (default median)")
+    parser.add_argument("--all", action="store_true",
+                        help="print every result, not only regressions")
+    args = parser.parse_args()
+
+    before = load(args.before)
+    after = load(args.after)
+
+    if not before or not after:
+        sys.exit("no RESULT lines found, was the application built with "
+                 "CSV_OUTPUT defined?")
+
+    regressions = 0
+    improvements = 0
+
+    for key in sorted(set(before) & set(after)):
+        old = before[key][args.metric]
+        new = after[key][args.metric]
+        change = 100.0 * (new - old) / old if old else 0.0
+
+        if change > args.threshold:
+            status = "REGRESSION"
+            regressions += 1
+        elif change < -args.threshold:
+            status = "improved"
+            improvements += 1
+        else:
+            status = ""
+
+        if status == "REGRESSION" or args.all:
+            application, engine, source, destination, size = key
+            print("%-10s %-10s %-16s %-16s %8d %10d %10d %+7.1f%% %s"
+                  % (application, engine, source, destination, size,
+                     old, new, change, status))
+
+    missing = sorted(set(before) - set(after))
+    added = sorted(set(after) - set(before))
+
+    for key in missing:
+        print("missing from %s: %s" % (args.after, ",".join(map(str, key))))
+
+    print("%d compared, %d regressed, %d improved by more than %.1f%% (%s), "
+          "%d missing, %d new"
+          % (len(set(before) & set(after)), regressions, improvements,
+             args.threshold, args.metric, len(missing), len(added)))
+
+    return 1 if regressions else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -8,14 +8,36 @@
 #define CONCURRENT_BENCHMARKING_CONFIG_H_
 
 #include <stdint.h>
+#include "dma_bench/dma_bench_load.h"
 
 /* Setting the size range in the benchmarks to be run */
 #define MIN_TRANSFER_SIZE_BYTES (1000u)
 #define MAX_TRANSFER_SIZE_BYTES (TRANSFER_1_MB)
 
-/* Macros defining benchmark transfer sizes */
-#define TRANSFER_STEP_SIZE      (100u)
+/* Macros defining benchmark transfer sizes. The sizes are log spaced, each
+ * one TRANSFER_STEP_PERCENT percent of the previous one. */
+#define TRANSFER_STEP_PERCENT   (125u)
 #define TRANSFER_1_MB           (1000000u)
+#define BYTES_TO_MEGABITS_SCALE_FACTOR (125000.0)
+
+/* Number of times each transfer size is run. The minimum, median, 99th
+ * percentile and maximum over all runs are reported. */
+#define BENCHMARK_RUNS          (11u)
+
+/* Print results as CSV lines instead of a table, see README.md */
+#undef CSV_OUTPUT
+
+/* How block transfers are checked: DMA_BENCH_VERIFY_COMPARE,
+ * DMA_BENCH_VERIFY_CRC32C or DMA_BENCH_VERIFY_PDMA, see README.md */
+#define VERIFY_MODE             DMA_BENCH_VERIFY_COMPARE
+
+/* Size of the transfers timed in the contention matrix, see README.md */
+#define CONTENTION_TRANSFER_SIZE    (TRANSFER_1_MB)
+
+/* Accesses the U54_1 latency probe makes between checks for the end of the
+ * transfers, and in each run of the probe on its own. */
+#define CONTENTION_PROBE_CHUNK      (16u)
+#define CONTENTION_PROBE_ACCESSES   (16384u)
 
 /* Turn on force ordering on for PDMA transactions*/
 #undef FORCE_ORDER
@@ -46,6 +68,12 @@
 
 #define STREAM_GEN                  (0xFFFFFFFFu)
 
+/* Memory used by the CPU loads of each U54 hart. The regions are larger than
+ * the L2 cache so that the loads reach the DDR. */
+#define LOAD_REGION_SIZE            (0x00400000u)
+#define LOAD_CACHED_DDR(hart)       (0x8C000000u + ((hart) * (LOAD_REGION_SIZE)))
+#define LOAD_NON_CACHED_DDR(hart)   (0xCE000000u + ((hart) * (LOAD_REGION_SIZE)))
+
 /* Module that produces the data for an AXI4Stream Transfer*/
 #define DMA_CONTROL_BASE_ADDRESS    (0x60010000u)
 /* AXI4 Stream Data Generator*/
@@ -130,7 +158,7 @@ typedef struct
     uint32_t destination_address;
     uint32_t min_tranfer_size;
     uint32_t max_transfer_size;
-    uint32_t step_size;
+    uint32_t step_percent;
 } dma_benchmarking_params_t;
 
 const dma_benchmarking_params_t fdma_benchmark_list[CONCURRENT_BENCHMARKING_LIST_SIZE] = {
@@ -139,122 +167,122 @@ const dma_benchmarking_params_t fdma_benchmark_list[CONCURRENT_BENCHMARKING_LIST
      FDMA_CACHED_DDR1,
      MIN_TRANSFER_SIZE_BYTES,
      MAX_TRANSFER_SIZE_BYTES,
-     TRANSFER_STEP_SIZE},
+     TRANSFER_STEP_PERCENT},
     {FDMA_CAHCED_DDR0,
      FDMA_CACHED_DDR1,
      MIN_TRANSFER_SIZE_BYTES,
      MAX_TRANSFER_SIZE_BYTES,
-     TRANSFER_STEP_SIZE},
+     TRANSFER_STEP_PERCENT},
     {FDMA_CAHCED_DDR0,
      FDMA_CACHED_DDR1,
      MIN_TRANSFER_SIZE_BYTES,
      MAX_TRANSFER_SIZE_BYTES,
-     TRANSFER_STEP_SIZE},
+     TRANSFER_STEP_PERCENT},
     {FDMA_CAHCED_DDR0,
      FDMA_CACHED_DDR1,
      MIN_TRANSFER_SIZE_BYTES,
      MAX_TRANSFER_SIZE_BYTES,
-     TRANSFER_STEP_SIZE},
+     TRANSFER_STEP_PERCENT},
     {FDMA_CAHCED_DDR0,
      FDMA_NON_CACHED_DDR1,
      MIN_TRANSFER_SIZE_BYTES,
      MAX_TRANSFER_SIZE_BYTES,
-     TRANSFER_STEP_SIZE},
+     TRANSFER_STEP_PERCENT},
     {FDMA_CAHCED_DDR0,
      FDMA_NON_CACHED_DDR1,
      MIN_TRANSFER_SIZE_BYTES,
      MAX_TRANSFER_SIZE_BYTES,
-     TRANSFER_STEP_SIZE},
+     TRANSFER_STEP_PERCENT},
     {FDMA_CAHCED_DDR0,
      FDMA_NON_CACHED_DDR1,
      MIN_TRANSFER_SIZE_BYTES,
      MAX_TRANSFER_SIZE_BYTES,
-     TRANSFER_STEP_SIZE},
+     TRANSFER_STEP_PERCENT},
     {FDMA_CAHCED_DDR0,
      FDMA_NON_CACHED_DDR1,
      MIN_TRANSFER_SIZE_BYTES,
      MAX_TRANSFER_SIZE_BYTES,
-     TRANSFER_STEP_SIZE},
+     TRANSFER_STEP_PERCENT},
     {FDMA_NON_CACHED_DDR0,
      FDMA_CACHED_DDR1,
      MIN_TRANSFER_SIZE_BYTES,
      MAX_TRANSFER_SIZE_BYTES,
-     TRANSFER_STEP_SIZE},
+     TRANSFER_STEP_PERCENT},
     {FDMA_NON_CACHED_DDR0,
      FDMA_CACHED_DDR1,
      MIN_TRANSFER_SIZE_BYTES,
      MAX_TRANSFER_SIZE_BYTES,
-     TRANSFER_STEP_SIZE},
+     TRANSFER_STEP_PERCENT},
     {FDMA_NON_CACHED_DDR0,
      FDMA_CACHED_DDR1,
      MIN_TRANSFER_SIZE_BYTES,
      MAX_TRANSFER_SIZE_BYTES,
-     TRANSFER_STEP_SIZE},
+     TRANSFER_STEP_PERCENT},
     {FDMA_NON_CACHED_DDR0,
      FDMA_CACHED_DDR1,
      MIN_TRANSFER_SIZE_BYTES,
      MAX_TRANSFER_SIZE_BYTES,
-     TRANSFER_STEP_SIZE},
+     TRANSFER_STEP_PERCENT},
     {FDMA_NON_CACHED_DDR0,
      FDMA_NON_CACHED_DDR1,
      MIN_TRANSFER_SIZE_BYTES,
      MAX_TRANSFER_SIZE_BYTES,
-     TRANSFER_STEP_SIZE},
+     TRANSFER_STEP_PERCENT},
     {FDMA_NON_CACHED_DDR0,
      FDMA_NON_CACHED_DDR1,
      MIN_TRANSFER_SIZE_BYTES,
      MAX_TRANSFER_SIZE_BYTES,
-     TRANSFER_STEP_SIZE},
+     TRANSFER_STEP_PERCENT},
     {FDMA_NON_CACHED_DDR0,
      FDMA_NON_CACHED_DDR1,
      MIN_TRANSFER_SIZE_BYTES,
      MAX_TRANSFER_SIZE_BYTES,
-     TRANSFER_STEP_SIZE},
+     TRANSFER_STEP_PERCENT},
     {FDMA_NON_CACHED_DDR0,
      FDMA_NON_CACHED_DDR1,
      MIN_TRANSFER_SIZE_BYTES,
      MAX_TRANSFER_SIZE_BYTES,
-     TRANSFER_STEP_SIZE},
+     TRANSFER_STEP_PERCENT},
     {STREAM_GEN,
      FDMA_NON_CACHED_DDR1,
      MIN_TRANSFER_SIZE_BYTES,
      MAX_TRANSFER_SIZE_BYTES,
-     TRANSFER_STEP_SIZE},
+     TRANSFER_STEP_PERCENT},
     {STREAM_GEN,
      FDMA_NON_CACHED_DDR1,
      MIN_TRANSFER_SIZE_BYTES,
      MAX_TRANSFER_SIZE_BYTES,
-     TRANSFER_STEP_SIZE},
+     TRANSFER_STEP_PERCENT},
     {STREAM_GEN,
      FDMA_NON_CACHED_DDR1,
      MIN_TRANSFER_SIZE_BYTES,
      MAX_TRANSFER_SIZE_BYTES,
-     TRANSFER_STEP_SIZE},
+     TRANSFER_STEP_PERCENT},
     {STREAM_GEN,
      FDMA_NON_CACHED_DDR1,
      MIN_TRANSFER_SIZE_BYTES,
      MAX_TRANSFER_SIZE_BYTES,
-     TRANSFER_STEP_SIZE},
+     TRANSFER_STEP_PERCENT},
     {STREAM_GEN,
      FDMA_CACHED_DDR1,
      MIN_TRANSFER_SIZE_BYTES,
      MAX_TRANSFER_SIZE_BYTES,
-     TRANSFER_STEP_SIZE},
+     TRANSFER_STEP_PERCENT},
     {STREAM_GEN,
      FDMA_CACHED_DDR1,
      MIN_TRANSFER_SIZE_BYTES,
      MAX_TRANSFER_SIZE_BYTES,
-     TRANSFER_STEP_SIZE},
+     TRANSFER_STEP_PERCENT},
     {STREAM_GEN,
      FDMA_CACHED_DDR1,
      MIN_TRANSFER_SIZE_BYTES,
      MAX_TRANSFER_SIZE_BYTES,
-     TRANSFER_STEP_SIZE},
+     TRANSFER_STEP_PERCENT},
     {STREAM_GEN,
      FDMA_CACHED_DDR1,
      MIN_TRANSFER_SIZE_BYTES,
      MAX_TRANSFER_SIZE_BYTES,
-     TRANSFER_STEP_SIZE}};
+     TRANSFER_STEP_PERCENT}};
 
 /*
  * PDMA benchmarking list
@@ -265,121 +293,184 @@ const dma_benchmarking_params_t pdma_benchmark_list[CONCURRENT_BENCHMARKING_LIST
      PDMA_CACHED_DDR1,
      MIN_TRANSFER_SIZE_BYTES,
      MAX_TRANSFER_SIZE_BYTES,
-     TRANSFER_STEP_SIZE},
+     TRANSFER_STEP_PERCENT},
     {PDMA_CAHCED_DDR0,
      PDMA_NON_CACHED_DDR0,
      MIN_TRANSFER_SIZE_BYTES,
      MAX_TRANSFER_SIZE_BYTES,
-     TRANSFER_STEP_SIZE},
+     TRANSFER_STEP_PERCENT},
     {PDMA_NON_CACHED_DDR0,
      PDMA_CAHCED_DDR0,
      MIN_TRANSFER_SIZE_BYTES,
      MAX_TRANSFER_SIZE_BYTES,
-     TRANSFER_STEP_SIZE},
+     TRANSFER_STEP_PERCENT},
     {PDMA_NON_CACHED_DDR0,
      PDMA_NON_CACHED_DDR1,
      MIN_TRANSFER_SIZE_BYTES,
      MAX_TRANSFER_SIZE_BYTES,
-     TRANSFER_STEP_SIZE},
+     TRANSFER_STEP_PERCENT},
     {PDMA_CAHCED_DDR0,
      PDMA_CACHED_DDR1,
      MIN_TRANSFER_SIZE_BYTES,
      MAX_TRANSFER_SIZE_BYTES,
-     TRANSFER_STEP_SIZE},
+     TRANSFER_STEP_PERCENT},
     {PDMA_CAHCED_DDR0,
      PDMA_NON_CACHED_DDR0,
      MIN_TRANSFER_SIZE_BYTES,
      MAX_TRANSFER_SIZE_BYTES,
-     TRANSFER_STEP_SIZE},
+     TRANSFER_STEP_PERCENT},
     {PDMA_NON_CACHED_DDR0,
      PDMA_CAHCED_DDR0,
      MIN_TRANSFER_SIZE_BYTES,
      MAX_TRANSFER_SIZE_BYTES,
-     TRANSFER_STEP_SIZE},
+     TRANSFER_STEP_PERCENT},
     {PDMA_NON_CACHED_DDR0,
      PDMA_NON_CACHED_DDR1,
      MIN_TRANSFER_SIZE_BYTES,
      MAX_TRANSFER_SIZE_BYTES,
-     TRANSFER_STEP_SIZE},
+     TRANSFER_STEP_PERCENT},
     {PDMA_CAHCED_DDR0,
      PDMA_CACHED_DDR1,
      MIN_TRANSFER_SIZE_BYTES,
      MAX_TRANSFER_SIZE_BYTES,
-     TRANSFER_STEP_SIZE},
+     TRANSFER_STEP_PERCENT},
     {PDMA_CAHCED_DDR0,
      PDMA_NON_CACHED_DDR0,
      MIN_TRANSFER_SIZE_BYTES,
      MAX_TRANSFER_SIZE_BYTES,
-     TRANSFER_STEP_SIZE},
+     TRANSFER_STEP_PERCENT},
     {PDMA_NON_CACHED_DDR0,
      PDMA_CAHCED_DDR0,
      MIN_TRANSFER_SIZE_BYTES,
      MAX_TRANSFER_SIZE_BYTES,
-     TRANSFER_STEP_SIZE},
+     TRANSFER_STEP_PERCENT},
     {PDMA_NON_CACHED_DDR0,
      PDMA_NON_CACHED_DDR1,
      MIN_TRANSFER_SIZE_BYTES,
      MAX_TRANSFER_SIZE_BYTES,
-     TRANSFER_STEP_SIZE},
+     TRANSFER_STEP_PERCENT},
     {PDMA_CAHCED_DDR0,
      PDMA_CACHED_DDR1,
      MIN_TRANSFER_SIZE_BYTES,
      MAX_TRANSFER_SIZE_BYTES,
-     TRANSFER_STEP_SIZE},
+     TRANSFER_STEP_PERCENT},
     {PDMA_CAHCED_DDR0,
      PDMA_NON_CACHED_DDR0,
      MIN_TRANSFER_SIZE_BYTES,
      MAX_TRANSFER_SIZE_BYTES,
-     TRANSFER_STEP_SIZE},
+     TRANSFER_STEP_PERCENT},
     {PDMA_NON_CACHED_DDR0,
      PDMA_CAHCED_DDR0,
      MIN_TRANSFER_SIZE_BYTES,
      MAX_TRANSFER_SIZE_BYTES,
-     TRANSFER_STEP_SIZE},
+     TRANSFER_STEP_PERCENT},
     {PDMA_NON_CACHED_DDR0,
      PDMA_NON_CACHED_DDR1,
      MIN_TRANSFER_SIZE_BYTES,
      MAX_TRANSFER_SIZE_BYTES,
-     TRANSFER_STEP_SIZE},
+     TRANSFER_STEP_PERCENT},
     {PDMA_CAHCED_DDR0,
      PDMA_CACHED_DDR1,
      MIN_TRANSFER_SIZE_BYTES,
      MAX_TRANSFER_SIZE_BYTES,
-     TRANSFER_STEP_SIZE},
+     TRANSFER_STEP_PERCENT},
     {PDMA_CAHCED_DDR0,
      PDMA_NON_CACHED_DDR0,
      MIN_TRANSFER_SIZE_BYTES,
      MAX_TRANSFER_SIZE_BYTES,
-     TRANSFER_STEP_SIZE},
+     TRANSFER_STEP_PERCENT},
     {PDMA_NON_CACHED_DDR0,
      PDMA_CAHCED_DDR0,
      MIN_TRANSFER_SIZE_BYTES,
      MAX_TRANSFER_SIZE_BYTES,
-     TRANSFER_STEP_SIZE},
+     TRANSFER_STEP_PERCENT},
     {PDMA_NON_CACHED_DDR0,
      PDMA_NON_CACHED_DDR1,
      MIN_TRANSFER_SIZE_BYTES,
      MAX_TRANSFER_SIZE_BYTES,
-     TRANSFER_STEP_SIZE},
+     TRANSFER_STEP_PERCENT},
     {PDMA_CAHCED_DDR0,
      PDMA_CACHED_DDR1,
      MIN_TRANSFER_SIZE_BYTES,
      MAX_TRANSFER_SIZE_BYTES,
-     TRANSFER_STEP_SIZE},
+     TRANSFER_STEP_PERCENT},
     {PDMA_CAHCED_DDR0,
      PDMA_NON_CACHED_DDR0,
      MIN_TRANSFER_SIZE_BYTES,
      MAX_TRANSFER_SIZE_BYTES,
-     TRANSFER_STEP_SIZE},
+     TRANSFER_STEP_PERCENT},
     {PDMA_NON_CACHED_DDR0,
      PDMA_CAHCED_DDR0,
      MIN_TRANSFER_SIZE_BYTES,
      MAX_TRANSFER_SIZE_BYTES,
-     TRANSFER_STEP_SIZE},
+     TRANSFER_STEP_PERCENT},
     {PDMA_NON_CACHED_DDR0,
      PDMA_NON_CACHED_DDR1,
      MIN_TRANSFER_SIZE_BYTES,
      MAX_TRANSFER_SIZE_BYTES,
-     TRANSFER_STEP_SIZE}};
+     TRANSFER_STEP_PERCENT}};
+
+/*
+ * Contention matrix
+ */
+
+#define CONTENTION_PAIR_COUNT       (4u)
+#define CONTENTION_SCENARIO_COUNT   (8u)
+
+/* PDMA and FDMA list entries run together, one pair for each combination of
+ * cached and non-cached DDR. */
+const uint32_t contention_pair_list[CONTENTION_PAIR_COUNT][2] = {{0u, 0u},
+                                                                 {1u, 4u},
+                                                                 {2u, 8u},
+                                                                 {3u, 12u}};
+
+#define LOAD_IDLE                   {DMA_BENCH_LOAD_IDLE, 0u, 0u}
+#define LOAD_READ(memory, hart)     {DMA_BENCH_LOAD_STREAM_READ, memory(hart), LOAD_REGION_SIZE}
+#define LOAD_WRITE(memory, hart)    {DMA_BENCH_LOAD_STREAM_WRITE, memory(hart), LOAD_REGION_SIZE}
+#define LOAD_CHASE(memory, hart)    {DMA_BENCH_LOAD_POINTER_CHASE, memory(hart), LOAD_REGION_SIZE}
+
+/* The U54_1 load runs while the transfers are timed and measures the memory
+ * latency seen by U54_1. The U54_2 to U54_4 loads run for the whole row. */
+typedef struct
+{
+    const char *name;
+    dma_bench_load_t hart_load[DMA_BENCH_LOAD_HARTS];
+} contention_scenario_t;
+
+const contention_scenario_t contention_scenario_list[CONTENTION_SCENARIO_COUNT] = {
+    {"probe-only",
+     {LOAD_CHASE(LOAD_CACHED_DDR, 1u), LOAD_IDLE, LOAD_IDLE, LOAD_IDLE}},
+    {"read-c-x1",
+     {LOAD_CHASE(LOAD_CACHED_DDR, 1u), LOAD_READ(LOAD_CACHED_DDR, 2u), LOAD_IDLE, LOAD_IDLE}},
+    {"read-c-x3",
+     {LOAD_CHASE(LOAD_CACHED_DDR, 1u),
+      LOAD_READ(LOAD_CACHED_DDR, 2u),
+      LOAD_READ(LOAD_CACHED_DDR, 3u),
+      LOAD_READ(LOAD_CACHED_DDR, 4u)}},
+    {"write-c-x3",
+     {LOAD_CHASE(LOAD_CACHED_DDR, 1u),
+      LOAD_WRITE(LOAD_CACHED_DDR, 2u),
+      LOAD_WRITE(LOAD_CACHED_DDR, 3u),
+      LOAD_WRITE(LOAD_CACHED_DDR, 4u)}},
+    {"chase-c-x3",
+     {LOAD_CHASE(LOAD_CACHED_DDR, 1u),
+      LOAD_CHASE(LOAD_CACHED_DDR, 2u),
+      LOAD_CHASE(LOAD_CACHED_DDR, 3u),
+      LOAD_CHASE(LOAD_CACHED_DDR, 4u)}},
+    {"read-nc-x3",
+     {LOAD_CHASE(LOAD_CACHED_DDR, 1u),
+      LOAD_READ(LOAD_NON_CACHED_DDR, 2u),
+      LOAD_READ(LOAD_NON_CACHED_DDR, 3u),
+      LOAD_READ(LOAD_NON_CACHED_DDR, 4u)}},
+    {"write-nc-x3",
+     {LOAD_CHASE(LOAD_CACHED_DDR, 1u),
+      LOAD_WRITE(LOAD_NON_CACHED_DDR, 2u),
+      LOAD_WRITE(LOAD_NON_CACHED_DDR, 3u),
+      LOAD_WRITE(LOAD_NON_CACHED_DDR, 4u)}},
+    {"mixed",
+     {LOAD_CHASE(LOAD_CACHED_DDR, 1u),
+      LOAD_READ(LOAD_CACHED_DDR, 2u),
+      LOAD_WRITE(LOAD_NON_CACHED_DDR, 3u),
+      LOAD_CHASE(LOAD_CACHED_DDR, 4u)}}};
 
 #endif /* CONCURRENT_BENCHMARKING_CONFIG_H_ */
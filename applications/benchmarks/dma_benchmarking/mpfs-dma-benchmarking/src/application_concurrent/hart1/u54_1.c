@@ -11,8 +11,14 @@
 #include "drivers/fpga_ip/CoreAXI4DMAController/core_axi4dmacontroller.h"
 #include "drivers/mss/mss_mmuart/mss_uart.h"
 #include "drivers/mss/mss_pdma/mss_pdma.h"
+#include "dma_bench/dma_bench_stats.h"
+#include "dma_bench/dma_bench_verify.h"
 #include "mpfs_hal/mss_hal.h"
 
+#if (BENCHMARK_RUNS > DMA_BENCH_MAX_RUNS)
+#error "BENCHMARK_RUNS must not be more than DMA_BENCH_MAX_RUNS"
+#endif
+
 /* Global Variables */
 axi4dma_instance_t g_dmac;
 mss_uart_instance_t *uart1 = &g_mss_uart1_lo;
@@ -45,6 +51,7 @@ static const char pdma_options[] = "\r\n\t1: Cached DDR to Cached DDR\r\n"
                                    "\t4: Non-Cached DDR to Non-Cached DDR\r\n"
                                    "\r\n"
                                    "\ta: Run all benchmarks\r\n"
+                                   "\tc: Run the contention matrix with CPU loads on U54_1 to U54_4\r\n"
                                    "\tTo register a selection please press \'ENTER\'.\r\n\r\n";
 
 static const char fdma_menu_greeting[] =
@@ -76,6 +83,10 @@ static const char table_header[] = " Data             PDMA             FDMA
                                    " (Bytes)          Address          Address          Address    "
                                    "      Address          (micro-sec)      (micro-sec)\r\n";
 
+static const char contention_table_header[] =
+    " Scenario         PDMA             FDMA             U54_1 Latency    U54_2-4 Load\r\n"
+    "                  (MegaBits/sec)   (MegaBits/sec)   (nano-sec)       (MegaBits/sec)\r\n";
+
 static const char greeting_message[] =
     "\r\n\r\n\r\n **** PolarFire SoC Concurrent DMA Benchmarking Application ****\r\n";
 
@@ -323,31 +334,26 @@ block_transfer_verify_data(uint32_t transfer_size,
                            uint8_t *source_address,
                            uint8_t *destination_address)
 {
-    volatile uint8_t *source = NULL;
-    volatile uint8_t *destination = NULL;
-    uint32_t index = 0u;
+    uint64_t offset = 0u;
 
-    for (index = 0; index < transfer_size; index++)
+    if (0u != dma_bench_verify(VERIFY_MODE,
+                               source_address,
+                               destination_address,
+                               transfer_size,
+                               &offset))
     {
-        source = (source_address + index);
-        destination = (destination_address + index);
-        /* Memory Fence Instruction */
-        mb();
-        if (*source != *destination)
-        {
 #ifdef DEBUG_DMA
-            uint8_t debug_message[100] = {0};
-
-            sprintf(debug_message,
-                    "\r\nError at address: 0x%-9x!"
-                    "\tExpected: %-6iRead: %-6i\r\n",
-                    destination,
-                    *source,
-                    *destination);
-            MSS_UART_polled_tx_string(uart1, debug_message);
+        uint8_t debug_message[100] = {0};
+
+        sprintf(debug_message,
+                "\r\nError at address: 0x%-9x!"
+                "\tExpected: %-6iRead: %-6i\r\n",
+                (destination_address + offset),
+                source_address[offset],
+                destination_address[offset]);
+        MSS_UART_polled_tx_string(uart1, debug_message);
 #endif
-            return TRANSFER_DATA_MISMATCH;
-        }
+        return TRANSFER_DATA_MISMATCH;
     }
     return TRANSFER_DATA_MATCH;
 }
@@ -379,6 +385,530 @@ stream_transfer_verify_data(uint64_t transfer_size, uint64_t destination_address
     return TRANSFER_DATA_MATCH;
 }
 
+/*
+ * Returns the name of the memory at address.
+ */
+static const char *
+memory_name(uint32_t address)
+{
+    if (STREAM_GEN == address)
+    {
+        return memory_descriptors[2];
+    }
+
+    if (address >= NON_CACHED_DDR_BASE_ADDRESS)
+    {
+        return memory_descriptors[1];
+    }
+
+    return memory_descriptors[0];
+}
+
+/*
+ * Converts a cycle count to micro-seconds.
+ */
+static uint64_t
+cycles_to_us(uint64_t cycles)
+{
+    return (uint64_t)((1000000 * cycles) / (double)LIBERO_SETTING_MSS_COREPLEX_CPU_CLK);
+}
+
+/*
+ * Fill the sources and clear the destinations of a PDMA and an FDMA list
+ * entry, and set up both transfers without starting them.
+ */
+static void
+concurrent_transfer_setup(uint32_t pdma_index, uint32_t fdma_index, uint32_t transfer_size)
+{
+    const dma_benchmarking_params_t *pdma_benchmark = &pdma_benchmark_list[pdma_index];
+    const dma_benchmarking_params_t *fdma_benchmark = &fdma_benchmark_list[fdma_index];
+    mss_pdma_channel_config_t pdma_config_ch;
+    uint32_t index;
+
+    /* Initialize variabels */
+    fdma_transfer_status = FDMA_TRANSFER_INCOMPLETE;
+    pdma_transfer_status = PDMA_TRANSFER_INCOMPLETE;
+
+    pdma_end_mcycle = 0u;
+    fdma_end_mcycle = 0u;
+
+    /* P-DMA Setup Code */
+    clear_64_mem((uint64_t *)pdma_benchmark->destination_address,
+                 (uint64_t *)(pdma_benchmark->destination_address + transfer_size));
+
+    /* Set a repeating pattern in the source memory block */
+    for (index = 0u; index < transfer_size; index++)
+    {
+        *((uint8_t *)pdma_benchmark->source_address + index) = ((index + 0x1u) & 0xFFu);
+    }
+    dma_bench_verify_source_filled();
+
+    configure_pdma(&pdma_config_ch,
+                   (uint64_t)pdma_benchmark->source_address,
+                   (uint64_t)pdma_benchmark->destination_address,
+                   transfer_size);
+
+    if (MSS_PDMA_setup_transfer(MSS_PDMA_CHANNEL_0, &pdma_config_ch, pdma_isr) != MSS_PDMA_OK)
+    {
+        MSS_UART_polled_tx_string(uart1, "\r\nError: Setup Transfer!\r\n");
+        HAL_ASSERT(0);
+    }
+
+    /* F-DMA Setup Code - F-DMA Memory to Memory Transfer*/
+    if (fdma_benchmark->source_address == STREAM_GEN)
+    {
+        STREAM_GEN_RESET_REG = UN_RESET_GENERATOR;
+
+        memset(((uint8_t *)fdma_benchmark->destination_address), 0x00, transfer_size);
+
+        /* Set the stream transfer to destination memory address */
+        AXI4DMA_configure_stream(&g_dmac,
+                                 (axi4dma_stream_desc_t *)NON_CACHED_DDR_BASE_ADDRESS,
+                                 TDEST_0,
+                                 STREAM_DESCRIPTOR_VALID | STREAM_DEST_DATA_READY |
+                                     STREAM_DEST_OPERAND,
+                                 transfer_size,
+                                 fdma_benchmark->destination_address);
+
+        STREAM_GEN_PATTERN_COUNT_REG = (STREAM_PATTERN_COUNT(transfer_size));
+    }
+    else
+    {
+        /* F-DMA Setup Code - F-DMA Memory to FPGA fabric Transfer*/
+        memset((uint8_t *)fdma_benchmark->destination_address, 0x00, transfer_size);
+
+        /* Set a repeating pattern in the source memory block */
+        for (index = 0u; index < transfer_size; index++)
+        {
+            *((uint8_t *)fdma_benchmark->source_address + index) = ((index + 0x1u) & 0xFFu);
+        }
+        dma_bench_verify_source_filled();
+
+        AXI4DMA_configure(&g_dmac,
+                          INTRN_DESC_0,
+                          OP_INC_ADDR,
+                          OP_INC_ADDR,
+                          transfer_size,
+                          fdma_benchmark->source_address,
+                          fdma_benchmark->destination_address);
+    }
+}
+
+/*
+ * Start the transfers set up by concurrent_transfer_setup() and return the
+ * start time in CPU clock cycles.
+ */
+static uint64_t
+concurrent_transfer_start(uint32_t fdma_index)
+{
+    uint64_t start_mcycle;
+
+    write_csr(mcycle, 0x0u);
+
+    start_mcycle = readmcycle();
+
+    /* Starting the PDMA */
+    if (MSS_PDMA_start_transfer(MSS_PDMA_CHANNEL_0) != MSS_PDMA_OK)
+    {
+        MSS_UART_polled_tx_string(uart1, "\r\nError: Start Transfer!\r\n");
+        HAL_ASSERT(0);
+    }
+
+    /* Starting the FDMA */
+    if (fdma_benchmark_list[fdma_index].source_address == STREAM_GEN)
+    {
+        STREAM_GEN_START_REG = START_STREAM_GEN;
+    }
+    else
+    {
+        AXI4DMA_start_transfer(&g_dmac, INTRN_DESC_0);
+    }
+
+    return start_mcycle;
+}
+
+/*
+ * Check the destinations of both completed transfers.
+ */
+static uint32_t
+concurrent_transfer_verify(uint32_t pdma_index, uint32_t fdma_index, uint32_t transfer_size)
+{
+    uint32_t pdma_transfer_data_integrity_check;
+    uint32_t fdma_transfer_data_integrity_check = TRANSFER_DATA_MISMATCH;
+
+    pdma_transfer_data_integrity_check =
+        block_transfer_verify_data(transfer_size,
+                                   (uint8_t *)pdma_benchmark_list[pdma_index].source_address,
+                                   (uint8_t *)pdma_benchmark_list[pdma_index].destination_address);
+
+    if (STREAM_TRANSFER_COMPLETE == fdma_transfer_status)
+    {
+        STREAM_GEN_START_REG = STOP_STREAM_GEN;
+        STREAM_GEN_RESET_REG = RESET_GENERATOR;
+
+        fdma_transfer_data_integrity_check =
+            stream_transfer_verify_data(transfer_size,
+                                        fdma_benchmark_list[fdma_index].destination_address);
+    }
+    else if (BLOCK_TRANSFER_COMPLETE == fdma_transfer_status)
+    {
+        fdma_transfer_data_integrity_check =
+            block_transfer_verify_data(transfer_size,
+                                       (uint8_t *)fdma_benchmark_list[fdma_index].source_address,
+                                       (uint8_t *)fdma_benchmark_list[fdma_index]
+                                           .destination_address);
+    }
+
+    if ((TRANSFER_DATA_MISMATCH == pdma_transfer_data_integrity_check) ||
+        (TRANSFER_DATA_MISMATCH == fdma_transfer_data_integrity_check))
+    {
+        return TRANSFER_DATA_MISMATCH;
+    }
+    return TRANSFER_DATA_MATCH;
+}
+
+/*
+ * Converts the accesses made by a CPU load in a number of clock cycles of its
+ * hart to MegaBits per second.
+ */
+static uint64_t
+load_rate(uint64_t accesses, uint64_t cycles)
+{
+    double seconds;
+
+    if (0u == cycles)
+    {
+        return 0u;
+    }
+
+    seconds = cycles / (double)LIBERO_SETTING_MSS_COREPLEX_CPU_CLK;
+
+    return (uint64_t)(((accesses * DMA_BENCH_LOAD_LINE_SIZE) / seconds) /
+                      BYTES_TO_MEGABITS_SCALE_FACTOR);
+}
+
+/*
+ * Converts a cycle count to nano-seconds.
+ */
+static uint64_t
+cycles_to_ns(uint64_t cycles)
+{
+    return (uint64_t)((1000000000 * cycles) / (double)LIBERO_SETTING_MSS_COREPLEX_CPU_CLK);
+}
+
+/*
+ * Prints a value and the percentage it is of a reference value.
+ */
+static void
+print_percent_cell(uint64_t value, uint64_t reference)
+{
+    char results_cell[21] = {0};
+
+    if (0u == reference)
+    {
+        sprintf(results_cell, "%lu", value);
+    }
+    else
+    {
+        sprintf(results_cell, "%lu (%lu%%)", value, (value * 100u) / reference);
+    }
+    print_table_cell(results_cell);
+}
+
+/*
+ * Time the transfers of one contention pair while probe runs on U54_1.
+ * probe_cycles is set to the mean CPU clock cycles per probe access, or 0 if
+ * the probe is idle.
+ */
+static void
+contention_transfer_run(uint32_t pair,
+                        const dma_bench_load_t *probe,
+                        uint64_t *pdma_cycles,
+                        uint64_t *fdma_cycles,
+                        uint64_t *probe_cycles)
+{
+    uint32_t pdma_index = contention_pair_list[pair][0];
+    uint32_t fdma_index = contention_pair_list[pair][1];
+    uint32_t transfer_size = ROUND_TO_DATA_WIDTH(CONTENTION_TRANSFER_SIZE);
+    uint64_t position = 0u;
+    uint64_t accesses = 0u;
+    uint64_t start_mcycle;
+    uint64_t end_mcycle;
+
+    concurrent_transfer_setup(pdma_index, fdma_index, transfer_size);
+    start_mcycle = concurrent_transfer_start(fdma_index);
+
+    while ((PDMA_TRANSFER_COMPLETE != pdma_transfer_status) ||
+           ((BLOCK_TRANSFER_COMPLETE != fdma_transfer_status) &&
+            (STREAM_TRANSFER_COMPLETE != fdma_transfer_status)))
+    {
+        if ((FDMA_TRANSFER_ERROR == fdma_transfer_status) ||
+            (PDMA_TRANSFER_ERROR == pdma_transfer_status))
+        {
+            error_reporter();
+            HAL_ASSERT(0);
+        }
+        accesses += dma_bench_load_run(probe, &position, CONTENTION_PROBE_CHUNK);
+    }
+    end_mcycle = readmcycle();
+
+    if (TRANSFER_DATA_MISMATCH ==
+        concurrent_transfer_verify(pdma_index, fdma_index, transfer_size))
+    {
+        benchmark_error_count++;
+    }
+
+    *pdma_cycles = pdma_end_mcycle - start_mcycle;
+    *fdma_cycles = fdma_end_mcycle - start_mcycle;
+    *probe_cycles = (0u == accesses) ? 0u : ((end_mcycle - start_mcycle) / accesses);
+}
+
+/*
+ * Prints the CSV lines of one row of the contention matrix.
+ */
+static void
+contention_print_csv(uint32_t pair,
+                     const char *scenario_name,
+                     const dma_bench_load_t *probe,
+                     const dma_bench_stats_t *pdma_stats,
+                     const dma_bench_stats_t *fdma_stats,
+                     const dma_bench_stats_t *probe_stats)
+{
+    const dma_benchmarking_params_t *pdma_benchmark =
+        &pdma_benchmark_list[contention_pair_list[pair][0]];
+    const dma_benchmarking_params_t *fdma_benchmark =
+        &fdma_benchmark_list[contention_pair_list[pair][1]];
+    uint32_t transfer_size = ROUND_TO_DATA_WIDTH(CONTENTION_TRANSFER_SIZE);
+    char engine[64] = {0};
+
+    sprintf(engine,
+            "pdma-%u-%u-%s",
+            contention_pair_list[pair][0] + 1u,
+            contention_pair_list[pair][1] + 1u,
+            scenario_name);
+    dma_bench_print_result(uart1,
+                           engine,
+                           memory_name(pdma_benchmark->source_address),
+                           memory_name(pdma_benchmark->destination_address),
+                           transfer_size,
+                           pdma_stats);
+
+    sprintf(engine,
+            "fdma-%u-%u-%s",
+            contention_pair_list[pair][0] + 1u,
+            contention_pair_list[pair][1] + 1u,
+            scenario_name);
+    dma_bench_print_result(uart1,
+                           engine,
+                           memory_name(fdma_benchmark->source_address),
+                           memory_name(fdma_benchmark->destination_address),
+                           transfer_size,
+                           fdma_stats);
+
+    if ((NULL != probe_stats) && (DMA_BENCH_LOAD_IDLE != probe->pattern))
+    {
+        sprintf(engine,
+                "probe-%u-%u-%s",
+                contention_pair_list[pair][0] + 1u,
+                contention_pair_list[pair][1] + 1u,
+                scenario_name);
+        dma_bench_print_result(uart1,
+                               engine,
+                               memory_name((uint32_t)probe->base),
+                               memory_name((uint32_t)probe->base),
+                               DMA_BENCH_LOAD_LINE_SIZE,
+                               probe_stats);
+    }
+}
+
+/*
+ * For each contention pair, time the PDMA and FDMA transfers on their own and
+ * then with each scenario of CPU loads running on U54_1 to U54_4. The transfer
+ * rates and the U54_1 latency are printed with the percentage they are of the
+ * values measured without contention.
+ */
+static void
+contention_matrix_benchmark(void)
+{
+    const contention_scenario_t *scenario;
+    const dma_bench_load_t idle = LOAD_IDLE;
+    uint64_t pdma_run_cycles[BENCHMARK_RUNS] = {0u};
+    uint64_t fdma_run_cycles[BENCHMARK_RUNS] = {0u};
+    uint64_t probe_run_cycles[BENCHMARK_RUNS] = {0u};
+    dma_bench_stats_t pdma_stats;
+    dma_bench_stats_t fdma_stats;
+    dma_bench_stats_t probe_stats;
+#ifdef CSV_OUTPUT
+    dma_bench_stats_t load_stats;
+#endif
+    uint64_t quiet_pdma_rate;
+    uint64_t quiet_fdma_rate;
+    uint64_t quiet_probe_ns;
+    uint64_t load_accesses;
+    uint64_t load_cycles;
+    uint64_t load_mbps;
+    uint64_t position;
+    uint64_t start_mcycle;
+    uint32_t transfer_size = ROUND_TO_DATA_WIDTH(CONTENTION_TRANSFER_SIZE);
+    uint32_t pair;
+    uint32_t index;
+    uint32_t hart;
+    uint32_t run;
+    char message[120] = {0};
+
+#ifdef CSV_OUTPUT
+    dma_bench_print_config(uart1, "contention", BENCHMARK_RUNS);
+#endif
+
+    for (pair = 0u; pair < CONTENTION_PAIR_COUNT; pair++)
+    {
+        const dma_benchmarking_params_t *pdma_benchmark =
+            &pdma_benchmark_list[contention_pair_list[pair][0]];
+        const dma_benchmarking_params_t *fdma_benchmark =
+            &fdma_benchmark_list[contention_pair_list[pair][1]];
+
+#ifndef CSV_OUTPUT
+        sprintf(message,
+                "\r\nPDMA: %s to %s, FDMA: %s to %s, %u bytes\r\n",
+                memory_name(pdma_benchmark->source_address),
+                memory_name(pdma_benchmark->destination_address),
+                memory_name(fdma_benchmark->source_address),
+                memory_name(fdma_benchmark->destination_address),
+                transfer_size);
+        MSS_UART_polled_tx_string(uart1, message);
+        MSS_UART_polled_tx_string(uart1, divider);
+        MSS_UART_polled_tx_string(uart1, contention_table_header);
+        MSS_UART_polled_tx_string(uart1, divider);
+#endif
+
+        /* The transfers with every hart idle */
+        for (run = 0u; run < BENCHMARK_RUNS; run++)
+        {
+            contention_transfer_run(pair,
+                                    &idle,
+                                    &pdma_run_cycles[run],
+                                    &fdma_run_cycles[run],
+                                    &probe_run_cycles[run]);
+        }
+        dma_bench_stats(pdma_run_cycles, BENCHMARK_RUNS, &pdma_stats);
+        dma_bench_stats(fdma_run_cycles, BENCHMARK_RUNS, &fdma_stats);
+        quiet_pdma_rate = dma_bench_rate(pdma_stats.median, transfer_size);
+        quiet_fdma_rate = dma_bench_rate(fdma_stats.median, transfer_size);
+
+#ifdef CSV_OUTPUT
+        contention_print_csv(pair, "dma-only", &idle, &pdma_stats, &fdma_stats, NULL);
+#else
+        print_table_cell((uint8_t *)"dma-only");
+        print_percent_cell(quiet_pdma_rate, quiet_pdma_rate);
+        print_percent_cell(quiet_fdma_rate, quiet_fdma_rate);
+        print_table_cell((uint8_t *)"-");
+        print_table_cell((uint8_t *)"-");
+        MSS_UART_polled_tx_string(uart1, "\r\n");
+#endif
+
+        for (index = 0u; index < CONTENTION_SCENARIO_COUNT; index++)
+        {
+            scenario = &contention_scenario_list[index];
+
+            /* Loads may overwrite each other's pointer chases, so lay them
+             * out again for every row. */
+            for (hart = 0u; hart < DMA_BENCH_LOAD_HARTS; hart++)
+            {
+                dma_bench_load_prepare(&scenario->hart_load[hart]);
+            }
+
+            /* The U54_1 latency without contention */
+            for (run = 0u; run < BENCHMARK_RUNS; run++)
+            {
+                position = 0u;
+                start_mcycle = readmcycle();
+                (void)dma_bench_load_run(&scenario->hart_load[0u],
+                                         &position,
+                                         CONTENTION_PROBE_ACCESSES);
+                probe_run_cycles[run] = (readmcycle() - start_mcycle) / CONTENTION_PROBE_ACCESSES;
+            }
+            dma_bench_stats(probe_run_cycles, BENCHMARK_RUNS, &probe_stats);
+            quiet_probe_ns = cycles_to_ns(probe_stats.median);
+
+            for (hart = 2u; hart <= DMA_BENCH_LOAD_HARTS; hart++)
+            {
+                if (0u != dma_bench_load_start(hart, &scenario->hart_load[hart - 1u]))
+                {
+                    sprintf(message, "\r\nU54_%u did not start its load!\r\n", hart);
+                    MSS_UART_polled_tx_string(uart1, message);
+                }
+            }
+
+            for (run = 0u; run < BENCHMARK_RUNS; run++)
+            {
+                contention_transfer_run(pair,
+                                        &scenario->hart_load[0u],
+                                        &pdma_run_cycles[run],
+                                        &fdma_run_cycles[run],
+                                        &probe_run_cycles[run]);
+            }
+
+            load_mbps = 0u;
+            for (hart = 2u; hart <= DMA_BENCH_LOAD_HARTS; hart++)
+            {
+                dma_bench_load_stop(hart, &load_accesses, &load_cycles);
+                load_mbps += load_rate(load_accesses, load_cycles);
+
+#ifdef CSV_OUTPUT
+                /* One sample, the mean cycles per access over the whole row */
+                if (0u != load_accesses)
+                {
+                    load_cycles /= load_accesses;
+                    dma_bench_stats(&load_cycles, 1u, &load_stats);
+                    sprintf(message,
+                            "load%u-%u-%u-%s",
+                            hart,
+                            contention_pair_list[pair][0] + 1u,
+                            contention_pair_list[pair][1] + 1u,
+                            scenario->name);
+                    dma_bench_print_result(
+                        uart1,
+                        message,
+                        memory_name((uint32_t)scenario->hart_load[hart - 1u].base),
+                        memory_name((uint32_t)scenario->hart_load[hart - 1u].base),
+                        DMA_BENCH_LOAD_LINE_SIZE,
+                        &load_stats);
+                }
+#endif
+            }
+
+            dma_bench_stats(pdma_run_cycles, BENCHMARK_RUNS, &pdma_stats);
+            dma_bench_stats(fdma_run_cycles, BENCHMARK_RUNS, &fdma_stats);
+            dma_bench_stats(probe_run_cycles, BENCHMARK_RUNS, &probe_stats);
+
+#ifdef CSV_OUTPUT
+            contention_print_csv(pair,
+                                 scenario->name,
+                                 &scenario->hart_load[0u],
+                                 &pdma_stats,
+                                 &fdma_stats,
+                                 &probe_stats);
+#else
+            print_table_cell((uint8_t *)scenario->name);
+            print_percent_cell(dma_bench_rate(pdma_stats.median, transfer_size), quiet_pdma_rate);
+            print_percent_cell(dma_bench_rate(fdma_stats.median, transfer_size), quiet_fdma_rate);
+            if (DMA_BENCH_LOAD_IDLE == scenario->hart_load[0u].pattern)
+            {
+                print_table_cell((uint8_t *)"-");
+            }
+            else
+            {
+                print_percent_cell(cycles_to_ns(probe_stats.median), quiet_probe_ns);
+            }
+            print_percent_cell(load_mbps, 0u);
+            MSS_UART_polled_tx_string(uart1, "\r\n");
+#endif
+        }
+    }
+
+    pdma_print_error_count();
+}
+
 void
 u54_1(void)
 {
@@ -412,10 +942,11 @@ u54_1(void)
 
     uint64_t benchmark_start_mcycle = 0u;
 
-    uint32_t pdma_transfer_data_integrity_check = TRANSFER_DATA_MISMATCH;
-    uint32_t fdma_transfer_data_integrity_check = TRANSFER_DATA_MISMATCH;
-
-    mss_pdma_channel_config_t pdma_config_ch;
+    uint32_t current_run = 0u;
+    uint64_t pdma_run_cycles[BENCHMARK_RUNS] = {0u};
+    uint64_t fdma_run_cycles[BENCHMARK_RUNS] = {0u};
+    dma_bench_stats_t pdma_run_stats;
+    dma_bench_stats_t fdma_run_stats;
 
     char selection_message[25u] = {0};
 
@@ -450,13 +981,22 @@ u54_1(void)
                 while (1u)
                 {
                     pdma_choice = get_user_input();
-                    if ((pdma_choice == 'a') || ((pdma_choice > '0') && (pdma_choice < '5')))
+                    if ((pdma_choice == 'a') || (pdma_choice == 'c') ||
+                        ((pdma_choice > '0') && (pdma_choice < '5')))
                     {
                         break;
                     }
                     MSS_UART_polled_tx_string(uart1, invalid_selection_message);
                     MSS_UART_polled_tx_string(uart1, pdma_options);
                 }
+                if ('c' == pdma_choice)
+                {
+                    MSS_UART_polled_tx_string(uart1,
+                                              "\r\n\r\nRunning the contention matrix.\r\n\r\n");
+                    contention_matrix_benchmark();
+                    break;
+                }
+
                 if ('a' == pdma_choice)
                 {
                     MSS_UART_polled_tx_string(uart1, "\r\n\r\nRunning all benchmarks.\r\n\r\n");
@@ -492,10 +1032,15 @@ u54_1(void)
                 }
                 current_transfer_size =
                     fdma_benchmark_list[fdma_benchmarking_index].min_tranfer_size;
+                current_run = 0u;
 
+#ifdef CSV_OUTPUT
+                dma_bench_print_config(uart1, "concurrent", BENCHMARK_RUNS);
+#else
                 MSS_UART_polled_tx_string(uart1, divider);
                 MSS_UART_polled_tx_string(uart1, table_header);
                 MSS_UART_polled_tx_string(uart1, divider);
+#endif
 
                 transfer_state = TRANSFER_SETUP;
                 break;
@@ -508,118 +1053,13 @@ u54_1(void)
                         ROUND_TO_DATA_WIDTH(
                             fdma_benchmark_list[fdma_benchmarking_index].max_transfer_size))
                     {
-                        /* Initialize variabels */
-                        fdma_transfer_status = FDMA_TRANSFER_INCOMPLETE;
-                        pdma_transfer_status = PDMA_TRANSFER_INCOMPLETE;
-
-                        pdma_end_mcycle = 0u;
-                        fdma_end_mcycle = 0u;
-
-                        /* P-DMA Setup Code */
-                        clear_64_mem((uint64_t *)pdma_benchmark_list[pdma_benchmarking_index]
-                                         .destination_address,
-                                     (uint64_t *)(pdma_benchmark_list[pdma_benchmarking_index]
-                                                      .destination_address +
-                                                  ROUND_TO_DATA_WIDTH(current_transfer_size)));
-
-                        /* Set a repeating pattern in the source memory block */
-                        for (uint32_t index = 0; index < ROUND_TO_DATA_WIDTH(current_transfer_size);
-                             index++)
-                        {
-                            *((uint8_t *)pdma_benchmark_list[pdma_benchmarking_index]
-                                  .source_address +
-                              index) = ((index + 0x1u) & 0xFFu);
-                        }
-
-                        configure_pdma(
-                            &pdma_config_ch,
-                            (uint64_t)pdma_benchmark_list[pdma_benchmarking_index].source_address,
-                            (uint64_t)pdma_benchmark_list[pdma_benchmarking_index]
-                                .destination_address,
-                            ROUND_TO_DATA_WIDTH(current_transfer_size));
-
-                        if (MSS_PDMA_setup_transfer(MSS_PDMA_CHANNEL_0,
-                                                    &pdma_config_ch,
-                                                    pdma_isr) != MSS_PDMA_OK)
-                        {
-                            MSS_UART_polled_tx_string(uart1, "\r\nError: Setup Transfer!\r\n");
-                            HAL_ASSERT(0);
-                        }
-
-                        /* F-DMA Setup Code - F-DMA Memory to Memory Transfer*/
-                        if (fdma_benchmark_list[fdma_benchmarking_index].source_address ==
-                            STREAM_GEN)
-                        {
-                            STREAM_GEN_RESET_REG = UN_RESET_GENERATOR;
-
-                            memset(((uint8_t *)fdma_benchmark_list[fdma_benchmarking_index]
-                                        .destination_address),
-                                   0x00,
-                                   ROUND_TO_DATA_WIDTH(current_transfer_size));
-
-                            /* Set the stream transfer to destination memory address */
-                            AXI4DMA_configure_stream(
-                                &g_dmac,
-                                (axi4dma_stream_desc_t *)NON_CACHED_DDR_BASE_ADDRESS,
-                                TDEST_0,
-                                STREAM_DESCRIPTOR_VALID | STREAM_DEST_DATA_READY |
-                                    STREAM_DEST_OPERAND,
-                                (ROUND_TO_DATA_WIDTH(current_transfer_size)),
-                                fdma_benchmark_list[fdma_benchmarking_index].destination_address);
-
-                            STREAM_GEN_PATTERN_COUNT_REG =
-                                (STREAM_PATTERN_COUNT(current_transfer_size));
-                        }
-                        else
-                        {
-                            /* F-DMA Setup Code - F-DMA Memory to FPGA fabric Transfer*/
-                            memset((uint8_t *)fdma_benchmark_list[fdma_benchmarking_index]
-                                       .destination_address,
-                                   0x00,
-                                   ROUND_TO_DATA_WIDTH(current_transfer_size));
-
-                            /* Set a repeating pattern in the source memory block */
-                            for (uint32_t index = 0;
-                                 index < ROUND_TO_DATA_WIDTH(current_transfer_size);
-                                 index++)
-                            {
-                                *((uint8_t *)fdma_benchmark_list[fdma_benchmarking_index]
-                                      .source_address +
-                                  index) = ((index + 0x1u) & 0xFFu);
-                            }
-
-                            AXI4DMA_configure(
-                                &g_dmac,
-                                INTRN_DESC_0,
-                                OP_INC_ADDR,
-                                OP_INC_ADDR,
-                                (ROUND_TO_DATA_WIDTH(current_transfer_size)),
-                                fdma_benchmark_list[fdma_benchmarking_index].source_address,
-                                fdma_benchmark_list[fdma_benchmarking_index].destination_address);
-                        }
+                        concurrent_transfer_setup(pdma_benchmarking_index,
+                                                  fdma_benchmarking_index,
+                                                  ROUND_TO_DATA_WIDTH(current_transfer_size));
 
                         /* Both DMA Setup Correctly: Start Timing*/
-                        write_csr(mcycle, 0x0u);
-
-                        benchmark_start_mcycle = readmcycle();
-
-                        /* Starting the PDMA */
-                        if (MSS_PDMA_start_transfer(MSS_PDMA_CHANNEL_0) != MSS_PDMA_OK)
-                        {
-                            MSS_UART_polled_tx_string(uart1, "\r\nError: Start Transfer!\r\n");
-                            HAL_ASSERT(0);
-                        }
-
-                        /* Starting the FDMA */
-                        if (fdma_benchmark_list[fdma_benchmarking_index].source_address ==
-                            STREAM_GEN)
-                        {
-                            STREAM_GEN_START_REG = START_STREAM_GEN;
-                        }
-                        else
-                        {
-                            AXI4DMA_start_transfer(&g_dmac, INTRN_DESC_0);
-                        }
+                        benchmark_start_mcycle =
+                            concurrent_transfer_start(fdma_benchmarking_index);
 
                         transfer_state = TRANSFER_IN_PROGRESS;
                         break;
@@ -663,31 +1103,10 @@ u54_1(void)
             case TRANSFER_COMPLETE:
 
                 /* Checking that the transferred data is correct */
-                pdma_transfer_data_integrity_check = block_transfer_verify_data(
-                    ROUND_TO_DATA_WIDTH(current_transfer_size),
-                    (uint8_t *)pdma_benchmark_list[pdma_benchmarking_index].source_address,
-                    (uint8_t *)pdma_benchmark_list[pdma_benchmarking_index].destination_address);
-
-                if (STREAM_TRANSFER_COMPLETE == fdma_transfer_status)
-                {
-                    STREAM_GEN_START_REG = STOP_STREAM_GEN;
-                    STREAM_GEN_RESET_REG = RESET_GENERATOR;
-
-                    fdma_transfer_data_integrity_check = stream_transfer_verify_data(
-                        (ROUND_TO_DATA_WIDTH(current_transfer_size)),
-                        fdma_benchmark_list[fdma_benchmarking_index].destination_address);
-                }
-                else if (BLOCK_TRANSFER_COMPLETE == fdma_transfer_status)
-                {
-                    fdma_transfer_data_integrity_check = block_transfer_verify_data(
-                        ROUND_TO_DATA_WIDTH(current_transfer_size),
-                        (uint8_t *)fdma_benchmark_list[fdma_benchmarking_index].source_address,
-                        (uint8_t *)fdma_benchmark_list[fdma_benchmarking_index]
-                            .destination_address);
-                }
-
-                if ((TRANSFER_DATA_MISMATCH == pdma_transfer_data_integrity_check) ||
-                    (TRANSFER_DATA_MISMATCH == fdma_transfer_data_integrity_check))
+                if (TRANSFER_DATA_MISMATCH ==
+                    concurrent_transfer_verify(pdma_benchmarking_index,
+                                               fdma_benchmarking_index,
+                                               ROUND_TO_DATA_WIDTH(current_transfer_size)))
                 {
                     MSS_UART_polled_tx_string(uart1,
                                               "\r\nError Data Mismatch!!\r\n> Hal Assert!\r\n");
@@ -696,131 +1115,77 @@ u54_1(void)
                 }
                 else
                 {
-                    /* Calculating the time (mcycles) */
-                    double pdma_time_in_seconds;
-                    double fdma_time_in_seconds;
+                    /* Repeat the transfers until every run has been timed. */
+                    pdma_run_cycles[current_run] = pdma_end_mcycle - benchmark_start_mcycle;
+                    fdma_run_cycles[current_run] = fdma_end_mcycle - benchmark_start_mcycle;
+                    current_run++;
+                    transfer_state = TRANSFER_SETUP;
+
+                    if (current_run < BENCHMARK_RUNS)
+                    {
+                        break;
+                    }
 
-                    pdma_time_in_seconds = (1000000 * (pdma_end_mcycle - benchmark_start_mcycle)) /
-                                           (double)LIBERO_SETTING_MSS_COREPLEX_CPU_CLK;
-                    fdma_time_in_seconds = (1000000 * (fdma_end_mcycle - benchmark_start_mcycle)) /
-                                           (double)LIBERO_SETTING_MSS_COREPLEX_CPU_CLK;
+                    dma_bench_stats(pdma_run_cycles, BENCHMARK_RUNS, &pdma_run_stats);
+                    dma_bench_stats(fdma_run_cycles, BENCHMARK_RUNS, &fdma_run_stats);
+                    current_run = 0u;
 
                     /* Printing the results */
                     char results_cell[21] = {0};
 
+#ifdef CSV_OUTPUT
+                    /* The engine names carry the list entries which ran together. */
+                    sprintf(results_cell,
+                            "pdma-%u-%u",
+                            pdma_benchmarking_index + 1u,
+                            fdma_benchmarking_index + 1u);
+                    dma_bench_print_result(
+                        uart1,
+                        results_cell,
+                        memory_name(pdma_benchmark_list[pdma_benchmarking_index].source_address),
+                        memory_name(
+                            pdma_benchmark_list[pdma_benchmarking_index].destination_address),
+                        ROUND_TO_DATA_WIDTH(current_transfer_size),
+                        &pdma_run_stats);
+
+                    sprintf(results_cell,
+                            "fdma-%u-%u",
+                            pdma_benchmarking_index + 1u,
+                            fdma_benchmarking_index + 1u);
+                    dma_bench_print_result(
+                        uart1,
+                        results_cell,
+                        memory_name(fdma_benchmark_list[fdma_benchmarking_index].source_address),
+                        memory_name(
+                            fdma_benchmark_list[fdma_benchmarking_index].destination_address),
+                        ROUND_TO_DATA_WIDTH(current_transfer_size),
+                        &fdma_run_stats);
+#else
                     sprintf(results_cell, "%d", ROUND_TO_DATA_WIDTH(current_transfer_size));
                     print_table_cell(results_cell);
 
-                    /* Source Address: PDMA*/
-                    switch (pdma_benchmark_list[pdma_benchmarking_index].source_address)
-                    {
-                        case PDMA_CAHCED_DDR0:
-                            print_table_cell(memory_descriptors[0]);
-                            break;
-
-                        case PDMA_NON_CACHED_DDR0:
-                            print_table_cell(memory_descriptors[1]);
-                            break;
-
-                        default:
-                            sprintf(results_cell,
-                                    "0x%lx",
-                                    (uint64_t)pdma_benchmark_list[pdma_benchmarking_index]
-                                        .source_address);
-                            print_table_cell(results_cell);
-                            break;
-                    }
-
-                    /* Source Address FDMA*/
-                    switch (fdma_benchmark_list[fdma_benchmarking_index].source_address)
-                    {
-                        case FDMA_CAHCED_DDR0:
-                            print_table_cell(memory_descriptors[0]);
-                            break;
-
-                        case FDMA_NON_CACHED_DDR0:
-                            print_table_cell(memory_descriptors[1]);
-                            break;
-
-                        case STREAM_GEN:
-                            print_table_cell(memory_descriptors[2]);
-                            break;
-
-                        default:
-                            sprintf(results_cell,
-                                    "0x%lx",
-                                    (uint64_t)fdma_benchmark_list[fdma_benchmarking_index]
-                                        .source_address);
-                            print_table_cell(results_cell);
-                            break;
-                    }
-
-                    /* Destination Address PDMA*/
-                    switch (pdma_benchmark_list[pdma_benchmarking_index].destination_address)
-                    {
-                        case PDMA_CAHCED_DDR0:
-                            print_table_cell(memory_descriptors[0]);
-                            break;
-
-                        case PDMA_CACHED_DDR1:
-                            print_table_cell(memory_descriptors[0]);
-                            break;
-
-                        case PDMA_NON_CACHED_DDR0:
-                            print_table_cell(memory_descriptors[0]);
-                            break;
-
-                        case PDMA_NON_CACHED_DDR1:
-                            print_table_cell(memory_descriptors[1]);
-                            break;
-
-                        default:
-                            sprintf(results_cell,
-                                    "0x%lx",
-                                    (uint64_t)pdma_benchmark_list[pdma_benchmarking_index]
-                                        .destination_address);
-                            print_table_cell(results_cell);
-                            break;
-                    }
-
-                    /* Destination Address FDMA*/
-                    switch (fdma_benchmark_list[fdma_benchmarking_index].destination_address)
-                    {
-                        case FDMA_CAHCED_DDR0:
-                            print_table_cell(memory_descriptors[0]);
-                            break;
-
-                        case FDMA_CACHED_DDR1:
-                            print_table_cell(memory_descriptors[0]);
-                            break;
-
-                        case FDMA_NON_CACHED_DDR0:
-                            print_table_cell(memory_descriptors[1]);
-                            break;
-
-                        case FDMA_NON_CACHED_DDR1:
-                            print_table_cell(memory_descriptors[1]);
-                            break;
-
-                        default:
-                            sprintf(results_cell,
-                                    "0x%lx",
-                                    (uint64_t)fdma_benchmark_list[fdma_benchmarking_index]
-                                        .destination_address);
-                            print_table_cell(results_cell);
-                            break;
-                    }
-
-                    sprintf(results_cell, "%ld", (uint64_t)pdma_time_in_seconds);
+                    print_table_cell((uint8_t *)memory_name(
+                        pdma_benchmark_list[pdma_benchmarking_index].source_address));
+                    print_table_cell((uint8_t *)memory_name(
+                        fdma_benchmark_list[fdma_benchmarking_index].source_address));
+                    print_table_cell((uint8_t *)memory_name(
+                        pdma_benchmark_list[pdma_benchmarking_index].destination_address));
+                    print_table_cell((uint8_t *)memory_name(
+                        fdma_benchmark_list[fdma_benchmarking_index].destination_address));
+
+                    /* Times of the median runs */
+                    sprintf(results_cell, "%ld", cycles_to_us(pdma_run_stats.median));
                     print_table_cell(results_cell);
 
-                    sprintf(results_cell, "%ld", (uint64_t)fdma_time_in_seconds);
+                    sprintf(results_cell, "%ld", cycles_to_us(fdma_run_stats.median));
                     print_table_cell(results_cell);
 
                     MSS_UART_polled_tx_string(uart1, "\r\n");
+#endif
 
-                    current_transfer_size += fdma_benchmark_list[fdma_benchmarking_index].step_size;
-                    transfer_state = TRANSFER_SETUP;
+                    current_transfer_size =
+                        dma_bench_next_size(current_transfer_size,
+                                            fdma_benchmark_list[fdma_benchmarking_index].step_percent);
                     break;
                 }
 
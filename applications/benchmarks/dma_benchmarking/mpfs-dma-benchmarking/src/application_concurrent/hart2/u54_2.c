@@ -11,6 +11,7 @@
 #include <string.h>
 #include "mpfs_hal/mss_hal.h"
 #include "drivers/mss/mss_mmuart/mss_uart.h"
+#include "dma_bench/dma_bench_load.h"
 
 volatile uint32_t count_sw_ints_h2 = 0U;
 
@@ -22,7 +23,6 @@ volatile uint32_t count_sw_ints_h2 = 0U;
 void u54_2(void)
 {
     uint64_t hartid = read_csr(mhartid);
-    volatile uint32_t icount = 0U;
 
     /* Clear pending software interrupt in case there was any.
        Enable only the software interrupt so that the E51 core can bring this
@@ -45,14 +45,8 @@ void u54_2(void)
 
     __enable_irq();
 
-    while (1U)
-    {
-        icount++;
-        if (0x100000U == icount)
-        {
-            icount = 0U;
-        }
-    }
+    /* Run the CPU loads of the contention matrix started by U54_1 */
+    dma_bench_load_worker();
 
     /* never return */
 }
@@ -13,10 +13,22 @@
 #define MIN_TRANSFER_SIZE_BYTES (1000u)
 #define MAX_TRANSFER_SIZE_BYTES (TRANSFER_1_MB)
 
-/* Macros defining benchmark transfer sizes */
-#define TRANSFER_STEP_SIZE      (100u)
+/* Macros defining benchmark transfer sizes. The sizes are log spaced, each
+ * one TRANSFER_STEP_PERCENT percent of the previous one. */
+#define TRANSFER_STEP_PERCENT   (125u)
 #define TRANSFER_1_MB           (1000000u)
 
+/* Number of times each transfer size is run. The minimum, median, 99th
+ * percentile and maximum over all runs are reported. */
+#define BENCHMARK_RUNS          (11u)
+
+/* Print results as CSV lines instead of a table, see README.md */
+#undef CSV_OUTPUT
+
+/* How block transfers are checked: DMA_BENCH_VERIFY_COMPARE,
+ * DMA_BENCH_VERIFY_CRC32C or DMA_BENCH_VERIFY_PDMA, see README.md */
+#define VERIFY_MODE             DMA_BENCH_VERIFY_COMPARE
+
 /* Turn on force ordering on for PDMA transactions*/
 #undef FORCE_ORDER
 
@@ -112,7 +124,7 @@ typedef struct
     uint32_t destination_address;
     uint32_t min_tranfer_size;
     uint32_t max_transfer_size;
-    uint32_t step_size;
+    uint32_t step_percent;
 } dma_benchmarking_params_t;
 
 const dma_benchmarking_params_t fdma_benchmark_list[FDMA_BENCHMARKING_LIST_SIZE] = {
@@ -120,31 +132,31 @@ const dma_benchmarking_params_t fdma_benchmark_list[FDMA_BENCHMARKING_LIST_SIZE]
      CACHED_DDR1,
      MIN_TRANSFER_SIZE_BYTES,
      MAX_TRANSFER_SIZE_BYTES,
-     TRANSFER_STEP_SIZE},
+     TRANSFER_STEP_PERCENT},
     {CACHED_DDR0,
      NON_CACHED_DDR1,
      MIN_TRANSFER_SIZE_BYTES,
      MAX_TRANSFER_SIZE_BYTES,
-     TRANSFER_STEP_SIZE},
+     TRANSFER_STEP_PERCENT},
     {NON_CACHED_DDR0,
      NON_CACHED_DDR1,
      MIN_TRANSFER_SIZE_BYTES,
      MAX_TRANSFER_SIZE_BYTES,
-     TRANSFER_STEP_SIZE},
+     TRANSFER_STEP_PERCENT},
     {NON_CACHED_DDR0,
      CACHED_DDR1,
      MIN_TRANSFER_SIZE_BYTES,
      MAX_TRANSFER_SIZE_BYTES,
-     TRANSFER_STEP_SIZE},
+     TRANSFER_STEP_PERCENT},
     {STREAM_GEN,
      NON_CACHED_DDR1,
      MIN_TRANSFER_SIZE_BYTES,
      MAX_TRANSFER_SIZE_BYTES,
-     TRANSFER_STEP_SIZE},
+     TRANSFER_STEP_PERCENT},
     {STREAM_GEN,
      CACHED_DDR1,
      MIN_TRANSFER_SIZE_BYTES,
      MAX_TRANSFER_SIZE_BYTES,
-     TRANSFER_STEP_SIZE}};
+     TRANSFER_STEP_PERCENT}};
 
 #endif /* FDMA_BENCHMARKING_CONFIG_H_ */
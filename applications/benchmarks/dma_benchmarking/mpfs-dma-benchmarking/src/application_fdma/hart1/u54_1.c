@@ -13,8 +13,14 @@
 #include "fdma_benchmarking_config.h"
 #include "drivers/fpga_ip/CoreAXI4DMAController/core_axi4dmacontroller.h"
 #include "drivers/mss/mss_mmuart/mss_uart.h"
+#include "dma_bench/dma_bench_stats.h"
+#include "dma_bench/dma_bench_verify.h"
 #include "mpfs_hal/mss_hal.h"
 
+#if (BENCHMARK_RUNS > DMA_BENCH_MAX_RUNS)
+#error "BENCHMARK_RUNS must not be more than DMA_BENCH_MAX_RUNS"
+#endif
+
 axi4dma_instance_t g_dmac;
 mss_uart_instance_t *uart1 = &g_mss_uart1_lo;
 
@@ -224,30 +230,26 @@ block_transfer_verify_data(uint32_t transfer_size,
                            uint8_t *source_address,
                            uint8_t *destination_address)
 {
-    volatile uint8_t *source = NULL;
-    volatile uint8_t *destination = NULL;
-    uint32_t index = 0u;
+    uint64_t offset = 0u;
 
-    for (index = 0; index < transfer_size; index++)
+    if (0u != dma_bench_verify(VERIFY_MODE,
+                               source_address,
+                               destination_address,
+                               transfer_size,
+                               &offset))
     {
-        source = (source_address + index);
-        destination = (destination_address + index);
-        mb();
-        if (*source != *destination)
-        {
 #ifdef DEBUG_DMA
-            uint8_t debug_message[100] = {0};
-
-            sprintf(debug_message,
-                    "\r\nError at address: 0x%-9x!"
-                    "\tExpected: %-6iRead: %-6i",
-                    destination,
-                    *source,
-                    *destination);
-            MSS_UART_polled_tx_string(uart1, debug_message);
+        uint8_t debug_message[100] = {0};
+
+        sprintf(debug_message,
+                "\r\nError at address: 0x%-9x!"
+                "\tExpected: %-6iRead: %-6i",
+                (destination_address + offset),
+                source_address[offset],
+                destination_address[offset]);
+        MSS_UART_polled_tx_string(uart1, debug_message);
 #endif
-            return TRANSFER_DATA_MISMATCH;
-        }
+        return TRANSFER_DATA_MISMATCH;
     }
     return TRANSFER_DATA_MATCH;
 }
@@ -279,16 +281,30 @@ stream_transfer_verify_data(uint64_t transfer_size, uint64_t destination_address
     return TRANSFER_DATA_MATCH;
 }
 
-double
-calculate_rate(uint64_t clock_cycles, uint32_t transfer_size)
+/*
+ * Returns the name of the memory at address, or its address written into
+ * buffer if it is not one of the benchmarked memories.
+ */
+static const char *
+memory_name(uint32_t address, char *buffer)
 {
-    /* seconds*/
-    double seconds = clock_cycles / (double)LIBERO_SETTING_MSS_COREPLEX_CPU_CLK;
-    /* Bits per second*/
-    double transfer_rate = transfer_size / seconds;
-    /* MegaBits per second*/
-    transfer_rate /= BYTES_TO_MEGABITS_SCALE_FACTOR;
-    return transfer_rate;
+    switch (address)
+    {
+        case CACHED_DDR0:
+        case CACHED_DDR1:
+            return memory_descriptors[0];
+
+        case NON_CACHED_DDR0:
+        case NON_CACHED_DDR1:
+            return memory_descriptors[1];
+
+        case STREAM_GEN:
+            return memory_descriptors[2];
+
+        default:
+            sprintf(buffer, "0x%lx", (uint64_t)address);
+            return buffer;
+    }
 }
 
 void
@@ -322,6 +338,10 @@ u54_1(void)
 
     uint64_t benchmark_start_mcycle = 0u;
 
+    uint32_t current_run = 0u;
+    uint64_t run_cycles[BENCHMARK_RUNS] = {0u};
+    dma_bench_stats_t run_stats;
+
     uint32_t fdma_transfer_data_integrity_check = TRANSFER_DATA_MISMATCH;
 
     char selection_message[25u] = {0};
@@ -372,10 +392,15 @@ u54_1(void)
                     total_benchmarks = 1u;
                 }
                 current_transfer_size = fdma_benchmark_list[fdma_benchmark_index].min_tranfer_size;
+                current_run = 0u;
 
+#ifdef CSV_OUTPUT
+                dma_bench_print_config(uart1, "fdma", BENCHMARK_RUNS);
+#else
                 MSS_UART_polled_tx_string(uart1, divider);
                 MSS_UART_polled_tx_string(uart1, table_header);
                 MSS_UART_polled_tx_string(uart1, divider);
+#endif
 
                 transfer_state = TRANSFER_SETUP;
                 break;
@@ -433,6 +458,7 @@ u54_1(void)
                                       .source_address +
                                   index) = ((index + 0x1u) & 0xFFu);
                             }
+                            dma_bench_verify_source_filled();
 
                             AXI4DMA_configure(
                                 &g_dmac,
@@ -523,84 +549,59 @@ u54_1(void)
                 }
                 else
                 {
-                    /* Calculating the transfer rate MegaBits per Second */
-                    double fdma_transfer_rate =
-                        calculate_rate((fdma_end_mcycle - benchmark_start_mcycle),
-                                       (ROUND_TO_DATA_WIDTH(current_transfer_size)));
+                    /* Repeat the transfer until every run has been timed. */
+                    run_cycles[current_run] = fdma_end_mcycle - benchmark_start_mcycle;
+                    current_run++;
+                    transfer_state = TRANSFER_SETUP;
+
+                    if (current_run < BENCHMARK_RUNS)
+                    {
+                        break;
+                    }
+
+                    dma_bench_stats(run_cycles, BENCHMARK_RUNS, &run_stats);
+                    current_run = 0u;
 
                     /* Printing the results */
                     char results_cell[21] = {0};
 
+#ifdef CSV_OUTPUT
+                    char destination_cell[21] = {0};
+
+                    dma_bench_print_result(
+                        uart1,
+                        "fdma",
+                        memory_name(fdma_benchmark_list[fdma_benchmark_index].source_address,
+                                    results_cell),
+                        memory_name(fdma_benchmark_list[fdma_benchmark_index].destination_address,
+                                    destination_cell),
+                        ROUND_TO_DATA_WIDTH(current_transfer_size),
+                        &run_stats);
+#else
                     sprintf(results_cell, "%d", ROUND_TO_DATA_WIDTH(current_transfer_size));
                     print_table_cell(results_cell);
 
-                    /* Source Address*/
-                    switch (fdma_benchmark_list[fdma_benchmark_index].source_address)
-                    {
-                        case CACHED_DDR0:
-                            print_table_cell(memory_descriptors[0]);
-                            break;
-
-                        case NON_CACHED_DDR0:
-                            print_table_cell(memory_descriptors[1]);
-                            break;
-
-                        case STREAM_GEN:
-                            print_table_cell(memory_descriptors[2]);
-                            break;
-
-                        default:
-                            sprintf(
-                                results_cell,
-                                "0x%lx",
-                                (uint64_t)fdma_benchmark_list[fdma_benchmark_index].source_address);
-                            print_table_cell(results_cell);
-                            break;
-                    }
+                    print_table_cell(
+                        (uint8_t *)memory_name(fdma_benchmark_list[fdma_benchmark_index].source_address,
+                                               results_cell));
+                    print_table_cell((uint8_t *)memory_name(
+                        fdma_benchmark_list[fdma_benchmark_index].destination_address,
+                        results_cell));
 
-                    /* Destination Address*/
-                    switch (fdma_benchmark_list[fdma_benchmark_index].destination_address)
-                    {
-                        case CACHED_DDR0:
-                            print_table_cell(memory_descriptors[0]);
-                            break;
-
-                        case CACHED_DDR1:
-                            print_table_cell(memory_descriptors[0]);
-                            break;
-
-                        case NON_CACHED_DDR0:
-                            print_table_cell(memory_descriptors[1]);
-                            break;
-
-                        case NON_CACHED_DDR1:
-                            print_table_cell(memory_descriptors[1]);
-                            break;
-
-                        default:
-                            sprintf(results_cell,
-                                    "0x%lx",
-                                    (uint64_t)fdma_benchmark_list[fdma_benchmark_index]
-                                        .destination_address);
-                            print_table_cell(results_cell);
-                            break;
-                    }
+                    print_table_cell("Pass");
 
-                    if (TRANSFER_DATA_MISMATCH == fdma_transfer_data_integrity_check)
-                    {
-                        print_table_cell("Fail");
-                    }
-                    else
-                    {
-                        print_table_cell("Pass");
-                    }
-
-                    sprintf(results_cell, "%ld", (uint64_t)fdma_transfer_rate);
+                    /* Rate of the median run */
+                    sprintf(results_cell,
+                            "%ld",
+                            dma_bench_rate(run_stats.median,
+                                           ROUND_TO_DATA_WIDTH(current_transfer_size)));
                     print_table_cell(results_cell);
                     MSS_UART_polled_tx_string(uart1, "\r\n");
+#endif
 
-                    current_transfer_size += fdma_benchmark_list[fdma_benchmark_index].step_size;
-                    transfer_state = TRANSFER_SETUP;
+                    current_transfer_size =
+                        dma_bench_next_size(current_transfer_size,
+                                            fdma_benchmark_list[fdma_benchmark_index].step_percent);
                     break;
                 }
 
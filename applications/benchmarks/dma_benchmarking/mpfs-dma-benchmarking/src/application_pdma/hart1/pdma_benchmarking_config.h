@@ -16,10 +16,41 @@
 #define MIN_TRANSFER_SIZE_BYTES (1000u)
 #define MAX_TRANSFER_SIZE_BYTES (TRANSFER_1_MB)
 
-/* Macros defining benchmark transfer sizes */
-#define TRANSFER_STEP_SIZE      (100u)
+/* Macros defining benchmark transfer sizes. The sizes are log spaced, each
+ * one TRANSFER_STEP_PERCENT percent of the previous one. */
+#define TRANSFER_STEP_PERCENT   (125u)
 #define TRANSFER_1_MB           (1000000u)
 
+/* Number of times each transfer size is run. The minimum, median, 99th
+ * percentile and maximum over all runs are reported. */
+#define BENCHMARK_RUNS          (11u)
+
+/* Print results as CSV lines instead of a table, see README.md */
+#undef CSV_OUTPUT
+
+/* How block transfers are checked: DMA_BENCH_VERIFY_COMPARE,
+ * DMA_BENCH_VERIFY_CRC32C or DMA_BENCH_VERIFY_PDMA, see README.md */
+#define VERIFY_MODE             DMA_BENCH_VERIFY_COMPARE
+
+/* Queued transfer benchmark: back to back transfers of QUEUED_TRANSFER_SIZE
+ * bytes, with up to QUEUED_TRANSFER_DEPTH outstanding on the channel. */
+#define QUEUED_TRANSFER_COUNT   (64u)
+#define QUEUED_TRANSFER_SIZE    (1024u)
+#define QUEUED_TRANSFER_DEPTH   (16u)
+
+/* Transaction size tuning: write and read sizes from TUNING_MIN_SIZE_LOG2 to
+ * TUNING_MAX_SIZE_LOG2 are tried at each size in tuning_transfer_size_list, up
+ * to the largest size used for the memory pair. The PDMA does not make
+ * transactions larger than 64 bytes, so sizes above 6 give the same result. */
+#define TUNING_MIN_SIZE_LOG2        (0x0u)
+#define TUNING_MAX_SIZE_LOG2        (0x6u)
+#define TUNING_TRANSFER_SIZE_COUNT  (3u)
+
+/* memcpy threshold measurement: sizes from MEMCPY_MIN_SIZE doubling up to the
+ * largest size used for each memory pair are copied with memcpy() and with
+ * mpfs_dma_memcpy(). */
+#define MEMCPY_MIN_SIZE             (64u)
+
 /* Turn on force ordering on for PDMA transactions*/
 #undef FORCE_ORDER
 
@@ -84,7 +115,7 @@ typedef struct
     uint32_t destination_address;
     uint32_t min_tranfer_size;
     uint32_t max_transfer_size;
-    uint32_t step_size;
+    uint32_t step_percent;
 } dma_benchmarking_params_t;
 
 /*
@@ -92,37 +123,43 @@ typedef struct
  */
 
 const dma_benchmarking_params_t pdma_benchmark_list[PDMA_BENCHMARKING_LIST_SIZE] = {
-    {L2_LIM0, L2_LIM1, MIN_TRANSFER_SIZE_BYTES, HALF_LIM, TRANSFER_STEP_SIZE},
-    {L2_LIM0, SCRATCHPAD0, MIN_TRANSFER_SIZE_BYTES, FULL_LIM, TRANSFER_STEP_SIZE},
-    {L2_LIM0, CACHED_DDR0, MIN_TRANSFER_SIZE_BYTES, FULL_LIM, TRANSFER_STEP_SIZE},
-    {L2_LIM0, NON_CACHED_DDR0, MIN_TRANSFER_SIZE_BYTES, FULL_LIM, TRANSFER_STEP_SIZE},
-    {SCRATCHPAD0, L2_LIM0, MIN_TRANSFER_SIZE_BYTES, FULL_LIM, TRANSFER_STEP_SIZE},
-    {SCRATCHPAD0, SCRATCHPAD1, MIN_TRANSFER_SIZE_BYTES, HALF_SCRATCHPAD, TRANSFER_STEP_SIZE},
-    {SCRATCHPAD0, CACHED_DDR0, MIN_TRANSFER_SIZE_BYTES, FULL_SCRATCHPAD, TRANSFER_STEP_SIZE},
-    {SCRATCHPAD0, NON_CACHED_DDR0, MIN_TRANSFER_SIZE_BYTES, FULL_SCRATCHPAD, TRANSFER_STEP_SIZE},
-    {CACHED_DDR0, L2_LIM0, MIN_TRANSFER_SIZE_BYTES, FULL_LIM, TRANSFER_STEP_SIZE},
-    {CACHED_DDR0, SCRATCHPAD0, MIN_TRANSFER_SIZE_BYTES, FULL_SCRATCHPAD, TRANSFER_STEP_SIZE},
+    {L2_LIM0, L2_LIM1, MIN_TRANSFER_SIZE_BYTES, HALF_LIM, TRANSFER_STEP_PERCENT},
+    {L2_LIM0, SCRATCHPAD0, MIN_TRANSFER_SIZE_BYTES, FULL_LIM, TRANSFER_STEP_PERCENT},
+    {L2_LIM0, CACHED_DDR0, MIN_TRANSFER_SIZE_BYTES, FULL_LIM, TRANSFER_STEP_PERCENT},
+    {L2_LIM0, NON_CACHED_DDR0, MIN_TRANSFER_SIZE_BYTES, FULL_LIM, TRANSFER_STEP_PERCENT},
+    {SCRATCHPAD0, L2_LIM0, MIN_TRANSFER_SIZE_BYTES, FULL_LIM, TRANSFER_STEP_PERCENT},
+    {SCRATCHPAD0, SCRATCHPAD1, MIN_TRANSFER_SIZE_BYTES, HALF_SCRATCHPAD, TRANSFER_STEP_PERCENT},
+    {SCRATCHPAD0, CACHED_DDR0, MIN_TRANSFER_SIZE_BYTES, FULL_SCRATCHPAD, TRANSFER_STEP_PERCENT},
+    {SCRATCHPAD0, NON_CACHED_DDR0, MIN_TRANSFER_SIZE_BYTES, FULL_SCRATCHPAD, TRANSFER_STEP_PERCENT},
+    {CACHED_DDR0, L2_LIM0, MIN_TRANSFER_SIZE_BYTES, FULL_LIM, TRANSFER_STEP_PERCENT},
+    {CACHED_DDR0, SCRATCHPAD0, MIN_TRANSFER_SIZE_BYTES, FULL_SCRATCHPAD, TRANSFER_STEP_PERCENT},
     {CACHED_DDR0,
      CACHED_DDR1,
      MIN_TRANSFER_SIZE_BYTES,
      MAX_TRANSFER_SIZE_BYTES,
-     TRANSFER_STEP_SIZE},
+     TRANSFER_STEP_PERCENT},
     {CACHED_DDR0,
      NON_CACHED_DDR0,
      MIN_TRANSFER_SIZE_BYTES,
      MAX_TRANSFER_SIZE_BYTES,
-     TRANSFER_STEP_SIZE},
-    {NON_CACHED_DDR0, L2_LIM0, MIN_TRANSFER_SIZE_BYTES, FULL_LIM, TRANSFER_STEP_SIZE},
-    {NON_CACHED_DDR0, SCRATCHPAD0, MIN_TRANSFER_SIZE_BYTES, FULL_SCRATCHPAD, TRANSFER_STEP_SIZE},
+     TRANSFER_STEP_PERCENT},
+    {NON_CACHED_DDR0, L2_LIM0, MIN_TRANSFER_SIZE_BYTES, FULL_LIM, TRANSFER_STEP_PERCENT},
+    {NON_CACHED_DDR0, SCRATCHPAD0, MIN_TRANSFER_SIZE_BYTES, FULL_SCRATCHPAD, TRANSFER_STEP_PERCENT},
     {NON_CACHED_DDR0,
      CACHED_DDR0,
      MIN_TRANSFER_SIZE_BYTES,
      MAX_TRANSFER_SIZE_BYTES,
-     TRANSFER_STEP_SIZE},
+     TRANSFER_STEP_PERCENT},
     {NON_CACHED_DDR0,
      NON_CACHED_DDR1,
      MIN_TRANSFER_SIZE_BYTES,
      MAX_TRANSFER_SIZE_BYTES,
-     TRANSFER_STEP_SIZE}};
+     TRANSFER_STEP_PERCENT}};
+
+/*
+ * Transfer sizes swept by the transaction size tuning mode, smallest first
+ */
+
+const uint32_t tuning_transfer_size_list[TUNING_TRANSFER_SIZE_COUNT] = {1024u, 16384u, 131072u};
 
 #endif /* PDMA_BENCHMARKING_CONFIG_H_ */
@@ -14,8 +14,14 @@
 #include "drivers/fpga_ip/CoreAXI4DMAController/core_axi4dmacontroller.h"
 #include "drivers/mss/mss_mmuart/mss_uart.h"
 #include "drivers/mss/mss_pdma/mss_pdma.h"
+#include "dma_bench/dma_bench_stats.h"
+#include "dma_bench/dma_bench_verify.h"
 #include "mpfs_hal/mss_hal.h"
 
+#if (BENCHMARK_RUNS > DMA_BENCH_MAX_RUNS)
+#error "BENCHMARK_RUNS must not be more than DMA_BENCH_MAX_RUNS"
+#endif
+
 #define BYTES_TO_MEGABITS_SCALE_FACTOR (125000.0)
 #define CHAR_TO_LONG_CONVERSION_BASE   (10u)
 
@@ -54,7 +60,13 @@ static const char pdma_options[] = "\r\n\t1: L2-Lim to L2-Lim\r\n"
                                    "\t15: Non Cached DDR to Cached DDR\r\n"
                                    "\t16: Non Cached DDR to Non Cached DDR\r\n"
                                    "\r\n"
-                                   "\ta: Run all benchmarks\r\n\r\n"
+                                   "\ta: Run all benchmarks\r\n"
+                                   "\tq: Run back to back small transfers, queued vs. "
+                                   "one at a time\r\n"
+                                   "\ts: Run largest transfers, striped across all "
+                                   "channels vs. one channel\r\n"
+                                   "\tt: Tune transaction sizes for every memory pair\r\n"
+                                   "\tm: Measure the mpfs_dma_memcpy() CPU threshold\r\n\r\n"
                                    "\tTo register a selection please press \'ENTER\'.\r\n\r\n";
 
 static const char invalid_selection_message[] = "\r\n\r\nInvalid option!\r\nPlease select one "
@@ -68,6 +80,25 @@ static const char table_header[] =
     " Size             Address          Address          Result           Rate\r\n"
     " (Bytes)                                                             (MegaBits/second)\r\n";
 
+static const char queued_table_header[] =
+    " Source           Destination      Test             One at a time    Queued\r\n"
+    "                                   Result           (MegaBits/sec)   (MegaBits/sec)\r\n";
+
+static const char striped_table_header[] =
+    " Data             Source           Destination      Test             One channel      Striped\r\n"
+    " Size             Address          Address          Result           (MegaBits/sec)   (MegaBits/sec)\r\n"
+    " (Bytes)\r\n";
+
+static const char tuning_table_header[] =
+    " Data             Source           Destination      Test             wsize/rsize      Best rate        Default rate\r\n"
+    " Size                                               Result                            (MegaBits/sec)   (MegaBits/sec)\r\n"
+    " (Bytes)\r\n";
+
+static const char memcpy_table_header[] =
+    " Data             Source           Destination      Test             memcpy()         mpfs_dma_memcpy()\r\n"
+    " Size                                               Result           (MegaBits/sec)   (MegaBits/sec)\r\n"
+    " (Bytes)\r\n";
+
 static const char greeting_message[] =
     "\r\n\r\n\r\n **** PolarFire SoC Platform DMA Benchmarking Application ****\r\n";
 
@@ -96,9 +127,11 @@ get_user_input(void)
                     (uint32_t)strtol(user_input, NULL, CHAR_TO_LONG_CONVERSION_BASE);
                 return selected_benchmark;
             }
-            else if ('a' == g_rx_buff[0u])
+            else if (('a' == g_rx_buff[0u]) || ('q' == g_rx_buff[0u]) ||
+                     ('s' == g_rx_buff[0u]) || ('t' == g_rx_buff[0u]) ||
+                     ('m' == g_rx_buff[0u]))
             {
-                return (uint32_t)'a';
+                return (uint32_t)g_rx_buff[0u];
             }
             else
             {
@@ -208,31 +241,26 @@ block_transfer_verify_data(uint32_t transfer_size,
                            uint8_t *source_address,
                            uint8_t *destination_address)
 {
-    volatile uint8_t *source = NULL;
-    volatile uint8_t *destination = NULL;
-    uint32_t index = 0u;
+    uint64_t offset = 0u;
 
-    for (index = 0; index < transfer_size; index++)
+    if (0u != dma_bench_verify(VERIFY_MODE,
+                               source_address,
+                               destination_address,
+                               transfer_size,
+                               &offset))
     {
-        source = (source_address + index);
-        destination = (destination_address + index);
-        /* Memory Fence Instruction */
-        mb();
-        if (*source != *destination)
-        {
 #ifdef DEBUG_DMA
-            uint8_t debug_message[100] = {0};
-
-            sprintf(debug_message,
-                    "\r\nError at address: 0x%-9x!"
-                    "\tExpected: %-6iRead: %-6i\r\n",
-                    destination,
-                    *destination,
-                    *source);
-            MSS_UART_polled_tx_string(uart1, debug_message);
+        uint8_t debug_message[100] = {0};
+
+        sprintf(debug_message,
+                "\r\nError at address: 0x%-9x!"
+                "\tExpected: %-6iRead: %-6i\r\n",
+                (destination_address + offset),
+                source_address[offset],
+                destination_address[offset]);
+        MSS_UART_polled_tx_string(uart1, debug_message);
 #endif
-            return TRANSFER_DATA_MISMATCH;
-        }
+        return TRANSFER_DATA_MISMATCH;
     }
     return TRANSFER_DATA_MATCH;
 }
@@ -249,6 +277,636 @@ calculate_rate(uint64_t clock_cycles, uint32_t transfer_size)
     return transfer_rate;
 }
 
+/*
+ * Returns the name of the memory at address, or its address written into
+ * buffer if it is not one of the benchmarked memories.
+ */
+static const char *
+memory_name(uint32_t address, char *buffer)
+{
+    switch (address)
+    {
+        case L2_LIM0:
+        case L2_LIM1:
+            return memory_descriptors[0];
+
+        case SCRATCHPAD0:
+        case SCRATCHPAD1:
+            return memory_descriptors[1];
+
+        case CACHED_DDR0:
+        case CACHED_DDR1:
+            return memory_descriptors[2];
+
+        case NON_CACHED_DDR0:
+        case NON_CACHED_DDR1:
+            return memory_descriptors[3];
+
+        default:
+            sprintf(buffer, "0x%lx", (uint64_t)address);
+            return buffer;
+    }
+}
+
+static void
+print_memory_cell(uint32_t address)
+{
+    char results_cell[21] = {0};
+
+    print_table_cell((uint8_t *)memory_name(address, results_cell));
+}
+
+static volatile uint32_t queued_transfer_errors = 0u;
+
+static void
+pdma_queue_done(mss_pdma_channel_id_t channel_id, mss_pdma_error_id_t status, void *user_data)
+{
+    (void)channel_id;
+    (void)user_data;
+
+    if (MSS_PDMA_OK != status)
+    {
+        queued_transfer_errors++;
+    }
+}
+
+/*
+ * Copy QUEUED_TRANSFER_COUNT blocks of QUEUED_TRANSFER_SIZE bytes, first one at
+ * a time, waiting for each transfer to complete before setting up the next,
+ * then through the channel 0 request queue. Returns the cycles taken by each.
+ */
+static uint32_t
+queued_transfer_run(const dma_benchmarking_params_t *benchmark,
+                    uint64_t *single_cycles,
+                    uint64_t *queued_cycles)
+{
+    mss_pdma_channel_config_t pdma_config_ch;
+    uint64_t start_mcycle;
+    uint32_t total_size = QUEUED_TRANSFER_COUNT * QUEUED_TRANSFER_SIZE;
+    uint32_t offset;
+    uint32_t index;
+
+    for (index = 0u; index < total_size; index++)
+    {
+        *((uint8_t *)benchmark->source_address + index) = (index & 0xFFu);
+    }
+    dma_bench_verify_source_filled();
+
+    /* One at a time */
+    clear_64_mem((uint64_t *)benchmark->destination_address,
+                 (uint64_t *)(benchmark->destination_address + total_size));
+
+    start_mcycle = readmcycle();
+    for (offset = 0u; offset < total_size; offset += QUEUED_TRANSFER_SIZE)
+    {
+        pdma_transfer_status = PDMA_TRANSFER_INCOMPLETE;
+        configure_pdma(&pdma_config_ch,
+                       (uint64_t)(benchmark->source_address + offset),
+                       (uint64_t)(benchmark->destination_address + offset),
+                       QUEUED_TRANSFER_SIZE);
+        (void)MSS_PDMA_setup_transfer(MSS_PDMA_CHANNEL_0, &pdma_config_ch, pdma_isr);
+        (void)MSS_PDMA_start_transfer(MSS_PDMA_CHANNEL_0);
+        while (PDMA_TRANSFER_INCOMPLETE == pdma_transfer_status)
+        {
+            ;
+        }
+    }
+    *single_cycles = readmcycle() - start_mcycle;
+
+    if (TRANSFER_DATA_MISMATCH ==
+        block_transfer_verify_data(total_size,
+                                   (uint8_t *)benchmark->source_address,
+                                   (uint8_t *)benchmark->destination_address))
+    {
+        return TRANSFER_DATA_MISMATCH;
+    }
+
+    /* Queued */
+    clear_64_mem((uint64_t *)benchmark->destination_address,
+                 (uint64_t *)(benchmark->destination_address + total_size));
+
+#ifdef FORCE_ORDER
+    (void)MSS_PDMA_queue_init(MSS_PDMA_CHANNEL_0, QUEUED_TRANSFER_DEPTH, 1u);
+#else
+    (void)MSS_PDMA_queue_init(MSS_PDMA_CHANNEL_0, QUEUED_TRANSFER_DEPTH, 0u);
+#endif
+
+    start_mcycle = readmcycle();
+    for (offset = 0u; offset < total_size; offset += QUEUED_TRANSFER_SIZE)
+    {
+        while (MSS_PDMA_ERROR_QUEUE_FULL ==
+               MSS_PDMA_queue_submit(MSS_PDMA_CHANNEL_0,
+                                     (uint64_t)(benchmark->destination_address + offset),
+                                     (uint64_t)(benchmark->source_address + offset),
+                                     QUEUED_TRANSFER_SIZE,
+                                     pdma_queue_done,
+                                     NULL))
+        {
+            ;
+        }
+    }
+
+    while (0u != MSS_PDMA_queue_get_pending(MSS_PDMA_CHANNEL_0))
+    {
+        ;
+    }
+    *queued_cycles = readmcycle() - start_mcycle;
+
+    (void)MSS_PDMA_queue_release(MSS_PDMA_CHANNEL_0);
+
+    return block_transfer_verify_data(total_size,
+                                      (uint8_t *)benchmark->source_address,
+                                      (uint8_t *)benchmark->destination_address);
+}
+
+static void
+queued_transfer_benchmark(void)
+{
+    uint64_t single_cycles = 0u;
+    uint64_t queued_cycles = 0u;
+    uint32_t total_size = QUEUED_TRANSFER_COUNT * QUEUED_TRANSFER_SIZE;
+    uint32_t result;
+    uint32_t index;
+    char results_cell[21] = {0};
+
+    MSS_UART_polled_tx_string(uart1, divider);
+    MSS_UART_polled_tx_string(uart1, queued_table_header);
+    MSS_UART_polled_tx_string(uart1, divider);
+
+    for (index = 0u; index < PDMA_BENCHMARKING_LIST_SIZE; index++)
+    {
+        result = queued_transfer_run(&pdma_benchmark_list[index], &single_cycles, &queued_cycles);
+
+        print_memory_cell(pdma_benchmark_list[index].source_address);
+        print_memory_cell(pdma_benchmark_list[index].destination_address);
+
+        if (TRANSFER_DATA_MISMATCH == result)
+        {
+            benchmark_error_count++;
+            print_table_cell("Fail");
+        }
+        else
+        {
+            print_table_cell("Pass");
+        }
+
+        sprintf(results_cell, "%ld", (uint64_t)calculate_rate(single_cycles, total_size));
+        print_table_cell(results_cell);
+        sprintf(results_cell, "%ld", (uint64_t)calculate_rate(queued_cycles, total_size));
+        print_table_cell(results_cell);
+        MSS_UART_polled_tx_string(uart1, "\r\n");
+    }
+
+    pdma_error_interrupt_count += queued_transfer_errors;
+    queued_transfer_errors = 0u;
+    pdma_print_error_count();
+}
+
+/*
+ * Copy the largest block used for a memory pair, first on channel 0 alone and
+ * then striped across all four channels. Returns the cycles taken by each.
+ */
+static uint32_t
+striped_transfer_run(const dma_benchmarking_params_t *benchmark,
+                     uint64_t *single_cycles,
+                     uint64_t *striped_cycles)
+{
+    mss_pdma_channel_config_t pdma_config_ch;
+    mss_pdma_stripe_t stripe;
+    uint64_t start_mcycle;
+    uint32_t transfer_size = benchmark->max_transfer_size;
+    uint32_t index;
+
+    for (index = 0u; index < transfer_size; index++)
+    {
+        *((uint8_t *)benchmark->source_address + index) = (index & 0xFFu);
+    }
+    dma_bench_verify_source_filled();
+
+    /* One channel */
+    clear_64_mem((uint64_t *)benchmark->destination_address,
+                 (uint64_t *)(benchmark->destination_address + transfer_size));
+
+    pdma_transfer_status = PDMA_TRANSFER_INCOMPLETE;
+    configure_pdma(&pdma_config_ch,
+                   (uint64_t)benchmark->source_address,
+                   (uint64_t)benchmark->destination_address,
+                   transfer_size);
+    (void)MSS_PDMA_setup_transfer(MSS_PDMA_CHANNEL_0, &pdma_config_ch, pdma_isr);
+
+    start_mcycle = readmcycle();
+    (void)MSS_PDMA_start_transfer(MSS_PDMA_CHANNEL_0);
+    while (PDMA_TRANSFER_INCOMPLETE == pdma_transfer_status)
+    {
+        ;
+    }
+    *single_cycles = pdma_end_mcycle - start_mcycle;
+
+    if (TRANSFER_DATA_MISMATCH ==
+        block_transfer_verify_data(transfer_size,
+                                   (uint8_t *)benchmark->source_address,
+                                   (uint8_t *)benchmark->destination_address))
+    {
+        return TRANSFER_DATA_MISMATCH;
+    }
+
+    /* Striped */
+    clear_64_mem((uint64_t *)benchmark->destination_address,
+                 (uint64_t *)(benchmark->destination_address + transfer_size));
+
+    start_mcycle = readmcycle();
+    if (MSS_PDMA_OK != MSS_PDMA_memcpy_striped(&stripe,
+                                               (uint64_t)benchmark->destination_address,
+                                               (uint64_t)benchmark->source_address,
+                                               transfer_size,
+                                               NULL,
+                                               NULL))
+    {
+        return TRANSFER_DATA_MISMATCH;
+    }
+
+    while (0u != stripe.remaining)
+    {
+        ;
+    }
+    *striped_cycles = readmcycle() - start_mcycle;
+
+    if (MSS_PDMA_OK != stripe.status)
+    {
+        pdma_error_interrupt_count++;
+    }
+
+    return block_transfer_verify_data(transfer_size,
+                                      (uint8_t *)benchmark->source_address,
+                                      (uint8_t *)benchmark->destination_address);
+}
+
+static void
+striped_transfer_benchmark(void)
+{
+    uint64_t single_cycles = 0u;
+    uint64_t striped_cycles = 0u;
+    uint32_t result;
+    uint32_t index;
+    char results_cell[21] = {0};
+
+    MSS_UART_polled_tx_string(uart1, divider);
+    MSS_UART_polled_tx_string(uart1, striped_table_header);
+    MSS_UART_polled_tx_string(uart1, divider);
+
+    for (index = 0u; index < PDMA_BENCHMARKING_LIST_SIZE; index++)
+    {
+        result = striped_transfer_run(&pdma_benchmark_list[index], &single_cycles, &striped_cycles);
+
+        sprintf(results_cell, "%d", pdma_benchmark_list[index].max_transfer_size);
+        print_table_cell(results_cell);
+        print_memory_cell(pdma_benchmark_list[index].source_address);
+        print_memory_cell(pdma_benchmark_list[index].destination_address);
+
+        if (TRANSFER_DATA_MISMATCH == result)
+        {
+            benchmark_error_count++;
+            print_table_cell("Fail");
+        }
+        else
+        {
+            print_table_cell("Pass");
+        }
+
+        sprintf(results_cell,
+                "%ld",
+                (uint64_t)calculate_rate(single_cycles,
+                                         pdma_benchmark_list[index].max_transfer_size));
+        print_table_cell(results_cell);
+        sprintf(results_cell,
+                "%ld",
+                (uint64_t)calculate_rate(striped_cycles,
+                                         pdma_benchmark_list[index].max_transfer_size));
+        print_table_cell(results_cell);
+        MSS_UART_polled_tx_string(uart1, "\r\n");
+    }
+
+    pdma_print_error_count();
+}
+
+/*
+ * Time one copy of transfer_size bytes with memcpy() or mpfs_dma_memcpy(),
+ * taking the median of BENCHMARK_RUNS runs.
+ */
+static uint64_t
+memcpy_transfer_run(const dma_benchmarking_params_t *benchmark,
+                    uint32_t transfer_size,
+                    bool use_dma,
+                    uint32_t *result)
+{
+    uint64_t run_cycles[BENCHMARK_RUNS] = {0u};
+    dma_bench_stats_t stats;
+    uint64_t start_mcycle;
+    uint32_t run;
+
+    for (run = 0u; run < BENCHMARK_RUNS; run++)
+    {
+        clear_64_mem((uint64_t *)benchmark->destination_address,
+                     (uint64_t *)(benchmark->destination_address + transfer_size));
+        mb();
+
+        start_mcycle = readmcycle();
+        if (use_dma)
+        {
+            (void)mpfs_dma_memcpy((void *)(uintptr_t)benchmark->destination_address,
+                                  (const void *)(uintptr_t)benchmark->source_address,
+                                  transfer_size);
+        }
+        else
+        {
+            (void)memcpy((void *)(uintptr_t)benchmark->destination_address,
+                         (const void *)(uintptr_t)benchmark->source_address,
+                         transfer_size);
+            mb();
+        }
+        run_cycles[run] = readmcycle() - start_mcycle;
+    }
+
+    *result = block_transfer_verify_data(transfer_size,
+                                         (uint8_t *)benchmark->source_address,
+                                         (uint8_t *)benchmark->destination_address);
+
+    dma_bench_stats(run_cycles, BENCHMARK_RUNS, &stats);
+    return stats.median;
+}
+
+/*
+ * For every memory pair, find the smallest size from which mpfs_dma_memcpy()
+ * is faster than memcpy() at every larger size. The largest of these is given
+ * to mpfs_dma_set_threshold() and printed as a define for mss_sw_config.h.
+ */
+static void
+memcpy_threshold_benchmark(void)
+{
+    uint64_t cpu_cycles;
+    uint64_t dma_cycles = 0u;
+    uint32_t result;
+    uint32_t crossover;
+    uint32_t threshold = 0u;
+    uint32_t transfer_size;
+    uint32_t index;
+    uint32_t offset;
+    char results_cell[21] = {0};
+    char message[80] = {0};
+
+    /* Every copy goes to the PDMA while measuring */
+    mpfs_dma_set_threshold(0u);
+
+    MSS_UART_polled_tx_string(uart1, divider);
+    MSS_UART_polled_tx_string(uart1, memcpy_table_header);
+    MSS_UART_polled_tx_string(uart1, divider);
+
+    for (index = 0u; index < PDMA_BENCHMARKING_LIST_SIZE; index++)
+    {
+        const dma_benchmarking_params_t *benchmark = &pdma_benchmark_list[index];
+
+        for (offset = 0u; offset < benchmark->max_transfer_size; offset++)
+        {
+            *((uint8_t *)benchmark->source_address + offset) = (offset & 0xFFu);
+        }
+        dma_bench_verify_source_filled();
+
+        crossover = 0u;
+        for (transfer_size = MEMCPY_MIN_SIZE; transfer_size <= benchmark->max_transfer_size;
+             transfer_size *= 2u)
+        {
+            cpu_cycles = memcpy_transfer_run(benchmark, transfer_size, false, &result);
+            if (TRANSFER_DATA_MATCH == result)
+            {
+                dma_cycles = memcpy_transfer_run(benchmark, transfer_size, true, &result);
+            }
+
+            sprintf(results_cell, "%d", transfer_size);
+            print_table_cell(results_cell);
+            print_memory_cell(benchmark->source_address);
+            print_memory_cell(benchmark->destination_address);
+
+            if (TRANSFER_DATA_MISMATCH == result)
+            {
+                benchmark_error_count++;
+                print_table_cell("Fail");
+                MSS_UART_polled_tx_string(uart1, "\r\n");
+                continue;
+            }
+            print_table_cell("Pass");
+
+            sprintf(results_cell, "%ld", (uint64_t)calculate_rate(cpu_cycles, transfer_size));
+            print_table_cell(results_cell);
+            sprintf(results_cell, "%ld", (uint64_t)calculate_rate(dma_cycles, transfer_size));
+            print_table_cell(results_cell);
+            MSS_UART_polled_tx_string(uart1, "\r\n");
+
+            /* The crossover is just above the largest size the CPU wins */
+            if (cpu_cycles <= dma_cycles)
+            {
+                crossover = transfer_size * 2u;
+            }
+        }
+
+        if (crossover < MEMCPY_MIN_SIZE)
+        {
+            crossover = MEMCPY_MIN_SIZE;
+        }
+        sprintf(message, " Crossover: %d bytes\r\n", crossover);
+        MSS_UART_polled_tx_string(uart1, message);
+
+        if (crossover > threshold)
+        {
+            threshold = crossover;
+        }
+    }
+
+    mpfs_dma_set_threshold(threshold);
+
+    MSS_UART_polled_tx_string(uart1, divider);
+    sprintf(message, "#define MPFS_DMA_MEMCPY_THRESHOLD %dU\r\n", threshold);
+    MSS_UART_polled_tx_string(uart1, message);
+
+    pdma_print_error_count();
+}
+
+/* Routes found by the last tuning run, largest transfer size first for each
+ * memory pair. */
+static mss_pdma_route_t
+    tuned_routes[PDMA_BENCHMARKING_LIST_SIZE * TUNING_TRANSFER_SIZE_COUNT];
+
+/*
+ * Time one channel 0 transfer with the given transaction sizes.
+ */
+static uint64_t
+tuning_transfer_run(const dma_benchmarking_params_t *benchmark,
+                    uint32_t transfer_size,
+                    uint8_t write_size,
+                    uint8_t read_size)
+{
+    mss_pdma_channel_config_t pdma_config_ch;
+    uint64_t start_mcycle;
+
+    (void)MSS_PDMA_set_transaction_size(MSS_PDMA_CHANNEL_0, write_size, read_size);
+
+    pdma_transfer_status = PDMA_TRANSFER_INCOMPLETE;
+    configure_pdma(&pdma_config_ch,
+                   (uint64_t)benchmark->source_address,
+                   (uint64_t)benchmark->destination_address,
+                   transfer_size);
+    (void)MSS_PDMA_setup_transfer(MSS_PDMA_CHANNEL_0, &pdma_config_ch, pdma_isr);
+
+    start_mcycle = readmcycle();
+    (void)MSS_PDMA_start_transfer(MSS_PDMA_CHANNEL_0);
+    while (PDMA_TRANSFER_INCOMPLETE == pdma_transfer_status)
+    {
+        ;
+    }
+
+    return pdma_end_mcycle - start_mcycle;
+}
+
+/*
+ * Sweep write size x read size x transfer size for every memory pair, print
+ * the fastest setting of each, then hand the results to the driver as its
+ * route table so that later benchmarks use them.
+ */
+static void
+transaction_size_tuning_benchmark(void)
+{
+    const dma_benchmarking_params_t *benchmark;
+    uint64_t cycles;
+    uint64_t best_cycles;
+    uint64_t default_cycles;
+    uint32_t route_count = 0u;
+    uint32_t transfer_size;
+    uint32_t result;
+    uint32_t index;
+    uint32_t size_index;
+    uint32_t byte_index;
+    uint8_t write_size;
+    uint8_t read_size;
+    uint8_t best_write_size;
+    uint8_t best_read_size;
+    char results_cell[21] = {0};
+    char route_message[120] = {0};
+
+    /* Measure the channel settings alone. */
+    (void)MSS_PDMA_set_route_table(NULL, 0u);
+
+    MSS_UART_polled_tx_string(uart1, divider);
+    MSS_UART_polled_tx_string(uart1, tuning_table_header);
+    MSS_UART_polled_tx_string(uart1, divider);
+
+    for (index = 0u; index < PDMA_BENCHMARKING_LIST_SIZE; index++)
+    {
+        benchmark = &pdma_benchmark_list[index];
+
+        for (byte_index = 0u; byte_index < benchmark->max_transfer_size; byte_index++)
+        {
+            *((uint8_t *)benchmark->source_address + byte_index) = (byte_index & 0xFFu);
+        }
+        dma_bench_verify_source_filled();
+
+        /* Largest size first, the order the driver searches the routes in. */
+        for (size_index = TUNING_TRANSFER_SIZE_COUNT; size_index > 0u; size_index--)
+        {
+            transfer_size = tuning_transfer_size_list[size_index - 1u];
+            if (transfer_size > benchmark->max_transfer_size)
+            {
+                continue;
+            }
+
+            default_cycles = tuning_transfer_run(benchmark, transfer_size, 0x0Fu, 0x0Fu);
+            best_cycles = default_cycles;
+            best_write_size = 0x0Fu;
+            best_read_size = 0x0Fu;
+
+            for (write_size = TUNING_MIN_SIZE_LOG2; write_size <= TUNING_MAX_SIZE_LOG2;
+                 write_size++)
+            {
+                for (read_size = TUNING_MIN_SIZE_LOG2; read_size <= TUNING_MAX_SIZE_LOG2;
+                     read_size++)
+                {
+                    cycles = tuning_transfer_run(benchmark, transfer_size, write_size, read_size);
+                    if (cycles < best_cycles)
+                    {
+                        best_cycles = cycles;
+                        best_write_size = write_size;
+                        best_read_size = read_size;
+                    }
+                }
+            }
+
+            /* Repeat the best setting into a clean destination to check it. */
+            clear_64_mem((uint64_t *)benchmark->destination_address,
+                         (uint64_t *)(benchmark->destination_address + transfer_size));
+            (void)tuning_transfer_run(benchmark, transfer_size, best_write_size, best_read_size);
+            result = block_transfer_verify_data(transfer_size,
+                                                (uint8_t *)benchmark->source_address,
+                                                (uint8_t *)benchmark->destination_address);
+
+            sprintf(results_cell, "%d", transfer_size);
+            print_table_cell(results_cell);
+            print_memory_cell(benchmark->source_address);
+            print_memory_cell(benchmark->destination_address);
+
+            if (TRANSFER_DATA_MISMATCH == result)
+            {
+                benchmark_error_count++;
+                print_table_cell("Fail");
+            }
+            else
+            {
+                print_table_cell("Pass");
+            }
+
+            sprintf(results_cell, "%d/%d", best_write_size, best_read_size);
+            print_table_cell(results_cell);
+            sprintf(results_cell, "%ld", (uint64_t)calculate_rate(best_cycles, transfer_size));
+            print_table_cell(results_cell);
+            sprintf(results_cell, "%ld", (uint64_t)calculate_rate(default_cycles, transfer_size));
+            print_table_cell(results_cell);
+            MSS_UART_polled_tx_string(uart1, "\r\n");
+
+            tuned_routes[route_count].src_addr = benchmark->source_address;
+            tuned_routes[route_count].src_size = benchmark->max_transfer_size;
+            tuned_routes[route_count].dest_addr = benchmark->destination_address;
+            tuned_routes[route_count].dest_size = benchmark->max_transfer_size;
+            tuned_routes[route_count].min_bytes = transfer_size;
+            tuned_routes[route_count].write_size = best_write_size;
+            tuned_routes[route_count].read_size = best_read_size;
+            route_count++;
+        }
+    }
+
+    (void)MSS_PDMA_set_transaction_size(MSS_PDMA_CHANNEL_0, 0x0Fu, 0x0Fu);
+
+    /* Print the table in a form which can be pasted into an application. */
+    MSS_UART_polled_tx_string(uart1, "\r\nstatic const mss_pdma_route_t pdma_routes[] =\r\n{\r\n");
+    for (index = 0u; index < route_count; index++)
+    {
+        sprintf(route_message,
+                "    {0x%lxu, 0x%lxu, 0x%lxu, 0x%lxu, %luu, %uu, %uu},\r\n",
+                tuned_routes[index].src_addr,
+                tuned_routes[index].src_size,
+                tuned_routes[index].dest_addr,
+                tuned_routes[index].dest_size,
+                tuned_routes[index].min_bytes,
+                tuned_routes[index].write_size,
+                tuned_routes[index].read_size);
+        MSS_UART_polled_tx_string(uart1, route_message);
+    }
+    MSS_UART_polled_tx_string(uart1, "};\r\n");
+
+    (void)MSS_PDMA_set_route_table(tuned_routes, route_count);
+    MSS_UART_polled_tx_string(uart1,
+                              "\r\nThe tuned transaction sizes are now used by the other "
+                              "benchmarks.\r\n");
+
+    pdma_print_error_count();
+}
+
 void
 u54_1(void)
 {
@@ -280,6 +938,10 @@ u54_1(void)
 
     uint64_t benchmark_start_mcycle = 0u;
 
+    uint32_t current_run = 0u;
+    uint64_t run_cycles[BENCHMARK_RUNS] = {0u};
+    dma_bench_stats_t run_stats;
+
     uint32_t pdma_transfer_data_integrity_check = TRANSFER_DATA_MISMATCH;
 
     mss_pdma_channel_config_t pdma_config_ch;
@@ -297,10 +959,23 @@ u54_1(void)
 
     PLIC_SetPriority(DMA_CH0_DONE_IRQn, 1u);
     PLIC_SetPriority(DMA_CH0_ERR_IRQn, 1u);
-
-    /* Enable PDMA Interrupts. */
+    PLIC_SetPriority(DMA_CH1_DONE_IRQn, 1u);
+    PLIC_SetPriority(DMA_CH1_ERR_IRQn, 1u);
+    PLIC_SetPriority(DMA_CH2_DONE_IRQn, 1u);
+    PLIC_SetPriority(DMA_CH2_ERR_IRQn, 1u);
+    PLIC_SetPriority(DMA_CH3_DONE_IRQn, 1u);
+    PLIC_SetPriority(DMA_CH3_ERR_IRQn, 1u);
+
+    /* Enable PDMA Interrupts. Channels 1 to 3 are only used by the striped
+     * transfer benchmark. */
     PLIC_EnableIRQ(DMA_CH0_DONE_IRQn);
     PLIC_EnableIRQ(DMA_CH0_ERR_IRQn);
+    PLIC_EnableIRQ(DMA_CH1_DONE_IRQn);
+    PLIC_EnableIRQ(DMA_CH1_ERR_IRQn);
+    PLIC_EnableIRQ(DMA_CH2_DONE_IRQn);
+    PLIC_EnableIRQ(DMA_CH2_ERR_IRQn);
+    PLIC_EnableIRQ(DMA_CH3_DONE_IRQn);
+    PLIC_EnableIRQ(DMA_CH3_ERR_IRQn);
 
     /* If the application is being debugged from LIM.
      * The HAL will not clear LIM memory, as to avoid clearing the memory the
@@ -327,7 +1002,8 @@ u54_1(void)
                 while (1u)
                 {
                     pdma_choice = get_user_input();
-                    if ((pdma_choice == 'a') ||
+                    if ((pdma_choice == 'a') || (pdma_choice == 'q') || (pdma_choice == 's') ||
+                        (pdma_choice == 't') || (pdma_choice == 'm') ||
                         ((pdma_choice > 0) && (pdma_choice <= PDMA_BENCHMARKING_LIST_SIZE)))
                     {
                         break;
@@ -336,6 +1012,38 @@ u54_1(void)
                     MSS_UART_polled_tx_string(uart1, pdma_options);
                 }
 
+                if ('q' == pdma_choice)
+                {
+                    MSS_UART_polled_tx_string(uart1,
+                                              "\r\n\r\nRunning queued transfer benchmark.\r\n\r\n");
+                    queued_transfer_benchmark();
+                    break;
+                }
+
+                if ('s' == pdma_choice)
+                {
+                    MSS_UART_polled_tx_string(uart1,
+                                              "\r\n\r\nRunning striped transfer benchmark.\r\n\r\n");
+                    striped_transfer_benchmark();
+                    break;
+                }
+
+                if ('t' == pdma_choice)
+                {
+                    MSS_UART_polled_tx_string(uart1,
+                                              "\r\n\r\nRunning transaction size tuning.\r\n\r\n");
+                    transaction_size_tuning_benchmark();
+                    break;
+                }
+
+                if ('m' == pdma_choice)
+                {
+                    MSS_UART_polled_tx_string(uart1,
+                                              "\r\n\r\nMeasuring the memcpy threshold.\r\n\r\n");
+                    memcpy_threshold_benchmark();
+                    break;
+                }
+
                 if ('a' == pdma_choice)
                 {
                     MSS_UART_polled_tx_string(uart1, "\r\n\r\nRunning all benchmarks.\r\n\r\n");
@@ -350,10 +1058,15 @@ u54_1(void)
                 }
 
                 current_transfer_size = pdma_benchmark_list[pdma_benchmark_index].min_tranfer_size;
+                current_run = 0u;
 
+#ifdef CSV_OUTPUT
+                dma_bench_print_config(uart1, "pdma", BENCHMARK_RUNS);
+#else
                 MSS_UART_polled_tx_string(uart1, divider);
                 MSS_UART_polled_tx_string(uart1, table_header);
                 MSS_UART_polled_tx_string(uart1, divider);
+#endif
 
                 transfer_state = TRANSFER_SETUP;
                 break;
@@ -384,6 +1097,7 @@ u54_1(void)
                             *((uint8_t *)pdma_benchmark_list[pdma_benchmark_index].source_address +
                               index) = (index & 0xFFu);
                         }
+                        dma_bench_verify_source_filled();
 
                         configure_pdma(
                             &pdma_config_ch,
@@ -463,105 +1177,54 @@ u54_1(void)
                 }
                 else
                 {
-                    /* Calculating the time (mcycles) */
-                    double pdma_transfer_rate;
+                    /* Repeat the transfer until every run has been timed. */
+                    run_cycles[current_run] = pdma_end_mcycle - benchmark_start_mcycle;
+                    current_run++;
+                    transfer_state = TRANSFER_SETUP;
+
+                    if (current_run < BENCHMARK_RUNS)
+                    {
+                        break;
+                    }
 
-                    pdma_transfer_rate = calculate_rate((pdma_end_mcycle - benchmark_start_mcycle),
-                                                        current_transfer_size);
+                    dma_bench_stats(run_cycles, BENCHMARK_RUNS, &run_stats);
+                    current_run = 0u;
 
                     /* Printing the results */
                     char results_cell[21] = {0};
 
+#ifdef CSV_OUTPUT
+                    char destination_cell[21] = {0};
+
+                    dma_bench_print_result(
+                        uart1,
+                        "pdma",
+                        memory_name(pdma_benchmark_list[pdma_benchmark_index].source_address,
+                                    results_cell),
+                        memory_name(pdma_benchmark_list[pdma_benchmark_index].destination_address,
+                                    destination_cell),
+                        current_transfer_size,
+                        &run_stats);
+#else
                     sprintf(results_cell, "%d", current_transfer_size);
                     print_table_cell(results_cell);
 
-                    /* Source Address*/
-                    switch (pdma_benchmark_list[pdma_benchmark_index].source_address)
-                    {
-                        case L2_LIM0:
-                            print_table_cell(memory_descriptors[0]);
-                            break;
+                    print_memory_cell(pdma_benchmark_list[pdma_benchmark_index].source_address);
+                    print_memory_cell(pdma_benchmark_list[pdma_benchmark_index].destination_address);
 
-                        case SCRATCHPAD0:
-                            print_table_cell(memory_descriptors[1]);
-                            break;
+                    print_table_cell("Pass");
 
-                        case CACHED_DDR0:
-                            print_table_cell(memory_descriptors[2]);
-                            break;
-
-                        case NON_CACHED_DDR0:
-                            print_table_cell(memory_descriptors[3]);
-                            break;
-
-                        default:
-                            sprintf(
-                                results_cell,
-                                "0x%lx",
-                                (uint64_t)pdma_benchmark_list[pdma_benchmark_index].source_address);
-                            print_table_cell(results_cell);
-                            break;
-                    }
-
-                    /* Destination Address*/
-                    switch (pdma_benchmark_list[pdma_benchmark_index].destination_address)
-                    {
-                        case L2_LIM0:
-                            print_table_cell(memory_descriptors[0]);
-                            break;
-
-                        case L2_LIM1:
-                            print_table_cell(memory_descriptors[0]);
-                            break;
-
-                        case SCRATCHPAD0:
-                            print_table_cell(memory_descriptors[1]);
-                            break;
-
-                        case SCRATCHPAD1:
-                            print_table_cell(memory_descriptors[1]);
-                            break;
-
-                        case CACHED_DDR0:
-                            print_table_cell(memory_descriptors[2]);
-                            break;
-
-                        case CACHED_DDR1:
-                            print_table_cell(memory_descriptors[2]);
-                            break;
-
-                        case NON_CACHED_DDR0:
-                            print_table_cell(memory_descriptors[3]);
-                            break;
-
-                        case NON_CACHED_DDR1:
-                            print_table_cell(memory_descriptors[3]);
-                            break;
-
-                        default:
-                            sprintf(results_cell,
-                                    "0x%lx",
-                                    (uint64_t)pdma_benchmark_list[pdma_benchmark_index]
-                                        .destination_address);
-                            print_table_cell(results_cell);
-                            break;
-                    }
-
-                    if (TRANSFER_DATA_MISMATCH == pdma_transfer_data_integrity_check)
-                    {
-                        print_table_cell("Fail");
-                    }
-                    else
-                    {
-                        print_table_cell("Pass");
-                    }
-
-                    sprintf(results_cell, "%ld", (uint64_t)pdma_transfer_rate);
+                    /* Rate of the median run */
+                    sprintf(results_cell,
+                            "%ld",
+                            dma_bench_rate(run_stats.median, current_transfer_size));
                     print_table_cell(results_cell);
                     MSS_UART_polled_tx_string(uart1, "\r\n");
+#endif
 
-                    current_transfer_size += pdma_benchmark_list[pdma_benchmark_index].step_size;
-                    transfer_state = TRANSFER_SETUP;
+                    current_transfer_size =
+                        dma_bench_next_size(current_transfer_size,
+                                            pdma_benchmark_list[pdma_benchmark_index].step_percent);
                     break;
                 }
 
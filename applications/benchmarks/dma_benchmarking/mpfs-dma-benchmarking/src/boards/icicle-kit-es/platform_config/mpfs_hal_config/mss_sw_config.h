@@ -153,6 +153,12 @@
 #define MPFS_HAL_CLEAR_MEMORY  1
 #endif
 
+/*
+ * PDMA channels the mpfs_dma_memcpy() service may use, see mss_dma_memcpy.h.
+ * The memcpy threshold benchmark measures the service on channel 3.
+ */
+#define MPFS_DMA_MEMCPY_CHANNELS    0x08U
+
 /*
  * Comment out the lines to disable the corresponding hardware support not required
  * in your application.
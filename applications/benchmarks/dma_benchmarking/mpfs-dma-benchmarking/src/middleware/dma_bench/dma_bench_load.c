@@ -0,0 +1,232 @@
+/*******************************************************************************
+ * Copyright 2023 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * CPU memory load patterns run on the U54 harts while the DMA benchmarks run.
+ */
+
+#include "mpfs_hal/mss_hal.h"
+#include "dma_bench_load.h"
+
+#define WORDS_PER_LINE (DMA_BENCH_LOAD_LINE_SIZE / sizeof(uint64_t))
+
+/* Shared by U54_1, which controls the loads, and the hart running a load. */
+typedef struct
+{
+    dma_bench_load_t load;
+    volatile uint32_t run;      /* set by U54_1 to start the load, cleared to stop it */
+    volatile uint32_t running;  /* set by the load hart while the load runs */
+    volatile uint64_t accesses; /* accesses made by the last load */
+    volatile uint64_t cycles;   /* load hart clock cycles taken by the last load */
+} dma_bench_load_slot_t;
+
+/* Indexed by hart id - 1 */
+static dma_bench_load_slot_t g_load_slots[DMA_BENCH_LOAD_HARTS];
+
+/*
+ * xorshift64, only used to shuffle the pointer chase so that runs repeat.
+ */
+static uint64_t
+next_random(uint64_t *state)
+{
+    uint64_t x = *state;
+
+    x ^= x << 13u;
+    x ^= x >> 7u;
+    x ^= x << 17u;
+    *state = x;
+
+    return x;
+}
+
+void
+dma_bench_load_prepare(const dma_bench_load_t *load)
+{
+    volatile uint64_t *node = (volatile uint64_t *)(uintptr_t)load->base;
+    uint64_t lines = load->size / DMA_BENCH_LOAD_LINE_SIZE;
+    uint64_t random_state = 0x9E3779B97F4A7C15ull;
+    uint64_t line;
+    uint64_t other;
+    uint64_t swap;
+
+    if ((DMA_BENCH_LOAD_POINTER_CHASE != load->pattern) || (lines < 2u))
+    {
+        return;
+    }
+
+    /*
+     * Sattolo's shuffle of the line numbers, held in the first word of each
+     * line, gives a permutation with a single cycle through every line.
+     */
+    for (line = 0u; line < lines; line++)
+    {
+        node[line * WORDS_PER_LINE] = line;
+    }
+
+    for (line = lines - 1u; line > 0u; line--)
+    {
+        other = next_random(&random_state) % line;
+        swap = node[line * WORDS_PER_LINE];
+        node[line * WORDS_PER_LINE] = node[other * WORDS_PER_LINE];
+        node[other * WORDS_PER_LINE] = swap;
+    }
+
+    /* Turn the line numbers into the addresses followed by the chase. */
+    for (line = 0u; line < lines; line++)
+    {
+        node[line * WORDS_PER_LINE] =
+            load->base + (node[line * WORDS_PER_LINE] * DMA_BENCH_LOAD_LINE_SIZE);
+    }
+
+    mb();
+}
+
+uint32_t
+dma_bench_load_run(const dma_bench_load_t *load, uint64_t *position, uint32_t count)
+{
+    uint64_t end = load->base + load->size;
+    uint64_t address = *position;
+    volatile uint64_t *line;
+    uint32_t access;
+    uint32_t word;
+
+    if ((DMA_BENCH_LOAD_IDLE == load->pattern) || (0u == load->size))
+    {
+        return 0u;
+    }
+
+    if ((address < load->base) || (address >= end))
+    {
+        address = load->base;
+    }
+
+    switch (load->pattern)
+    {
+        case DMA_BENCH_LOAD_STREAM_READ:
+            for (access = 0u; access < count; access++)
+            {
+                line = (volatile uint64_t *)(uintptr_t)address;
+                for (word = 0u; word < WORDS_PER_LINE; word++)
+                {
+                    (void)line[word];
+                }
+                address += DMA_BENCH_LOAD_LINE_SIZE;
+                if (address >= end)
+                {
+                    address = load->base;
+                }
+            }
+            break;
+
+        case DMA_BENCH_LOAD_STREAM_WRITE:
+            for (access = 0u; access < count; access++)
+            {
+                line = (volatile uint64_t *)(uintptr_t)address;
+                for (word = 0u; word < WORDS_PER_LINE; word++)
+                {
+                    line[word] = address;
+                }
+                address += DMA_BENCH_LOAD_LINE_SIZE;
+                if (address >= end)
+                {
+                    address = load->base;
+                }
+            }
+            break;
+
+        case DMA_BENCH_LOAD_POINTER_CHASE:
+            for (access = 0u; access < count; access++)
+            {
+                address = *(volatile uint64_t *)(uintptr_t)address;
+            }
+            break;
+
+        default:
+            return 0u;
+    }
+
+    *position = address;
+
+    return count;
+}
+
+void
+dma_bench_load_worker(void)
+{
+    dma_bench_load_slot_t *slot = &g_load_slots[read_csr(mhartid) - 1u];
+    dma_bench_load_t load;
+    uint64_t position;
+    uint64_t accesses;
+    uint64_t start_mcycle;
+
+    while (1u)
+    {
+        while (0u == slot->run)
+        {
+            ;
+        }
+        mb();
+
+        load = slot->load;
+        position = load.base;
+        accesses = 0u;
+        start_mcycle = readmcycle();
+        slot->running = 1u;
+
+        while (0u != slot->run)
+        {
+            accesses += dma_bench_load_run(&load, &position, DMA_BENCH_LOAD_CHUNK);
+        }
+
+        slot->cycles = readmcycle() - start_mcycle;
+        slot->accesses = accesses;
+        mb();
+        slot->running = 0u;
+    }
+}
+
+uint32_t
+dma_bench_load_start(uint32_t hart_id, const dma_bench_load_t *load)
+{
+    dma_bench_load_slot_t *slot = &g_load_slots[hart_id - 1u];
+    uint32_t attempt;
+    uint32_t poll;
+
+    slot->load = *load;
+    slot->accesses = 0u;
+    slot->cycles = 0u;
+    mb();
+    slot->run = 1u;
+
+    for (attempt = 0u; attempt < DMA_BENCH_LOAD_WAKE_ATTEMPTS; attempt++)
+    {
+        for (poll = 0u; poll < DMA_BENCH_LOAD_WAKE_POLLS; poll++)
+        {
+            if (0u != slot->running)
+            {
+                return 0u;
+            }
+        }
+        raise_soft_interrupt(hart_id);
+    }
+
+    slot->run = 0u;
+    return 1u;
+}
+
+void
+dma_bench_load_stop(uint32_t hart_id, uint64_t *accesses, uint64_t *cycles)
+{
+    dma_bench_load_slot_t *slot = &g_load_slots[hart_id - 1u];
+
+    slot->run = 0u;
+    while (0u != slot->running)
+    {
+        ;
+    }
+    mb();
+
+    *accesses = slot->accesses;
+    *cycles = slot->cycles;
+}
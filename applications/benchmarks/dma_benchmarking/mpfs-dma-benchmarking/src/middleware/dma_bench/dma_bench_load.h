@@ -0,0 +1,82 @@
+/*******************************************************************************
+ * Copyright 2023 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * CPU memory load patterns run on the U54 harts while the DMA benchmarks run,
+ * used to measure how the DMA controllers and the harts slow each other down.
+ */
+
+#ifndef DMA_BENCH_LOAD_H_
+#define DMA_BENCH_LOAD_H_
+
+#include <stdint.h>
+
+/* Bytes touched by one access of a load pattern, one cache line. */
+#define DMA_BENCH_LOAD_LINE_SIZE        (64u)
+
+/* Accesses a load hart makes between checks for a request to stop. */
+#define DMA_BENCH_LOAD_CHUNK            (256u)
+
+/* Harts which can run a load, U54_1 to U54_4. */
+#define DMA_BENCH_LOAD_HARTS            (4u)
+
+/* Polls made for a load hart to start before it is woken again. */
+#define DMA_BENCH_LOAD_WAKE_POLLS       (100000u)
+
+/* Times a load hart is woken before it is given up on. */
+#define DMA_BENCH_LOAD_WAKE_ATTEMPTS    (10u)
+
+typedef enum
+{
+    DMA_BENCH_LOAD_IDLE,           /* no memory accesses */
+    DMA_BENCH_LOAD_STREAM_READ,    /* reads every word of each line in order */
+    DMA_BENCH_LOAD_STREAM_WRITE,   /* writes every word of each line in order */
+    DMA_BENCH_LOAD_POINTER_CHASE   /* follows a random cycle through the lines */
+} dma_bench_load_pattern_t;
+
+/* A load pattern and the memory it runs over. base and size must be multiples
+ * of DMA_BENCH_LOAD_LINE_SIZE. */
+typedef struct
+{
+    dma_bench_load_pattern_t pattern;
+    uint64_t base;
+    uint32_t size;
+} dma_bench_load_t;
+
+/*
+ * Prepare the memory of a load. For a pointer chase this writes a single
+ * random cycle through every line of the region, so that each access depends
+ * on the previous one and cannot be predicted by the prefetcher. The other
+ * patterns need no preparation.
+ */
+void dma_bench_load_prepare(const dma_bench_load_t *load);
+
+/*
+ * Make count accesses of a load, starting at *position and leaving *position
+ * at the next line to access. A *position outside the region starts at the
+ * start of the region. Returns the number of accesses made, which is 0 for
+ * DMA_BENCH_LOAD_IDLE.
+ */
+uint32_t dma_bench_load_run(const dma_bench_load_t *load, uint64_t *position, uint32_t count);
+
+/*
+ * Run the loads requested for the calling hart by dma_bench_load_start().
+ * Called by U54_2 to U54_4 once they are out of WFI. Never returns.
+ */
+void dma_bench_load_worker(void);
+
+/*
+ * Start a load on hart_id, 2 to 4, and wait for it to be running. A hart still
+ * waiting in WFI is woken with a software interrupt. Returns 0 once the load
+ * is running or 1 if the hart did not respond.
+ */
+uint32_t dma_bench_load_start(uint32_t hart_id, const dma_bench_load_t *load);
+
+/*
+ * Stop the load on hart_id and return the accesses made and the clock cycles
+ * taken by the hart since the load started.
+ */
+void dma_bench_load_stop(uint32_t hart_id, uint64_t *accesses, uint64_t *cycles);
+
+#endif /* DMA_BENCH_LOAD_H_ */
@@ -0,0 +1,134 @@
+/*******************************************************************************
+ * Copyright 2023 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Repeated measurement statistics and machine readable output shared by the
+ * DMA benchmarking applications.
+ */
+
+#include <stdio.h>
+#include "mpfs_hal/mss_hal.h"
+#include "dma_bench_stats.h"
+
+#define BYTES_TO_MEGABITS_SCALE_FACTOR (125000.0)
+
+void
+dma_bench_stats(uint64_t *samples, uint32_t runs, dma_bench_stats_t *stats)
+{
+    uint64_t sample;
+    uint32_t index;
+    uint32_t slot;
+
+    stats->runs = runs;
+    stats->min = 0u;
+    stats->median = 0u;
+    stats->p99 = 0u;
+    stats->max = 0u;
+
+    if (0u == runs)
+    {
+        return;
+    }
+
+    /* Insertion sort, the number of runs is small. */
+    for (index = 1u; index < runs; index++)
+    {
+        sample = samples[index];
+        slot = index;
+        while ((slot > 0u) && (samples[slot - 1u] > sample))
+        {
+            samples[slot] = samples[slot - 1u];
+            slot--;
+        }
+        samples[slot] = sample;
+    }
+
+    stats->min = samples[0];
+    stats->max = samples[runs - 1u];
+
+    if (0u != (runs & 1u))
+    {
+        stats->median = samples[runs / 2u];
+    }
+    else
+    {
+        stats->median = (samples[(runs / 2u) - 1u] + samples[runs / 2u]) / 2u;
+    }
+
+    /* Nearest rank: the smallest sample with at least 99% of samples at or
+     * below it. */
+    stats->p99 = samples[(((runs * 99u) + 99u) / 100u) - 1u];
+}
+
+uint32_t
+dma_bench_next_size(uint32_t size, uint32_t step_percent)
+{
+    uint64_t next = ((uint64_t)size * step_percent) / 100u;
+
+    if (next <= size)
+    {
+        next = (uint64_t)size + 1u;
+    }
+
+    if (next > UINT32_MAX)
+    {
+        next = UINT32_MAX;
+    }
+
+    return (uint32_t)next;
+}
+
+uint64_t
+dma_bench_rate(uint64_t cycles, uint32_t size)
+{
+    double seconds;
+
+    if (0u == cycles)
+    {
+        return 0u;
+    }
+
+    seconds = cycles / (double)LIBERO_SETTING_MSS_COREPLEX_CPU_CLK;
+
+    return (uint64_t)((size / seconds) / BYTES_TO_MEGABITS_SCALE_FACTOR);
+}
+
+void
+dma_bench_print_config(mss_uart_instance_t *uart, const char *application, uint32_t runs)
+{
+    char message[100] = {0};
+
+    sprintf(message,
+            "\r\nCONFIG,%s,%s,%lu,%u\r\n",
+            application,
+            DMA_BENCH_BUILD_TAG,
+            (uint64_t)LIBERO_SETTING_MSS_COREPLEX_CPU_CLK,
+            runs);
+    MSS_UART_polled_tx_string(uart, (const uint8_t *)message);
+}
+
+void
+dma_bench_print_result(mss_uart_instance_t *uart,
+                       const char *engine,
+                       const char *source,
+                       const char *destination,
+                       uint32_t size,
+                       const dma_bench_stats_t *stats)
+{
+    char message[160] = {0};
+
+    sprintf(message,
+            "RESULT,%s,%s,%s,%u,%u,%lu,%lu,%lu,%lu,%lu\r\n",
+            engine,
+            source,
+            destination,
+            size,
+            stats->runs,
+            stats->min,
+            stats->median,
+            stats->p99,
+            stats->max,
+            dma_bench_rate(stats->median, size));
+    MSS_UART_polled_tx_string(uart, (const uint8_t *)message);
+}
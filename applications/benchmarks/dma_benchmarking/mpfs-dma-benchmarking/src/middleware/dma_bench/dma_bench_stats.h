@@ -0,0 +1,73 @@
+/*******************************************************************************
+ * Copyright 2023 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Repeated measurement statistics and machine readable output shared by the
+ * DMA benchmarking applications.
+ */
+
+#ifndef DMA_BENCH_STATS_H_
+#define DMA_BENCH_STATS_H_
+
+#include <stdint.h>
+#include "drivers/mss/mss_mmuart/mss_uart.h"
+
+/* Largest number of runs which can be made of each configuration. */
+#ifndef DMA_BENCH_MAX_RUNS
+#define DMA_BENCH_MAX_RUNS   (64u)
+#endif
+
+/* Label printed on the CONFIG line, for example a git commit id. */
+#ifndef DMA_BENCH_BUILD_TAG
+#define DMA_BENCH_BUILD_TAG  "untagged"
+#endif
+
+/* Summary of the cycle counts measured over the runs of one configuration. */
+typedef struct
+{
+    uint32_t runs;
+    uint64_t min;
+    uint64_t median;
+    uint64_t p99;
+    uint64_t max;
+} dma_bench_stats_t;
+
+/*
+ * Sort samples[0..runs-1] in place and fill in stats. The 99th percentile uses
+ * the nearest rank method, so it is the maximum for fewer than 100 runs.
+ */
+void dma_bench_stats(uint64_t *samples, uint32_t runs, dma_bench_stats_t *stats);
+
+/*
+ * Return the transfer size which follows size in a log spaced sweep, where
+ * each size is step_percent percent of the previous one. The result is always
+ * larger than size.
+ */
+uint32_t dma_bench_next_size(uint32_t size, uint32_t step_percent);
+
+/*
+ * Convert a cycle count for a transfer of size bytes to MegaBits per second.
+ */
+uint64_t dma_bench_rate(uint64_t cycles, uint32_t size);
+
+/*
+ * Print the CONFIG line which starts a set of results:
+ * CONFIG,<application>,<tag>,<cpu clock Hz>,<runs>
+ */
+void dma_bench_print_config(mss_uart_instance_t *uart, const char *application, uint32_t runs);
+
+/*
+ * Print one RESULT line:
+ * RESULT,<engine>,<source>,<destination>,<size>,<runs>,<min>,<median>,<p99>,
+ * <max>,<median MegaBits per second>
+ * The cycle counts are CPU clock cycles per transfer.
+ */
+void dma_bench_print_result(mss_uart_instance_t *uart,
+                            const char *engine,
+                            const char *source,
+                            const char *destination,
+                            uint32_t size,
+                            const dma_bench_stats_t *stats);
+
+#endif /* DMA_BENCH_STATS_H_ */
@@ -0,0 +1,63 @@
+/*******************************************************************************
+ * Copyright 2023 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Destination buffer checks shared by the DMA benchmarking applications.
+ */
+
+#include "mpfs_hal/mss_hal.h"
+#include "dma_bench_verify.h"
+
+static uint64_t g_staging[DMA_BENCH_VERIFY_STAGING_SIZE / sizeof(uint64_t)];
+
+/* Source fingerprint of the last DMA_BENCH_VERIFY_CRC32C check */
+static const void *g_crc_source = NULL;
+static uint64_t g_crc_size = 0u;
+static uint32_t g_crc = 0u;
+
+void
+dma_bench_verify_source_filled(void)
+{
+    g_crc_source = NULL;
+}
+
+uint32_t
+dma_bench_verify(uint32_t mode,
+                 const void *source,
+                 const void *destination,
+                 uint64_t size,
+                 uint64_t *offset)
+{
+    switch (mode)
+    {
+        case DMA_BENCH_VERIFY_CRC32C:
+            if ((source != g_crc_source) || (size != g_crc_size))
+            {
+                g_crc = mss_mem_crc32c(MSS_MEM_CRC32C_INIT, source, size);
+                g_crc_source = source;
+                g_crc_size = size;
+            }
+
+            if (g_crc == mss_mem_crc32c(MSS_MEM_CRC32C_INIT, destination, size))
+            {
+                return MSS_MEM_VERIFY_OK;
+            }
+            /* Locate the difference for the error report. */
+            (void)mss_mem_verify(source, destination, size, offset);
+            return MSS_MEM_VERIFY_MISMATCH;
+
+        case DMA_BENCH_VERIFY_PDMA:
+            return mss_mem_verify_pdma(source,
+                                       destination,
+                                       size,
+                                       offset,
+                                       g_staging,
+                                       sizeof(g_staging),
+                                       DMA_BENCH_VERIFY_PDMA_CHANNEL);
+
+        case DMA_BENCH_VERIFY_COMPARE:
+        default:
+            return mss_mem_verify(source, destination, size, offset);
+    }
+}
@@ -0,0 +1,62 @@
+/*******************************************************************************
+ * Copyright 2023 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Destination buffer checks shared by the DMA benchmarking applications.
+ */
+
+#ifndef DMA_BENCH_VERIFY_H_
+#define DMA_BENCH_VERIFY_H_
+
+#include <stdint.h>
+
+/*
+ * Verification modes:
+ * DMA_BENCH_VERIFY_COMPARE  - compare the destination with the source, 64 bits
+ *                             at a time.
+ * DMA_BENCH_VERIFY_CRC32C   - compare CRC32C fingerprints of the source and
+ *                             destination, then locate the first difference
+ *                             only if they do not match.
+ * DMA_BENCH_VERIFY_PDMA     - copy the destination into a staging buffer with
+ *                             a PDMA channel, comparing each block while the
+ *                             next is being fetched.
+ */
+#define DMA_BENCH_VERIFY_COMPARE        (0u)
+#define DMA_BENCH_VERIFY_CRC32C         (1u)
+#define DMA_BENCH_VERIFY_PDMA           (2u)
+
+/* Size of the staging buffer used by DMA_BENCH_VERIFY_PDMA. */
+#ifndef DMA_BENCH_VERIFY_STAGING_SIZE
+#define DMA_BENCH_VERIFY_STAGING_SIZE   (8192u)
+#endif
+
+/*
+ * PDMA channel used by DMA_BENCH_VERIFY_PDMA. It is reserved through the
+ * MPFS HAL channel ownership mask while each check runs, so the PDMA driver
+ * request queues, striped copies and mpfs_dma_memcpy() do not use it at the
+ * same time. The CPU compare is used if the channel is busy.
+ */
+#ifndef DMA_BENCH_VERIFY_PDMA_CHANNEL
+#define DMA_BENCH_VERIFY_PDMA_CHANNEL   (1u)
+#endif
+
+/*
+ * Must be called after the source buffer is written. DMA_BENCH_VERIFY_CRC32C
+ * computes the source fingerprint once and reuses it for every check of the
+ * same source and size until this is called.
+ */
+void dma_bench_verify_source_filled(void);
+
+/*
+ * Check that size bytes at destination match the bytes at source using the
+ * given mode. Returns 0 if they match. Otherwise returns 1 and writes the
+ * offset of the first byte which differs to *offset.
+ */
+uint32_t dma_bench_verify(uint32_t mode,
+                          const void *source,
+                          const void *destination,
+                          uint64_t size,
+                          uint64_t *offset);
+
+#endif /* DMA_BENCH_VERIFY_H_ */
@@ -1,522 +1,1181 @@
-/*******************************************************************************
- * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
- *
- * SPDX-License-Identifier: MIT
- *
- * PoalrFire SoC Microprocessor Subsystem PDMA bare metal driver implementation.
- */
-
-#include "mpfs_hal/mss_hal.h"
-#include "mss_pdma_regs.h"
-#include "mss_pdma.h"
-
-#ifdef __cplusplus
-extern "C" {
-#endif 
-
-
-/* MACRO to set the correct channel memory offset for the memory mapped
- * configuration register.
- */
-#define MSS_PDMA_REG_OFFSET(x)  \
-                    (uint64_t)(PDMA_REG_BASE + (PDMA_CHL_REG_OFFSET * (x)))
-
-/* Default is maximum transaction size for both write_size and read_size. */
-uint8_t g_channel_nextcfg_wsize[MSS_PDMA_lAST_CHANNEL] = 
-                                                { 0x0Fu, 0x0Fu, 0x0Fu, 0x0Fu };
-uint8_t g_channel_nextcfg_rsize[MSS_PDMA_lAST_CHANNEL] = 
-                                                { 0x0Fu, 0x0Fu, 0x0Fu, 0x0Fu };
-
-/* Callback handler declaration */
-mss_pdma_int_handler_t mss_pdma_isr;
-
-/*-------------------------------------------------------------------------*//**
- * MSS_PDMA_setup_transfer()
- * See mss_pdma.h for description of this function.
- */
-mss_pdma_error_id_t
-MSS_PDMA_setup_transfer
-(
-    mss_pdma_channel_id_t channel_id,
-    mss_pdma_channel_config_t *channel_config,
-    mss_pdma_int_handler_t pdma_transfer_handler
-)
-{
-    if (channel_id > MSS_PDMA_CHANNEL_3)
-    {
-        return MSS_PDMA_ERROR_INVALID_CHANNEL_ID;
-    }
-
-    /* Register callback interrupt handler */
-    mss_pdma_isr = pdma_transfer_handler;
-
-    /* Set the register structure pointer for the PDMA channel. */
-    volatile mss_pdma_t *pdmareg = (mss_pdma_t *)MSS_PDMA_REG_OFFSET(channel_id);
-
-    /* Basic House Keeping, return if errors exist. */
-    if (channel_config->src_addr == 0u)
-    {
-        return MSS_PDMA_ERROR_INVALID_SRC_ADDR;
-    }
-
-    if (channel_config->dest_addr == 0u)
-    {
-        return MSS_PDMA_ERROR_INVALID_DEST_ADDR;
-    }
-
-    /* If a run transaction is in progress, return error.
-     * Channel can only be claimed when run is low */
-    if (pdmareg->control_reg & MASK_PDMA_CONTROL_RUN)
-    {
-        return MSS_PDMA_ERROR_TRANSACTION_IN_PROGRESS;
-    }
-
-    /* Set or clear the interrupts for the transfer. */
-    if (channel_config->enable_done_int)
-    {
-        pdmareg->control_reg |= ((uint32_t)MASK_PDMA_ENABLE_DONE_INT);
-    }
-    else
-    {
-        pdmareg->control_reg &= ~((uint32_t)MASK_PDMA_ENABLE_DONE_INT);
-    }
-
-    if (channel_config->enable_err_int)
-    {
-        pdmareg->control_reg |= ((uint32_t)MASK_PDMA_ENABLE_ERR_INT);
-    }
-    else
-    {
-        pdmareg->control_reg &= ~((uint32_t)MASK_PDMA_ENABLE_ERR_INT);
-    }
-
-    /* clear Next registers. */
-    pdmareg->control_reg |= (uint32_t)MASK_CLAIM_PDMA_CHANNEL;
-
-    /* Setup the source and destination addresses.*/
-    pdmareg->next_destination = channel_config->dest_addr;
-    pdmareg->next_source      = channel_config->src_addr;
-
-    /* Set the transfer size. */
-    pdmareg->next_bytes       = channel_config->num_bytes;
-
-    /* Setup repeat and force order requirements. */
-    if (channel_config->repeat)
-    {
-        pdmareg->next_config |= MASK_REPEAT_TRANSCTION;
-    }
-    else
-    {
-        pdmareg->next_config &= ~((uint32_t)MASK_REPEAT_TRANSCTION);
-    }
-
-    if (channel_config->force_order)
-    {
-        pdmareg->next_config |= ((uint32_t)MASK_FORCE_ORDERING);
-    }
-    else
-    {
-        pdmareg->next_config &= ~((uint32_t)MASK_FORCE_ORDERING);
-    }
-
-    /* PDMA transaction size.. set to maximum. */
-    pdmareg->next_config |=
-            (g_channel_nextcfg_wsize[channel_id] << SHIFT_CH_CONFIG_WSIZE);
-    pdmareg->next_config |=
-            (g_channel_nextcfg_rsize[channel_id] << SHIFT_CH_CONFIG_RSIZE);
-
-    return MSS_PDMA_OK;
-}
-
-/***************************************************************************//**
- * See mss_pdma.h for description of this function.
- */
-mss_pdma_error_id_t
-MSS_PDMA_set_transaction_size
-(
-    mss_pdma_channel_id_t channel_id,
-    uint8_t write_size,
-    uint8_t read_size
-)
-{
-    uint8_t value;
-
-    if (channel_id > MSS_PDMA_CHANNEL_3)
-    {
-        return MSS_PDMA_ERROR_INVALID_CHANNEL_ID;
-    }
-
-    if (write_size > 0x0Fu)
-    {
-        return MSS_PDMA_ERROR_INVALID_NEXTCFG_WSIZE;
-    }
-
-    if (read_size > 0x0Fu)
-    {
-        return MSS_PDMA_ERROR_INVALID_NEXTCFG_RSIZE;
-    }
-
-    g_channel_nextcfg_wsize[channel_id] = write_size;
-    g_channel_nextcfg_rsize[channel_id] = read_size;
-
-    return MSS_PDMA_OK;
-}
-
-/***************************************************************************//**
- * See mss_pdma.h for description of this function.
- */
-mss_pdma_error_id_t
-MSS_PDMA_start_transfer
-(
-    mss_pdma_channel_id_t channel_id
-)
-{
-    if (channel_id > MSS_PDMA_CHANNEL_3)
-    {
-        return MSS_PDMA_ERROR_INVALID_CHANNEL_ID;
-    }
-
-    /* Set the register structure pointer for the PDMA channel. */
-    volatile mss_pdma_t *pdmareg = (mss_pdma_t *)MSS_PDMA_REG_OFFSET(channel_id);
-
-    /* If a run transaction is in progress, return error.
-     * Channel can only be claimed when run is low */
-    pdmareg->control_reg |= ((uint32_t)MASK_PDMA_CONTROL_RUN);
-
-    return MSS_PDMA_OK;
-}
-
-/***************************************************************************//**
- * See mss_pdma.h for description of this function.
- */
-uint32_t
-MSS_PDMA_get_active_transfer_type
-(
-    mss_pdma_channel_id_t channel_id
-)
-{
-    if (channel_id > MSS_PDMA_CHANNEL_3)
-    {
-        return 0u;
-    }
-
-    /* Set the register structure pointer for the PDMA channel. */
-    volatile mss_pdma_t *pdmareg = (mss_pdma_t *)MSS_PDMA_REG_OFFSET(channel_id);
-
-    return pdmareg->exec_config;
-}
-
-/***************************************************************************//**
- * See mss_pdma.h for description of this function.
- */
-uint64_t
-MSS_PDMA_get_number_bytes_remaining
-(
-    mss_pdma_channel_id_t channel_id
-)
-{
-    if (channel_id > MSS_PDMA_CHANNEL_3)
-    {
-        return 0u;
-    }
-
-    /* Set the register structure pointer for the PDMA channel. */
-    volatile mss_pdma_t *pdmareg = (mss_pdma_t *)MSS_PDMA_REG_OFFSET(channel_id);
-
-    return pdmareg->exec_bytes;
-}
-
-/***************************************************************************//**
- * See mss_pdma.h for description of this function.
- */
-uint64_t
-MSS_PDMA_get_destination_current_addr
-(
-    mss_pdma_channel_id_t channel_id
-)
-{
-    if (channel_id > MSS_PDMA_CHANNEL_3)
-    {
-        return 0u;
-    }
-
-    /* Set the register structure pointer for the PDMA channel. */
-    volatile mss_pdma_t *pdmareg = (mss_pdma_t *)MSS_PDMA_REG_OFFSET(channel_id);
-
-    return pdmareg->exec_destination;
-}
-
-/***************************************************************************//**
- * See mss_pdma.h for description of this function.
- */
-uint64_t
-MSS_PDMA_get_source_current_addr
-(
-    mss_pdma_channel_id_t channel_id
-)
-{
-    if (channel_id > MSS_PDMA_CHANNEL_3)
-    {
-        return 0u;
-    }
-
-    /* Set the register structure pointer for the PDMA channel. */
-    volatile mss_pdma_t *pdmareg = (mss_pdma_t *)MSS_PDMA_REG_OFFSET(channel_id);
-
-    return pdmareg->exec_source;
-}
-
-/***************************************************************************//**
- * See mss_pdma.h for description of this function.
- */
-uint8_t
-MSS_PDMA_get_transfer_complete_status
-(
-    mss_pdma_channel_id_t channel_id
-)
-{
-    if (channel_id > MSS_PDMA_CHANNEL_3)
-    {
-        return 0u;
-    }
-
-    /* Set the register structure pointer for the PDMA channel. */
-    volatile mss_pdma_t *pdmareg = (mss_pdma_t *)MSS_PDMA_REG_OFFSET(channel_id);
-
-    if (pdmareg->control_reg & MASK_PDMA_TRANSFER_DONE)
-    {
-        return 1u;
-    }
-    else
-    {
-        return 0u;
-    }
-}
-
-/***************************************************************************//**
- * See mss_pdma.h for description of this function.
- */
-uint8_t
-MSS_PDMA_get_transfer_error_status
-(
-    mss_pdma_channel_id_t channel_id
-)
-{
-    if (channel_id > MSS_PDMA_CHANNEL_3)
-    {
-        return 0u;
-    }
-    
-    /* Set the register structure pointer for the PDMA channel. */
-    volatile mss_pdma_t *pdmareg = (mss_pdma_t *)MSS_PDMA_REG_OFFSET(channel_id);
-
-    if (pdmareg->control_reg & MASK_PDMA_TRANSFER_ERROR)
-    {
-        return 1u;
-    }
-    else
-    {
-        return 0u;
-    }
-}
-
-/***************************************************************************//**
- * See mss_pdma.h for description of this function.
- */
-uint8_t
-MSS_PDMA_clear_transfer_complete_status
-(
-    mss_pdma_channel_id_t channel_id
-)
-{
-    uint8_t intStatus = 0u;
-
-    if (channel_id > MSS_PDMA_CHANNEL_3)
-    {
-        return 0u;
-    }
-
-    /* Set the register structure pointer for the PDMA channel. */
-    volatile mss_pdma_t *pdmareg = (mss_pdma_t *)MSS_PDMA_REG_OFFSET(channel_id);
-
-    if (pdmareg->control_reg & MASK_PDMA_TRANSFER_DONE)
-    {
-        intStatus = 1u;
-        pdmareg->control_reg &= ~((uint32_t)MASK_PDMA_TRANSFER_DONE);
-    }
-
-    return intStatus;
-}
-
-/***************************************************************************//**
- * See mss_pdmaF.h for description of this function.
- */
-uint8_t
-MSS_PDMA_clear_transfer_error_status
-(
-    mss_pdma_channel_id_t channel_id
-)
-{
-    uint8_t intStatus = 0u;
-
-    if (channel_id > MSS_PDMA_CHANNEL_3)
-    {
-        return 0u;
-    }
-
-    /* Set the register structure pointer for the PDMA channel. */
-    volatile mss_pdma_t *pdmareg = (mss_pdma_t *)MSS_PDMA_REG_OFFSET(channel_id);
-
-    if (pdmareg->control_reg & MASK_PDMA_TRANSFER_ERROR)
-    {
-        intStatus = 1u;
-        pdmareg->control_reg &= ~((uint32_t)MASK_PDMA_TRANSFER_ERROR);
-    }
-
-    return intStatus;
-}
-
-/***************************************************************************//**
- * Each DMA channel has two interrupts, one for transfer complete
- * and the other for the transfer error.
- */
-uint8_t
-dma_ch0_DONE_IRQHandler
-(
-    void
-)
-{
-    /* Clear the interrupt enable bit. */
-    volatile mss_pdma_t *pdmareg = (mss_pdma_t *)MSS_PDMA_REG_OFFSET
-                                                (MSS_PDMA_CHANNEL_0);
-
-    pdmareg->control_reg &= ~((uint32_t)MASK_PDMA_ENABLE_DONE_INT);
-
-    mss_pdma_isr(PDMA_CH0_DONE_INT);
-
-    return 0u;
-}
-
-uint8_t
-dma_ch0_ERR_IRQHandler
-(
-    void
-)
-{
-    /* Clear the interrupt enable bit. */
-    volatile mss_pdma_t *pdmareg = (mss_pdma_t *)MSS_PDMA_REG_OFFSET
-                                                (MSS_PDMA_CHANNEL_0);
-
-    pdmareg->control_reg &= ~((uint32_t)MASK_PDMA_ENABLE_ERR_INT);
-
-    mss_pdma_isr(PDMA_CH0_ERROR_INT);
-
-    return 0u;
-}
-
-uint8_t
-dma_ch1_DONE_IRQHandler
-(
-    void
-)
-{
-    /* Clear the interrupt enable bit. */
-    volatile mss_pdma_t *pdmareg = (mss_pdma_t *)MSS_PDMA_REG_OFFSET
-                                                (MSS_PDMA_CHANNEL_1);
-
-    pdmareg->control_reg &= ~((uint32_t)MASK_PDMA_ENABLE_DONE_INT);
-
-    mss_pdma_isr(PDMA_CH1_DONE_INT);
-
-    return 0u;
-}
-
-uint8_t
-dma_ch1_ERR_IRQHandler
-(
-    void
-)
-{
-    /* Clear the interrupt enable bit. */
-    volatile mss_pdma_t *pdmareg = (mss_pdma_t *)MSS_PDMA_REG_OFFSET
-                                                (MSS_PDMA_CHANNEL_1);
-
-    pdmareg->control_reg &= ~((uint32_t)MASK_PDMA_ENABLE_ERR_INT);
-
-    mss_pdma_isr(PDMA_CH1_ERROR_INT);
-
-    return 0u;
-}
-
-
-uint8_t
-dma_ch2_DONE_IRQHandler
-(
-    void
-)
-{
-    /* Clear the interrupt enable bit. */
-    volatile mss_pdma_t *pdmareg = (mss_pdma_t *)MSS_PDMA_REG_OFFSET
-                                                (MSS_PDMA_CHANNEL_2);
-
-    pdmareg->control_reg &= ~((uint32_t)MASK_PDMA_ENABLE_DONE_INT);
-
-    mss_pdma_isr(PDMA_CH2_DONE_INT);
-
-    return 0u;
-}
-
-uint8_t
-dma_ch2_ERR_IRQHandler
-(
-    void
-)
-{
-    /* Clear the interrupt enable bit. */
-    volatile mss_pdma_t *pdmareg = (mss_pdma_t *)MSS_PDMA_REG_OFFSET
-                                                (MSS_PDMA_CHANNEL_2);
-
-    pdmareg->control_reg &= ~((uint32_t)MASK_PDMA_ENABLE_ERR_INT);
-
-    mss_pdma_isr(PDMA_CH2_ERROR_INT);
-
-    return 0u;
-}
-
-uint8_t
-dma_ch3_DONE_IRQHandler
-(
-    void
-)
-{
-    /* Clear the interrupt enable bit. */
-    volatile mss_pdma_t *pdmareg = (mss_pdma_t *)MSS_PDMA_REG_OFFSET
-                                                (MSS_PDMA_CHANNEL_3);
-
-    pdmareg->control_reg &= ~((uint32_t)MASK_PDMA_ENABLE_DONE_INT);
-
-    mss_pdma_isr(PDMA_CH3_DONE_INT);
-
-    return 0u;
-}
-
-uint8_t
-dma_ch3_ERR_IRQHandler
-(
-    void
-)
-{
-    /* Clear the interrupt enable bit. */
-    volatile mss_pdma_t *pdmareg = (mss_pdma_t *)MSS_PDMA_REG_OFFSET
-                                                (MSS_PDMA_CHANNEL_3);
-
-    pdmareg->control_reg &= ~((uint32_t)MASK_PDMA_ENABLE_ERR_INT);
-
-    mss_pdma_isr(PDMA_CH3_ERROR_INT);
-
-    return 0u;
-}
-
-#ifdef __cplusplus
-}
-#endif
+/*******************************************************************************
+ * Copyright 2019-2021 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * PoalrFire SoC Microprocessor Subsystem PDMA bare metal driver implementation.
+ */
+
+#include "mpfs_hal/mss_hal.h"
+#include "mss_pdma_regs.h"
+#include "mss_pdma.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif 
+
+
+/* MACRO to set the correct channel memory offset for the memory mapped
+ * configuration register.
+ */
+#define MSS_PDMA_REG_OFFSET(x)  \
+                    (uint64_t)(PDMA_REG_BASE + (PDMA_CHL_REG_OFFSET * (x)))
+
+/* Default is maximum transaction size for both write_size and read_size. */
+uint8_t g_channel_nextcfg_wsize[MSS_PDMA_lAST_CHANNEL] = 
+                                                { 0x0Fu, 0x0Fu, 0x0Fu, 0x0Fu };
+uint8_t g_channel_nextcfg_rsize[MSS_PDMA_lAST_CHANNEL] = 
+                                                { 0x0Fu, 0x0Fu, 0x0Fu, 0x0Fu };
+
+/* Transaction size table set with MSS_PDMA_set_route_table(). */
+static const mss_pdma_route_t *g_pdma_routes = 0;
+static uint32_t g_pdma_route_count = 0u;
+
+/* Callback handler declaration */
+mss_pdma_int_handler_t mss_pdma_isr;
+
+/* A request waiting in, or being executed from, a channel queue. */
+typedef struct _pdmarequest
+{
+    uint64_t src_addr;
+    uint64_t dest_addr;
+    uint64_t num_bytes;
+    mss_pdma_queue_handler_t handler;
+    void *user_data;
+} mss_pdma_request_t;
+
+/* Software request queue for one channel. The request at head is the one the
+ * channel is executing whenever count is non zero. The lock is held, with the
+ * local interrupts masked, whenever the queue is changed, as requests may be
+ * submitted from a different hart to the one taking the channel interrupts.
+ */
+typedef struct _pdmaqueue
+{
+    volatile long lock;
+    mss_pdma_request_t request[MSS_PDMA_QUEUE_SIZE];
+    volatile uint32_t head;
+    volatile uint32_t count;
+    uint32_t depth;
+    uint8_t force_order;
+    volatile uint8_t enabled;
+    volatile uint32_t completed;
+    volatile uint32_t errors;
+} mss_pdma_queue_t;
+
+static mss_pdma_queue_t g_pdma_queue[MSS_PDMA_lAST_CHANNEL];
+
+static uint32_t pdma_transaction_size(mss_pdma_channel_id_t channel_id,
+                                      uint64_t src_addr,
+                                      uint64_t dest_addr,
+                                      uint64_t num_bytes);
+static void pdma_queue_start(mss_pdma_channel_id_t channel_id);
+static void pdma_queue_enable(mss_pdma_channel_id_t channel_id, uint8_t enable);
+static uint8_t pdma_queue_irq(mss_pdma_channel_id_t channel_id);
+static void pdma_stripe_done(mss_pdma_channel_id_t channel_id,
+                             mss_pdma_error_id_t status,
+                             void *user_data);
+
+/*-------------------------------------------------------------------------*//**
+ * MSS_PDMA_setup_transfer()
+ * See mss_pdma.h for description of this function.
+ */
+mss_pdma_error_id_t
+MSS_PDMA_setup_transfer
+(
+    mss_pdma_channel_id_t channel_id,
+    mss_pdma_channel_config_t *channel_config,
+    mss_pdma_int_handler_t pdma_transfer_handler
+)
+{
+    if (channel_id > MSS_PDMA_CHANNEL_3)
+    {
+        return MSS_PDMA_ERROR_INVALID_CHANNEL_ID;
+    }
+
+    /* Register callback interrupt handler */
+    mss_pdma_isr = pdma_transfer_handler;
+
+    /* Set the register structure pointer for the PDMA channel. */
+    volatile mss_pdma_t *pdmareg = (mss_pdma_t *)MSS_PDMA_REG_OFFSET(channel_id);
+
+    /* Basic House Keeping, return if errors exist. */
+    if (channel_config->src_addr == 0u)
+    {
+        return MSS_PDMA_ERROR_INVALID_SRC_ADDR;
+    }
+
+    if (channel_config->dest_addr == 0u)
+    {
+        return MSS_PDMA_ERROR_INVALID_DEST_ADDR;
+    }
+
+    /* If a run transaction is in progress, return error.
+     * Channel can only be claimed when run is low */
+    if (pdmareg->control_reg & MASK_PDMA_CONTROL_RUN)
+    {
+        return MSS_PDMA_ERROR_TRANSACTION_IN_PROGRESS;
+    }
+
+    /* Set or clear the interrupts for the transfer. */
+    if (channel_config->enable_done_int)
+    {
+        pdmareg->control_reg |= ((uint32_t)MASK_PDMA_ENABLE_DONE_INT);
+    }
+    else
+    {
+        pdmareg->control_reg &= ~((uint32_t)MASK_PDMA_ENABLE_DONE_INT);
+    }
+
+    if (channel_config->enable_err_int)
+    {
+        pdmareg->control_reg |= ((uint32_t)MASK_PDMA_ENABLE_ERR_INT);
+    }
+    else
+    {
+        pdmareg->control_reg &= ~((uint32_t)MASK_PDMA_ENABLE_ERR_INT);
+    }
+
+    /* clear Next registers. */
+    pdmareg->control_reg |= (uint32_t)MASK_CLAIM_PDMA_CHANNEL;
+
+    /* Setup the source and destination addresses.*/
+    pdmareg->next_destination = channel_config->dest_addr;
+    pdmareg->next_source      = channel_config->src_addr;
+
+    /* Set the transfer size. */
+    pdmareg->next_bytes       = channel_config->num_bytes;
+
+    /* Setup repeat and force order requirements. */
+    if (channel_config->repeat)
+    {
+        pdmareg->next_config |= MASK_REPEAT_TRANSCTION;
+    }
+    else
+    {
+        pdmareg->next_config &= ~((uint32_t)MASK_REPEAT_TRANSCTION);
+    }
+
+    if (channel_config->force_order)
+    {
+        pdmareg->next_config |= ((uint32_t)MASK_FORCE_ORDERING);
+    }
+    else
+    {
+        pdmareg->next_config &= ~((uint32_t)MASK_FORCE_ORDERING);
+    }
+
+    /* PDMA transaction size, from the route table or the channel setting. */
+    pdmareg->next_config &=
+            ~((uint32_t)(MASK_CH_CONFIG_WSIZE | MASK_CH_CONFIG_RSIZE));
+    pdmareg->next_config |= pdma_transaction_size(channel_id,
+                                                  channel_config->src_addr,
+                                                  channel_config->dest_addr,
+                                                  channel_config->num_bytes);
+
+    return MSS_PDMA_OK;
+}
+
+/***************************************************************************//**
+ * See mss_pdma.h for description of this function.
+ */
+mss_pdma_error_id_t
+MSS_PDMA_set_transaction_size
+(
+    mss_pdma_channel_id_t channel_id,
+    uint8_t write_size,
+    uint8_t read_size
+)
+{
+    uint8_t value;
+
+    if (channel_id > MSS_PDMA_CHANNEL_3)
+    {
+        return MSS_PDMA_ERROR_INVALID_CHANNEL_ID;
+    }
+
+    if (write_size > 0x0Fu)
+    {
+        return MSS_PDMA_ERROR_INVALID_NEXTCFG_WSIZE;
+    }
+
+    if (read_size > 0x0Fu)
+    {
+        return MSS_PDMA_ERROR_INVALID_NEXTCFG_RSIZE;
+    }
+
+    g_channel_nextcfg_wsize[channel_id] = write_size;
+    g_channel_nextcfg_rsize[channel_id] = read_size;
+
+    return MSS_PDMA_OK;
+}
+
+/***************************************************************************//**
+ * See mss_pdma.h for description of this function.
+ */
+mss_pdma_error_id_t
+MSS_PDMA_set_route_table
+(
+    const mss_pdma_route_t *routes,
+    uint32_t route_count
+)
+{
+    uint32_t index;
+
+    if ((0 == routes) || (0u == route_count))
+    {
+        g_pdma_route_count = 0u;
+        g_pdma_routes = 0;
+        return MSS_PDMA_OK;
+    }
+
+    for (index = 0u; index < route_count; index++)
+    {
+        if (routes[index].write_size > 0x0Fu)
+        {
+            return MSS_PDMA_ERROR_INVALID_NEXTCFG_WSIZE;
+        }
+
+        if (routes[index].read_size > 0x0Fu)
+        {
+            return MSS_PDMA_ERROR_INVALID_NEXTCFG_RSIZE;
+        }
+    }
+
+    /* Clear the count first so a transfer set up from an interrupt handler
+     * never sees the new table with the old count. */
+    g_pdma_route_count = 0u;
+    g_pdma_routes = routes;
+    g_pdma_route_count = route_count;
+
+    return MSS_PDMA_OK;
+}
+
+/***************************************************************************//**
+ * Returns the wsize and rsize fields of the Next config register for a
+ * transfer, from the first matching route or from the channel setting.
+ */
+static uint32_t
+pdma_transaction_size
+(
+    mss_pdma_channel_id_t channel_id,
+    uint64_t src_addr,
+    uint64_t dest_addr,
+    uint64_t num_bytes
+)
+{
+    const mss_pdma_route_t *route;
+    uint32_t index;
+
+    for (index = 0u; index < g_pdma_route_count; index++)
+    {
+        route = &g_pdma_routes[index];
+
+        if ((src_addr >= route->src_addr) &&
+            ((src_addr - route->src_addr) < route->src_size) &&
+            (dest_addr >= route->dest_addr) &&
+            ((dest_addr - route->dest_addr) < route->dest_size) &&
+            (num_bytes >= route->min_bytes))
+        {
+            return ((uint32_t)route->write_size << SHIFT_CH_CONFIG_WSIZE) |
+                   ((uint32_t)route->read_size << SHIFT_CH_CONFIG_RSIZE);
+        }
+    }
+
+    return ((uint32_t)g_channel_nextcfg_wsize[channel_id] << SHIFT_CH_CONFIG_WSIZE) |
+           ((uint32_t)g_channel_nextcfg_rsize[channel_id] << SHIFT_CH_CONFIG_RSIZE);
+}
+
+/***************************************************************************//**
+ * See mss_pdma.h for description of this function.
+ */
+mss_pdma_error_id_t
+MSS_PDMA_start_transfer
+(
+    mss_pdma_channel_id_t channel_id
+)
+{
+    if (channel_id > MSS_PDMA_CHANNEL_3)
+    {
+        return MSS_PDMA_ERROR_INVALID_CHANNEL_ID;
+    }
+
+    /* Set the register structure pointer for the PDMA channel. */
+    volatile mss_pdma_t *pdmareg = (mss_pdma_t *)MSS_PDMA_REG_OFFSET(channel_id);
+
+    /* If a run transaction is in progress, return error.
+     * Channel can only be claimed when run is low */
+    pdmareg->control_reg |= ((uint32_t)MASK_PDMA_CONTROL_RUN);
+
+    return MSS_PDMA_OK;
+}
+
+/***************************************************************************//**
+ * See mss_pdma.h for description of this function.
+ */
+uint32_t
+MSS_PDMA_get_active_transfer_type
+(
+    mss_pdma_channel_id_t channel_id
+)
+{
+    if (channel_id > MSS_PDMA_CHANNEL_3)
+    {
+        return 0u;
+    }
+
+    /* Set the register structure pointer for the PDMA channel. */
+    volatile mss_pdma_t *pdmareg = (mss_pdma_t *)MSS_PDMA_REG_OFFSET(channel_id);
+
+    return pdmareg->exec_config;
+}
+
+/***************************************************************************//**
+ * See mss_pdma.h for description of this function.
+ */
+uint64_t
+MSS_PDMA_get_number_bytes_remaining
+(
+    mss_pdma_channel_id_t channel_id
+)
+{
+    if (channel_id > MSS_PDMA_CHANNEL_3)
+    {
+        return 0u;
+    }
+
+    /* Set the register structure pointer for the PDMA channel. */
+    volatile mss_pdma_t *pdmareg = (mss_pdma_t *)MSS_PDMA_REG_OFFSET(channel_id);
+
+    return pdmareg->exec_bytes;
+}
+
+/***************************************************************************//**
+ * See mss_pdma.h for description of this function.
+ */
+uint64_t
+MSS_PDMA_get_destination_current_addr
+(
+    mss_pdma_channel_id_t channel_id
+)
+{
+    if (channel_id > MSS_PDMA_CHANNEL_3)
+    {
+        return 0u;
+    }
+
+    /* Set the register structure pointer for the PDMA channel. */
+    volatile mss_pdma_t *pdmareg = (mss_pdma_t *)MSS_PDMA_REG_OFFSET(channel_id);
+
+    return pdmareg->exec_destination;
+}
+
+/***************************************************************************//**
+ * See mss_pdma.h for description of this function.
+ */
+uint64_t
+MSS_PDMA_get_source_current_addr
+(
+    mss_pdma_channel_id_t channel_id
+)
+{
+    if (channel_id > MSS_PDMA_CHANNEL_3)
+    {
+        return 0u;
+    }
+
+    /* Set the register structure pointer for the PDMA channel. */
+    volatile mss_pdma_t *pdmareg = (mss_pdma_t *)MSS_PDMA_REG_OFFSET(channel_id);
+
+    return pdmareg->exec_source;
+}
+
+/***************************************************************************//**
+ * See mss_pdma.h for description of this function.
+ */
+uint8_t
+MSS_PDMA_get_transfer_complete_status
+(
+    mss_pdma_channel_id_t channel_id
+)
+{
+    if (channel_id > MSS_PDMA_CHANNEL_3)
+    {
+        return 0u;
+    }
+
+    /* Set the register structure pointer for the PDMA channel. */
+    volatile mss_pdma_t *pdmareg = (mss_pdma_t *)MSS_PDMA_REG_OFFSET(channel_id);
+
+    if (pdmareg->control_reg & MASK_PDMA_TRANSFER_DONE)
+    {
+        return 1u;
+    }
+    else
+    {
+        return 0u;
+    }
+}
+
+/***************************************************************************//**
+ * See mss_pdma.h for description of this function.
+ */
+uint8_t
+MSS_PDMA_get_transfer_error_status
+(
+    mss_pdma_channel_id_t channel_id
+)
+{
+    if (channel_id > MSS_PDMA_CHANNEL_3)
+    {
+        return 0u;
+    }
+    
+    /* Set the register structure pointer for the PDMA channel. */
+    volatile mss_pdma_t *pdmareg = (mss_pdma_t *)MSS_PDMA_REG_OFFSET(channel_id);
+
+    if (pdmareg->control_reg & MASK_PDMA_TRANSFER_ERROR)
+    {
+        return 1u;
+    }
+    else
+    {
+        return 0u;
+    }
+}
+
+/***************************************************************************//**
+ * See mss_pdma.h for description of this function.
+ */
+uint8_t
+MSS_PDMA_clear_transfer_complete_status
+(
+    mss_pdma_channel_id_t channel_id
+)
+{
+    uint8_t intStatus = 0u;
+
+    if (channel_id > MSS_PDMA_CHANNEL_3)
+    {
+        return 0u;
+    }
+
+    /* Set the register structure pointer for the PDMA channel. */
+    volatile mss_pdma_t *pdmareg = (mss_pdma_t *)MSS_PDMA_REG_OFFSET(channel_id);
+
+    if (pdmareg->control_reg & MASK_PDMA_TRANSFER_DONE)
+    {
+        intStatus = 1u;
+        pdmareg->control_reg &= ~((uint32_t)MASK_PDMA_TRANSFER_DONE);
+    }
+
+    return intStatus;
+}
+
+/***************************************************************************//**
+ * See mss_pdmaF.h for description of this function.
+ */
+uint8_t
+MSS_PDMA_clear_transfer_error_status
+(
+    mss_pdma_channel_id_t channel_id
+)
+{
+    uint8_t intStatus = 0u;
+
+    if (channel_id > MSS_PDMA_CHANNEL_3)
+    {
+        return 0u;
+    }
+
+    /* Set the register structure pointer for the PDMA channel. */
+    volatile mss_pdma_t *pdmareg = (mss_pdma_t *)MSS_PDMA_REG_OFFSET(channel_id);
+
+    if (pdmareg->control_reg & MASK_PDMA_TRANSFER_ERROR)
+    {
+        intStatus = 1u;
+        pdmareg->control_reg &= ~((uint32_t)MASK_PDMA_TRANSFER_ERROR);
+    }
+
+    return intStatus;
+}
+
+/***************************************************************************//**
+ * See mss_pdma.h for description of this function.
+ */
+mss_pdma_error_id_t
+MSS_PDMA_queue_init
+(
+    mss_pdma_channel_id_t channel_id,
+    uint32_t depth,
+    uint8_t force_order
+)
+{
+    mss_pdma_queue_t *queue;
+    uint64_t saved_psr;
+
+    if (channel_id > MSS_PDMA_CHANNEL_3)
+    {
+        return MSS_PDMA_ERROR_INVALID_CHANNEL_ID;
+    }
+
+    queue = &g_pdma_queue[channel_id];
+
+    if ((0u == depth) || (depth > MSS_PDMA_QUEUE_SIZE))
+    {
+        depth = MSS_PDMA_QUEUE_SIZE;
+    }
+
+    /* The queue keeps the channel reserved until MSS_PDMA_queue_release(). */
+    if ((0u == queue->enabled) &&
+        (0u == mpfs_dma_reserve_channel((uint32_t)channel_id)))
+    {
+        return MSS_PDMA_ERROR_CHANNEL_IN_USE;
+    }
+
+    saved_psr = disable_interrupts();
+    spinlock(&queue->lock);
+
+    if (0u != queue->count)
+    {
+        spinunlock(&queue->lock);
+        restore_interrupts(saved_psr);
+        return MSS_PDMA_ERROR_TRANSACTION_IN_PROGRESS;
+    }
+
+    queue->head = 0u;
+    queue->depth = depth;
+    queue->force_order = force_order;
+    queue->completed = 0u;
+    queue->errors = 0u;
+    queue->enabled = 1u;
+
+    spinunlock(&queue->lock);
+    restore_interrupts(saved_psr);
+
+    return MSS_PDMA_OK;
+}
+
+/***************************************************************************//**
+ * See mss_pdma.h for description of this function.
+ */
+mss_pdma_error_id_t
+MSS_PDMA_queue_release
+(
+    mss_pdma_channel_id_t channel_id
+)
+{
+    mss_pdma_queue_t *queue;
+    uint64_t saved_psr;
+    uint8_t enabled;
+
+    if (channel_id > MSS_PDMA_CHANNEL_3)
+    {
+        return MSS_PDMA_ERROR_INVALID_CHANNEL_ID;
+    }
+
+    queue = &g_pdma_queue[channel_id];
+
+    saved_psr = disable_interrupts();
+    spinlock(&queue->lock);
+
+    if (0u != queue->count)
+    {
+        spinunlock(&queue->lock);
+        restore_interrupts(saved_psr);
+        return MSS_PDMA_ERROR_TRANSACTION_IN_PROGRESS;
+    }
+
+    enabled = queue->enabled;
+    queue->enabled = 0u;
+
+    spinunlock(&queue->lock);
+    restore_interrupts(saved_psr);
+
+    if (0u != enabled)
+    {
+        mpfs_dma_release_channel((uint32_t)channel_id);
+    }
+
+    return MSS_PDMA_OK;
+}
+
+/***************************************************************************//**
+ * See mss_pdma.h for description of this function.
+ */
+mss_pdma_error_id_t
+MSS_PDMA_queue_submit
+(
+    mss_pdma_channel_id_t channel_id,
+    uint64_t dest_addr,
+    uint64_t src_addr,
+    uint64_t num_bytes,
+    mss_pdma_queue_handler_t handler,
+    void *user_data
+)
+{
+    mss_pdma_queue_t *queue;
+    mss_pdma_request_t *request;
+    uint64_t saved_psr;
+
+    if (channel_id > MSS_PDMA_CHANNEL_3)
+    {
+        return MSS_PDMA_ERROR_INVALID_CHANNEL_ID;
+    }
+
+    if (src_addr == 0u)
+    {
+        return MSS_PDMA_ERROR_INVALID_SRC_ADDR;
+    }
+
+    if (dest_addr == 0u)
+    {
+        return MSS_PDMA_ERROR_INVALID_DEST_ADDR;
+    }
+
+    queue = &g_pdma_queue[channel_id];
+
+    if (0u == queue->enabled)
+    {
+        return MSS_PDMA_ERROR_QUEUE_NOT_INITIALIZED;
+    }
+
+    /* Masking the local interrupts stops the channel interrupt handler taking
+     * the lock on this hart while it is held here. */
+    saved_psr = disable_interrupts();
+    spinlock(&queue->lock);
+
+    if (queue->count >= queue->depth)
+    {
+        spinunlock(&queue->lock);
+        restore_interrupts(saved_psr);
+        return MSS_PDMA_ERROR_QUEUE_FULL;
+    }
+
+    request = &queue->request[(queue->head + queue->count) % MSS_PDMA_QUEUE_SIZE];
+    request->src_addr = src_addr;
+    request->dest_addr = dest_addr;
+    request->num_bytes = num_bytes;
+    request->handler = handler;
+    request->user_data = user_data;
+
+    queue->count++;
+
+    /* Start the channel if it was idle, otherwise the interrupt handler will
+     * pick this request up when the ones ahead of it are done. */
+    if (1u == queue->count)
+    {
+        pdma_queue_start(channel_id);
+    }
+
+    spinunlock(&queue->lock);
+    restore_interrupts(saved_psr);
+
+    return MSS_PDMA_OK;
+}
+
+/***************************************************************************//**
+ * See mss_pdma.h for description of this function.
+ */
+uint32_t
+MSS_PDMA_queue_get_pending
+(
+    mss_pdma_channel_id_t channel_id
+)
+{
+    if (channel_id > MSS_PDMA_CHANNEL_3)
+    {
+        return 0u;
+    }
+
+    return g_pdma_queue[channel_id].count;
+}
+
+/***************************************************************************//**
+ * See mss_pdma.h for description of this function.
+ */
+uint32_t
+MSS_PDMA_queue_get_error_count
+(
+    mss_pdma_channel_id_t channel_id
+)
+{
+    if (channel_id > MSS_PDMA_CHANNEL_3)
+    {
+        return 0u;
+    }
+
+    return g_pdma_queue[channel_id].errors;
+}
+
+/***************************************************************************//**
+ * See mss_pdma.h for description of this function.
+ */
+mss_pdma_error_id_t
+MSS_PDMA_memcpy_striped
+(
+    mss_pdma_stripe_t *stripe,
+    uint64_t dest_addr,
+    uint64_t src_addr,
+    uint64_t num_bytes,
+    mss_pdma_queue_handler_t handler,
+    void *user_data
+)
+{
+    mss_pdma_channel_id_t idle[MSS_PDMA_lAST_CHANNEL];
+    uint32_t idle_count = 0u;
+    uint32_t stripe_count;
+    uint32_t index;
+    uint64_t stripe_size;
+    uint64_t offset;
+    uint64_t length;
+    uint64_t saved_psr;
+
+    if (src_addr == 0u)
+    {
+        return MSS_PDMA_ERROR_INVALID_SRC_ADDR;
+    }
+
+    if (dest_addr == 0u)
+    {
+        return MSS_PDMA_ERROR_INVALID_DEST_ADDR;
+    }
+
+    /* The stripes would overwrite each other's source data, and a single
+     * PDMA transfer copies upwards, which is wrong when dest is above src. */
+    if ((src_addr < (dest_addr + num_bytes)) &&
+        (dest_addr < (src_addr + num_bytes)))
+    {
+        return MSS_PDMA_ERROR_OVERLAPPING_RANGES;
+    }
+
+    /* A channel is idle if no other software has reserved it, which leaves
+     * out channels driven from a queue set up with MSS_PDMA_queue_init(), and
+     * it is not running a transfer set up with MSS_PDMA_setup_transfer(). */
+    for (index = 0u; index < (uint32_t)MSS_PDMA_lAST_CHANNEL; index++)
+    {
+        volatile mss_pdma_t *pdmareg = (mss_pdma_t *)MSS_PDMA_REG_OFFSET(index);
+
+        if (0u != mpfs_dma_reserve_channel(index))
+        {
+            if (0u == (pdmareg->control_reg & MASK_PDMA_CONTROL_RUN))
+            {
+                idle[idle_count] = (mss_pdma_channel_id_t)index;
+                idle_count++;
+            }
+            else
+            {
+                mpfs_dma_release_channel(index);
+            }
+        }
+    }
+
+    if (0u == idle_count)
+    {
+        return MSS_PDMA_ERROR_TRANSACTION_IN_PROGRESS;
+    }
+
+    stripe_count = idle_count;
+    if (num_bytes < (2u * MSS_PDMA_STRIPE_MIN_SIZE))
+    {
+        stripe_count = 1u;
+    }
+    else if ((num_bytes / MSS_PDMA_STRIPE_MIN_SIZE) < stripe_count)
+    {
+        stripe_count = (uint32_t)(num_bytes / MSS_PDMA_STRIPE_MIN_SIZE);
+    }
+
+    /* Give back the channels which are not needed. */
+    for (index = stripe_count; index < idle_count; index++)
+    {
+        mpfs_dma_release_channel((uint32_t)idle[index]);
+    }
+
+    stripe_size = (num_bytes + stripe_count - 1u) / stripe_count;
+    stripe_size = (stripe_size + MSS_PDMA_STRIPE_ALIGN - 1u) &
+                  ~((uint64_t)MSS_PDMA_STRIPE_ALIGN - 1u);
+
+    stripe->status = MSS_PDMA_OK;
+    stripe->handler = handler;
+    stripe->user_data = user_data;
+    stripe->stripes = stripe_count;
+    stripe->remaining = stripe_count;
+
+    /* Hold off the completion interrupts until every stripe is queued so the
+     * handler cannot run while remaining is still being set up. */
+    saved_psr = disable_interrupts();
+
+    offset = 0u;
+    for (index = 0u; index < stripe_count; index++)
+    {
+        length = num_bytes - offset;
+        if (length > stripe_size)
+        {
+            length = stripe_size;
+        }
+
+        pdma_queue_enable(idle[index], 1u);
+        (void)MSS_PDMA_queue_submit(idle[index],
+                                    dest_addr + offset,
+                                    src_addr + offset,
+                                    length,
+                                    pdma_stripe_done,
+                                    stripe);
+        offset += length;
+    }
+
+    restore_interrupts(saved_psr);
+
+    return MSS_PDMA_OK;
+}
+
+/***************************************************************************//**
+ * Completion handler for each stripe of a striped copy. The channel only
+ * carried this stripe, so it is given back before the copy is reported done.
+ */
+static void
+pdma_stripe_done
+(
+    mss_pdma_channel_id_t channel_id,
+    mss_pdma_error_id_t status,
+    void *user_data
+)
+{
+    mss_pdma_stripe_t *stripe = (mss_pdma_stripe_t *)user_data;
+
+    pdma_queue_enable(channel_id, 0u);
+    mpfs_dma_release_channel((uint32_t)channel_id);
+
+    /*
+     * The stripes complete on different channels, possibly in interrupts on
+     * different harts, so the first error and the count are updated
+     * atomically. Only the last stripe to finish sees remaining reach zero.
+     */
+    if (MSS_PDMA_OK != status)
+    {
+        (void)__sync_val_compare_and_swap(&stripe->status, MSS_PDMA_OK, status);
+    }
+
+    if ((0u == __atomic_sub_fetch(&stripe->remaining, 1u, __ATOMIC_ACQ_REL)) &&
+        (0 != stripe->handler))
+    {
+        stripe->handler(channel_id, stripe->status, stripe->user_data);
+    }
+}
+
+/***************************************************************************//**
+ * Turn the queue of a channel reserved by a striped copy on or off. Unlike
+ * MSS_PDMA_queue_init() this keeps the completed and error counts.
+ */
+static void
+pdma_queue_enable
+(
+    mss_pdma_channel_id_t channel_id,
+    uint8_t enable
+)
+{
+    mss_pdma_queue_t *queue = &g_pdma_queue[channel_id];
+    uint64_t saved_psr;
+
+    saved_psr = disable_interrupts();
+    spinlock(&queue->lock);
+
+    if (0u != enable)
+    {
+        queue->head = 0u;
+        queue->depth = MSS_PDMA_QUEUE_SIZE;
+        queue->force_order = 0u;
+    }
+    queue->enabled = enable;
+
+    spinunlock(&queue->lock);
+    restore_interrupts(saved_psr);
+}
+
+/***************************************************************************//**
+ * Program the request at the head of a channel queue into the Next registers
+ * and start it. Must be called with the queue lock held.
+ */
+static void
+pdma_queue_start
+(
+    mss_pdma_channel_id_t channel_id
+)
+{
+    volatile mss_pdma_t *pdmareg = (mss_pdma_t *)MSS_PDMA_REG_OFFSET(channel_id);
+    mss_pdma_queue_t *queue = &g_pdma_queue[channel_id];
+    mss_pdma_request_t *request = &queue->request[queue->head];
+    uint32_t next_config;
+
+    /* Clear the status of the previous transfer and claim the channel. */
+    pdmareg->control_reg &= ~((uint32_t)(MASK_PDMA_TRANSFER_DONE |
+                                         MASK_PDMA_TRANSFER_ERROR));
+    pdmareg->control_reg |= ((uint32_t)(MASK_CLAIM_PDMA_CHANNEL |
+                                        MASK_PDMA_ENABLE_DONE_INT |
+                                        MASK_PDMA_ENABLE_ERR_INT));
+
+    next_config = pdma_transaction_size(channel_id,
+                                        request->src_addr,
+                                        request->dest_addr,
+                                        request->num_bytes);
+    if (0u != queue->force_order)
+    {
+        next_config |= (uint32_t)MASK_FORCE_ORDERING;
+    }
+
+    pdmareg->next_config      = next_config;
+    pdmareg->next_destination = request->dest_addr;
+    pdmareg->next_source      = request->src_addr;
+    pdmareg->next_bytes       = request->num_bytes;
+
+    pdmareg->control_reg |= ((uint32_t)MASK_PDMA_CONTROL_RUN);
+}
+
+/***************************************************************************//**
+ * Complete the request at the head of a channel queue. The next request is
+ * started before the completion handler is called so the channel is not left
+ * idle while the handler runs. Returns 0 if the channel is not queue driven.
+ */
+static uint8_t
+pdma_queue_irq
+(
+    mss_pdma_channel_id_t channel_id
+)
+{
+    volatile mss_pdma_t *pdmareg = (mss_pdma_t *)MSS_PDMA_REG_OFFSET(channel_id);
+    mss_pdma_queue_t *queue = &g_pdma_queue[channel_id];
+    mss_pdma_request_t done;
+    mss_pdma_error_id_t status = MSS_PDMA_OK;
+
+    spinlock(&queue->lock);
+
+    if ((0u == queue->enabled) || (0u == queue->count))
+    {
+        spinunlock(&queue->lock);
+        return 0u;
+    }
+
+    if (pdmareg->control_reg & MASK_PDMA_TRANSFER_ERROR)
+    {
+        status = MSS_PDMA_ERROR_TRANSFER_FAILED;
+        queue->errors++;
+    }
+    else if (0u == (pdmareg->control_reg & MASK_PDMA_TRANSFER_DONE))
+    {
+        /* Spurious, the transfer is still running. */
+        spinunlock(&queue->lock);
+        return 1u;
+    }
+    else
+    {
+        queue->completed++;
+    }
+
+    done = queue->request[queue->head];
+    queue->head = (queue->head + 1u) % MSS_PDMA_QUEUE_SIZE;
+    queue->count--;
+
+    if (0u != queue->count)
+    {
+        pdma_queue_start(channel_id);
+    }
+    else
+    {
+        pdmareg->control_reg &= ~((uint32_t)(MASK_PDMA_TRANSFER_DONE |
+                                             MASK_PDMA_TRANSFER_ERROR));
+    }
+
+    /* The handler may submit the next request, so it runs unlocked. */
+    spinunlock(&queue->lock);
+
+    if (0 != done.handler)
+    {
+        done.handler(channel_id, status, done.user_data);
+    }
+
+    return 1u;
+}
+
+/***************************************************************************//**
+ * Each DMA channel has two interrupts, one for transfer complete
+ * and the other for the transfer error.
+ */
+uint8_t
+dma_ch0_DONE_IRQHandler
+(
+    void
+)
+{
+    if (0u != pdma_queue_irq(MSS_PDMA_CHANNEL_0))
+    {
+        return 0u;
+    }
+
+    /* Clear the interrupt enable bit. */
+    volatile mss_pdma_t *pdmareg = (mss_pdma_t *)MSS_PDMA_REG_OFFSET
+                                                (MSS_PDMA_CHANNEL_0);
+
+    pdmareg->control_reg &= ~((uint32_t)MASK_PDMA_ENABLE_DONE_INT);
+
+    mss_pdma_isr(PDMA_CH0_DONE_INT);
+
+    return 0u;
+}
+
+uint8_t
+dma_ch0_ERR_IRQHandler
+(
+    void
+)
+{
+    if (0u != pdma_queue_irq(MSS_PDMA_CHANNEL_0))
+    {
+        return 0u;
+    }
+
+    /* Clear the interrupt enable bit. */
+    volatile mss_pdma_t *pdmareg = (mss_pdma_t *)MSS_PDMA_REG_OFFSET
+                                                (MSS_PDMA_CHANNEL_0);
+
+    pdmareg->control_reg &= ~((uint32_t)MASK_PDMA_ENABLE_ERR_INT);
+
+    mss_pdma_isr(PDMA_CH0_ERROR_INT);
+
+    return 0u;
+}
+
+uint8_t
+dma_ch1_DONE_IRQHandler
+(
+    void
+)
+{
+    if (0u != pdma_queue_irq(MSS_PDMA_CHANNEL_1))
+    {
+        return 0u;
+    }
+
+    /* Clear the interrupt enable bit. */
+    volatile mss_pdma_t *pdmareg = (mss_pdma_t *)MSS_PDMA_REG_OFFSET
+                                                (MSS_PDMA_CHANNEL_1);
+
+    pdmareg->control_reg &= ~((uint32_t)MASK_PDMA_ENABLE_DONE_INT);
+
+    mss_pdma_isr(PDMA_CH1_DONE_INT);
+
+    return 0u;
+}
+
+uint8_t
+dma_ch1_ERR_IRQHandler
+(
+    void
+)
+{
+    if (0u != pdma_queue_irq(MSS_PDMA_CHANNEL_1))
+    {
+        return 0u;
+    }
+
+    /* Clear the interrupt enable bit. */
+    volatile mss_pdma_t *pdmareg = (mss_pdma_t *)MSS_PDMA_REG_OFFSET
+                                                (MSS_PDMA_CHANNEL_1);
+
+    pdmareg->control_reg &= ~((uint32_t)MASK_PDMA_ENABLE_ERR_INT);
+
+    mss_pdma_isr(PDMA_CH1_ERROR_INT);
+
+    return 0u;
+}
+
+
+uint8_t
+dma_ch2_DONE_IRQHandler
+(
+    void
+)
+{
+    if (0u != pdma_queue_irq(MSS_PDMA_CHANNEL_2))
+    {
+        return 0u;
+    }
+
+    /* Clear the interrupt enable bit. */
+    volatile mss_pdma_t *pdmareg = (mss_pdma_t *)MSS_PDMA_REG_OFFSET
+                                                (MSS_PDMA_CHANNEL_2);
+
+    pdmareg->control_reg &= ~((uint32_t)MASK_PDMA_ENABLE_DONE_INT);
+
+    mss_pdma_isr(PDMA_CH2_DONE_INT);
+
+    return 0u;
+}
+
+uint8_t
+dma_ch2_ERR_IRQHandler
+(
+    void
+)
+{
+    if (0u != pdma_queue_irq(MSS_PDMA_CHANNEL_2))
+    {
+        return 0u;
+    }
+
+    /* Clear the interrupt enable bit. */
+    volatile mss_pdma_t *pdmareg = (mss_pdma_t *)MSS_PDMA_REG_OFFSET
+                                                (MSS_PDMA_CHANNEL_2);
+
+    pdmareg->control_reg &= ~((uint32_t)MASK_PDMA_ENABLE_ERR_INT);
+
+    mss_pdma_isr(PDMA_CH2_ERROR_INT);
+
+    return 0u;
+}
+
+uint8_t
+dma_ch3_DONE_IRQHandler
+(
+    void
+)
+{
+    if (0u != pdma_queue_irq(MSS_PDMA_CHANNEL_3))
+    {
+        return 0u;
+    }
+
+    /* Clear the interrupt enable bit. */
+    volatile mss_pdma_t *pdmareg = (mss_pdma_t *)MSS_PDMA_REG_OFFSET
+                                                (MSS_PDMA_CHANNEL_3);
+
+    pdmareg->control_reg &= ~((uint32_t)MASK_PDMA_ENABLE_DONE_INT);
+
+    mss_pdma_isr(PDMA_CH3_DONE_INT);
+
+    return 0u;
+}
+
+uint8_t
+dma_ch3_ERR_IRQHandler
+(
+    void
+)
+{
+    if (0u != pdma_queue_irq(MSS_PDMA_CHANNEL_3))
+    {
+        return 0u;
+    }
+
+    /* Clear the interrupt enable bit. */
+    volatile mss_pdma_t *pdmareg = (mss_pdma_t *)MSS_PDMA_REG_OFFSET
+                                                (MSS_PDMA_CHANNEL_3);
+
+    pdmareg->control_reg &= ~((uint32_t)MASK_PDMA_ENABLE_ERR_INT);
+
+    mss_pdma_isr(PDMA_CH3_ERROR_INT);
+
+    return 0u;
+}
+
+#ifdef __cplusplus
+}
+#endif
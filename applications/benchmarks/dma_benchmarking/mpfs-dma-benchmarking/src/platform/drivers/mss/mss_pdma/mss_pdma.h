@@ -128,6 +128,52 @@
   The MSS_PDMA_clear_transfer_error_status() function can be used to clear the
   DMA transfer error status.
 
+  --------------------------------
+  Request queues
+  --------------------------------
+  A channel can instead be driven from a software request queue. After a call
+  to MSS_PDMA_queue_init(), transfers are added with MSS_PDMA_queue_submit(),
+  which returns straight away. When a transfer completes, the channel interrupt
+  handler programs the next queued request into the Next registers and starts
+  it before calling the completion handler of the finished request, so the
+  channel is not left idle between back to back transfers.
+  The number of requests which can be outstanding on a channel is limited by
+  the depth given to MSS_PDMA_queue_init(). MSS_PDMA_queue_submit() returns
+  MSS_PDMA_ERROR_QUEUE_FULL when the limit is reached. A transfer which ends
+  with an error is reported to its completion handler with the status
+  MSS_PDMA_ERROR_TRANSFER_FAILED and the queue moves on to the next request.
+  The done and error interrupts of the channel must be enabled in the PLIC.
+  Each queue is protected by a spinlock, so requests may be submitted from any
+  hart, including the one which takes the channel interrupts.
+  MSS_PDMA_queue_init() reserves the channel with mpfs_dma_reserve_channel()
+  so that the MPFS HAL mpfs_dma_memcpy() service and mss_mem_verify_pdma() do
+  not use it while it is queue driven. MSS_PDMA_queue_release() gives the
+  channel back.
+
+  --------------------------------
+  Transaction size tuning
+  --------------------------------
+  By default every transfer uses the transaction sizes set for its channel
+  with MSS_PDMA_set_transaction_size(). The best sizes depend on the memories
+  being copied between, so a table of routes can be given to the driver with
+  MSS_PDMA_set_route_table(). Each route gives the write and read transaction
+  sizes to use for transfers between a source and destination region which
+  are at least a given number of bytes long. MSS_PDMA_setup_transfer() and the
+  request queues use the first matching route, and fall back to the channel
+  settings if no route matches. The DMA benchmarking application can measure
+  and print a suitable table.
+
+  --------------------------------
+  Striped copies
+  --------------------------------
+  MSS_PDMA_memcpy_striped() splits a large copy into cache line aligned
+  stripes and submits one stripe to each idle channel through the request
+  queues, so that all four channels work on the copy at the same time. A
+  single completion handler is called when the last stripe has finished.
+  Only channels which no other software has reserved are used, and each is
+  reserved until its stripe has finished. Copies between overlapping ranges
+  are rejected.
+
 *//*==========================================================================*/
 #ifndef MSS_PDMA_H
 #define MSS_PDMA_H
@@ -210,6 +256,11 @@ typedef enum __pdma_error_id_t
     MSS_PDMA_ERROR_INVALID_CHANNEL_ID,     //!< ERROR_INVALID_CHANNEL_ID
     MSS_PDMA_ERROR_INVALID_NEXTCFG_WSIZE,  //!< ERROR_INVALID_NEXTCFG_WSIZE
     MSS_PDMA_ERROR_INVALID_NEXTCFG_RSIZE,  //!< ERROR_INVALID_NEXTCFG_RSIZE
+    MSS_PDMA_ERROR_QUEUE_NOT_INITIALIZED,  //!< ERROR_QUEUE_NOT_INITIALIZED
+    MSS_PDMA_ERROR_QUEUE_FULL,             //!< ERROR_QUEUE_FULL
+    MSS_PDMA_ERROR_TRANSFER_FAILED,        //!< ERROR_TRANSFER_FAILED
+    MSS_PDMA_ERROR_CHANNEL_IN_USE,         //!< ERROR_CHANNEL_IN_USE
+    MSS_PDMA_ERROR_OVERLAPPING_RANGES,     //!< ERROR_OVERLAPPING_RANGES
     MSS_PDMA_ERROR_LAST_ID,                //!< ERROR_LAST_ID
 } mss_pdma_error_id_t;
 
@@ -242,6 +293,60 @@ typedef struct _pdmaregs
  */
 typedef void (*mss_pdma_int_handler_t)(uint8_t interrupt_type);
 
+/* Queued request completion handler
+ * A function of this type is called from the channel interrupt handler when a
+ * request submitted with MSS_PDMA_queue_submit() has finished. The status is
+ * MSS_PDMA_OK or MSS_PDMA_ERROR_TRANSFER_FAILED. The user_data parameter is the
+ * value passed to MSS_PDMA_queue_submit().
+ */
+typedef void (*mss_pdma_queue_handler_t)(mss_pdma_channel_id_t channel_id,
+                                         mss_pdma_error_id_t status,
+                                         void *user_data);
+
+/*-------------------------------------------------------------------------*//**
+  The mss_pdma_route_t structure gives the transaction sizes used for
+  transfers from the src_size bytes starting at src_addr to the dest_size bytes
+  starting at dest_addr, of at least min_bytes bytes. write_size and read_size
+  are the base 2 logarithm of the transaction size, as passed to
+  MSS_PDMA_set_transaction_size().
+ */
+typedef struct _pdmaroute
+{
+    uint64_t src_addr;
+    uint64_t src_size;
+    uint64_t dest_addr;
+    uint64_t dest_size;
+    uint64_t min_bytes;
+    uint8_t write_size;
+    uint8_t read_size;
+} mss_pdma_route_t;
+
+/* Maximum number of requests which can be queued on each channel. */
+#ifndef MSS_PDMA_QUEUE_SIZE
+#define MSS_PDMA_QUEUE_SIZE                            16u
+#endif
+
+/* Stripes of a striped copy are aligned to, and never smaller than, these. */
+#define MSS_PDMA_STRIPE_ALIGN                          64u
+#ifndef MSS_PDMA_STRIPE_MIN_SIZE
+#define MSS_PDMA_STRIPE_MIN_SIZE                       4096u
+#endif
+
+/*-------------------------------------------------------------------------*//**
+  The mss_pdma_stripe_t structure holds the state of one striped copy started
+  with MSS_PDMA_memcpy_striped(). It must remain valid until the copy has
+  completed. The remaining member is the number of stripes still in progress
+  and status holds the first error reported by any stripe.
+ */
+typedef struct _pdmastripe
+{
+    volatile uint32_t remaining;
+    volatile mss_pdma_error_id_t status;
+    uint32_t stripes;
+    mss_pdma_queue_handler_t handler;
+    void *user_data;
+} mss_pdma_stripe_t;
+
 /*--------------------------------Public APIs---------------------------------*/
 /*-------------------------------------------------------------------------*//**
   The MSS_PDMA_setup_transfer() function is used to configure an individual
@@ -373,6 +478,47 @@ MSS_PDMA_set_transaction_size
     uint8_t read_size
 );
 
+/*-------------------------------------------------------------------------*//**
+  The MSS_PDMA_set_route_table() function gives the driver a table of
+  transaction sizes to use for transfers between particular memory regions.
+  MSS_PDMA_setup_transfer() and the request queues search the table in order
+  and use the first route which the transfer matches, so routes for larger
+  transfers should come before routes for smaller transfers between the same
+  regions. Transfers which match no route use the channel transaction sizes.
+
+  The table is not copied and must remain valid while it is in use.
+
+  @param routes
+           The routes parameter points to the table. Passing NULL removes the
+           table.
+
+  @param route_count
+           The route_count parameter specifies the number of routes in the
+           table.
+
+   @return
+           The function returns error signals of type mss_pdma_error_id_t.
+           The table is not used if any route has a size above 0x0F.
+
+  Example:
+  The following call uses 64 byte transactions for transfers of 4KB or more
+  from LIM to non-cached DDR.
+  @code
+        static const mss_pdma_route_t routes[] =
+        {
+            {0x08000000u, 0x200000u, 0xC0000000u, 0x10000000u, 4096u, 6u, 6u}
+        };
+
+        MSS_PDMA_set_route_table(routes, 1u);
+  @endcode
+ */
+mss_pdma_error_id_t
+MSS_PDMA_set_route_table
+(
+    const mss_pdma_route_t *routes,
+    uint32_t route_count
+);
+
 /*-------------------------------------------------------------------------*//**
   The MSS_PDMA_get_active_transfer_type() function is used to request active
   transfer type for selected DMA channel.
@@ -616,4 +762,247 @@ MSS_PDMA_clear_transfer_error_status
     mss_pdma_channel_id_t channel_id
 );
 
+/*-------------------------------------------------------------------------*//**
+  The MSS_PDMA_queue_init() function is used to drive a channel from a software
+  request queue. It must be called before MSS_PDMA_queue_submit() is used on
+  the channel and may only be called again once the queue is empty. The first
+  call reserves the channel, and MSS_PDMA_ERROR_CHANNEL_IN_USE is returned if
+  it is already reserved by other software.
+
+  @param channel_id
+           The channel_id parameter specifies the Platform DMA channel.
+
+  @param depth
+           The depth parameter specifies the maximum number of requests which
+           can be outstanding on the channel, including the one being executed.
+           A value of 0 or a value greater than MSS_PDMA_QUEUE_SIZE selects
+           MSS_PDMA_QUEUE_SIZE.
+
+  @param force_order
+           The force_order parameter specifies whether queued transfers are
+           executed with strict ordering, as for the force_order member of
+           mss_pdma_channel_config_t.
+
+  @return
+           The function returns error signals of type mss_pdma_error_id_t.
+
+  Example:
+  @code
+        MSS_PDMA_queue_init(MSS_PDMA_CHANNEL_0, 8u, 0u);
+  @endcode
+ */
+mss_pdma_error_id_t
+MSS_PDMA_queue_init
+(
+    mss_pdma_channel_id_t channel_id,
+    uint32_t depth,
+    uint8_t force_order
+);
+
+/*-------------------------------------------------------------------------*//**
+  The MSS_PDMA_queue_release() function stops a channel being driven from its
+  request queue and releases the reservation taken by MSS_PDMA_queue_init().
+  It may only be called once the queue is empty.
+
+  @param channel_id
+           The channel_id parameter specifies the Platform DMA channel.
+
+  @return
+           The function returns error signals of type mss_pdma_error_id_t.
+           MSS_PDMA_ERROR_TRANSACTION_IN_PROGRESS is returned if requests are
+           still outstanding on the channel.
+
+  Example:
+  @code
+        while (0u != MSS_PDMA_queue_get_pending(MSS_PDMA_CHANNEL_0))
+        {
+            ;
+        }
+        MSS_PDMA_queue_release(MSS_PDMA_CHANNEL_0);
+  @endcode
+ */
+mss_pdma_error_id_t
+MSS_PDMA_queue_release
+(
+    mss_pdma_channel_id_t channel_id
+);
+
+/*-------------------------------------------------------------------------*//**
+  The MSS_PDMA_queue_submit() function is used to add a transfer to the request
+  queue of a channel. The transfer is started immediately if the channel is
+  idle, otherwise it is started from the interrupt handler when the requests
+  ahead of it have completed. The function does not wait for the transfer.
+
+  @param channel_id
+           The channel_id parameter specifies the Platform DMA channel.
+
+  @param dest_addr
+           The dest_addr parameter specifies the destination address.
+
+  @param src_addr
+           The src_addr parameter specifies the source address.
+
+  @param num_bytes
+           The num_bytes parameter specifies the number of bytes to transfer.
+
+  @param handler
+           The handler parameter specifies the function called from the
+           interrupt handler when the transfer has finished. It may be NULL.
+
+  @param user_data
+           The user_data parameter is passed to the handler.
+
+  @return
+           The function returns error signals of type mss_pdma_error_id_t.
+           MSS_PDMA_ERROR_QUEUE_FULL is returned if the depth given to
+           MSS_PDMA_queue_init() has been reached.
+
+  Example:
+  @code
+        static void copy_done(mss_pdma_channel_id_t channel_id,
+                              mss_pdma_error_id_t status,
+                              void *user_data)
+        {
+            if (MSS_PDMA_OK != status)
+            {
+                g_copy_errors++;
+            }
+        }
+
+        for (index = 0u; index < 8u; index++)
+        {
+            while (MSS_PDMA_ERROR_QUEUE_FULL ==
+                   MSS_PDMA_queue_submit(MSS_PDMA_CHANNEL_0,
+                                         dest + (index * 1024u),
+                                         src + (index * 1024u),
+                                         1024u,
+                                         copy_done,
+                                         NULL))
+            {
+                ;
+            }
+        }
+  @endcode
+ */
+mss_pdma_error_id_t
+MSS_PDMA_queue_submit
+(
+    mss_pdma_channel_id_t channel_id,
+    uint64_t dest_addr,
+    uint64_t src_addr,
+    uint64_t num_bytes,
+    mss_pdma_queue_handler_t handler,
+    void *user_data
+);
+
+/*-------------------------------------------------------------------------*//**
+  The MSS_PDMA_queue_get_pending() function returns the number of requests
+  outstanding on a channel, including the one being executed. A value of 0
+  means all submitted transfers have completed.
+
+  @param channel_id
+           The channel_id parameter specifies the Platform DMA channel.
+
+  @return
+           This function returns the number of outstanding requests.
+
+  Example:
+  @code
+        while (0u != MSS_PDMA_queue_get_pending(MSS_PDMA_CHANNEL_0))
+        {
+            ;
+        }
+  @endcode
+ */
+uint32_t
+MSS_PDMA_queue_get_pending
+(
+    mss_pdma_channel_id_t channel_id
+);
+
+/*-------------------------------------------------------------------------*//**
+  The MSS_PDMA_queue_get_error_count() function returns the number of queued
+  transfers on a channel which have ended with an error since the queue was
+  initialized.
+
+  @param channel_id
+           The channel_id parameter specifies the Platform DMA channel.
+
+  @return
+           This function returns the number of failed transfers.
+ */
+uint32_t
+MSS_PDMA_queue_get_error_count
+(
+    mss_pdma_channel_id_t channel_id
+);
+
+/*-------------------------------------------------------------------------*//**
+  The MSS_PDMA_memcpy_striped() function copies a block of memory using all
+  the PDMA channels which are idle when it is called. A channel is idle if it
+  is not running a transfer and is not reserved, for example by a request
+  queue set up with MSS_PDMA_queue_init() or by the MPFS HAL
+  mpfs_dma_memcpy() service. The copy is split into one stripe per idle
+  channel. Each stripe is a multiple of MSS_PDMA_STRIPE_ALIGN bytes, apart
+  from the last, and no stripe is smaller than MSS_PDMA_STRIPE_MIN_SIZE, so
+  small copies use fewer channels. Each channel is reserved until its stripe
+  has finished. The request queue statistics of the channels are not reset.
+
+  The source and destination ranges must not overlap, as the stripes would
+  otherwise overwrite each other's source data.
+
+  The function does not wait for the copy. The handler is called once, from
+  the interrupt handler of the channel which finishes last, with the first
+  error reported by any stripe. The done and error interrupts of all four
+  channels must be enabled in the PLIC and taken on the calling hart.
+
+  @param stripe
+           The stripe parameter points to the state for this copy. It must
+           remain valid until the copy has completed.
+
+  @param dest_addr
+           The dest_addr parameter specifies the destination address.
+
+  @param src_addr
+           The src_addr parameter specifies the source address.
+
+  @param num_bytes
+           The num_bytes parameter specifies the number of bytes to copy.
+
+  @param handler
+           The handler parameter specifies the function called when the whole
+           copy has finished. It may be NULL, in which case the remaining
+           member of the stripe structure can be polled instead.
+
+  @param user_data
+           The user_data parameter is passed to the handler.
+
+  @return
+           The function returns error signals of type mss_pdma_error_id_t.
+           MSS_PDMA_ERROR_TRANSACTION_IN_PROGRESS is returned if no channel is
+           idle. MSS_PDMA_ERROR_OVERLAPPING_RANGES is returned if the source
+           and destination ranges overlap.
+
+  Example:
+  @code
+        mss_pdma_stripe_t stripe;
+
+        MSS_PDMA_memcpy_striped(&stripe, dest, src, 0x100000u, NULL, NULL);
+        while (0u != stripe.remaining)
+        {
+            ;
+        }
+  @endcode
+ */
+mss_pdma_error_id_t
+MSS_PDMA_memcpy_striped
+(
+    mss_pdma_stripe_t *stripe,
+    uint64_t dest_addr,
+    uint64_t src_addr,
+    uint64_t num_bytes,
+    mss_pdma_queue_handler_t handler,
+    void *user_data
+);
+
 #endif  /* MSS_PDMA_H */
@@ -35,6 +35,8 @@ extern "C" {
 
 #define SHIFT_CH_CONFIG_WSIZE                          24U
 #define SHIFT_CH_CONFIG_RSIZE                          28U
+#define MASK_CH_CONFIG_WSIZE                           0x0F000000U
+#define MASK_CH_CONFIG_RSIZE                           0xF0000000U
 
 /* MSS PDMA next config reg repeat bit mask */
 #define MASK_REPEAT_TRANSCTION                         0x04U
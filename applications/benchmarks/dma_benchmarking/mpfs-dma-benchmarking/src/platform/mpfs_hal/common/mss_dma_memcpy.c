@@ -0,0 +1,298 @@
+/*******************************************************************************
+ * Copyright 2019-2023 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software
+ *
+ */
+
+/***************************************************************************
+ * @file mss_dma_memcpy.c
+ * @author Microchip-FPGA Embedded Systems Solutions
+ * @brief memcpy() and memset() using the PDMA, callable from any hart
+ *
+ */
+#include <string.h>
+#include "mpfs_hal/mss_hal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Local defines
+ */
+#define PDMA_BASE_ADDRESS           0x3000000ULL
+#define PDMA_CHANNEL_OFFSET         0x1000ULL
+#define PDMA_NUM_CHANNELS           4U
+
+/* Channel control register bits */
+#define PDMA_CONTROL_RUN            0x02U
+#define PDMA_CONTROL_ERROR          0x80000000U
+
+#define L2_LINE_SIZE                64U
+
+/* Non-cached DDR windows, 32 and 64 bit */
+#define NON_CACHED_32_START         0xC0000000ULL
+#define NON_CACHED_32_END           0x100000000ULL
+#define NON_CACHED_64_START         0x1400000000ULL
+#define NON_CACHED_64_END           0x1800000000ULL
+
+/*
+ * External function declarations, see mss_utils.S
+ */
+extern void pdma_transfer(uint64_t destination, uint64_t source, uint64_t size_in_bytes, uint64_t base_address);
+
+/*
+ * Local data, shared by all harts
+ */
+static volatile uint32_t g_dma_channels_owned = 0U;
+static volatile size_t g_dma_threshold = MPFS_DMA_MEMCPY_THRESHOLD;
+
+/***************************************************************************//**
+ * Takes ownership of a free channel from MPFS_DMA_MEMCPY_CHANNELS. Returns the
+ * channel number, or PDMA_NUM_CHANNELS if all are owned by other callers.
+ */
+static uint32_t acquire_channel(void)
+{
+    volatile uint32_t *control;
+    uint32_t channel;
+
+    for (channel = 0U; channel < PDMA_NUM_CHANNELS; channel++)
+    {
+        if ((0U != (MPFS_DMA_MEMCPY_CHANNELS & (1U << channel))) &&
+            (0U != mpfs_dma_reserve_channel(channel)))
+        {
+            /* Skip a channel running a transfer set up without a reservation */
+            control = (volatile uint32_t *)(PDMA_BASE_ADDRESS +
+                                            (PDMA_CHANNEL_OFFSET * channel));
+            if (0U == (*control & PDMA_CONTROL_RUN))
+            {
+                return channel;
+            }
+
+            mpfs_dma_release_channel(channel);
+        }
+    }
+
+    return PDMA_NUM_CHANNELS;
+}
+
+/***************************************************************************//**
+ * If the range is in a non-cached DDR window, writes back and invalidates the
+ * L2 lines of the same memory in the cached window.
+ */
+static void flush_cached_alias(uint64_t address, uint64_t length)
+{
+    uint64_t offset = 0ULL;
+    uint64_t line;
+    uint64_t end;
+
+    if ((address >= NON_CACHED_32_START) && (address < NON_CACHED_32_END))
+    {
+        offset = MPFS_DMA_NON_CACHED_32_OFFSET;
+    }
+    else if ((address >= NON_CACHED_64_START) && (address < NON_CACHED_64_END))
+    {
+        offset = MPFS_DMA_NON_CACHED_64_OFFSET;
+    }
+    else
+    {
+        return;
+    }
+
+    line = (address - offset) & ~((uint64_t)L2_LINE_SIZE - 1U);
+    end = (address - offset) + length;
+
+    mb(); /* Make sure our stores have reached the L2 before flushing */
+    while (line < end)
+    {
+        CACHE_CTRL->FLUSH64 = line;
+        line += L2_LINE_SIZE;
+    }
+    mb();
+}
+
+/***************************************************************************//**
+ * Copies with the PDMA channel owned by the caller. Returns 0 on success or 1
+ * if the PDMA reported an error.
+ */
+static uint32_t channel_copy(uint32_t channel, uint64_t dest, uint64_t src, uint64_t n)
+{
+    uint64_t base = PDMA_BASE_ADDRESS + (PDMA_CHANNEL_OFFSET * channel);
+    volatile uint32_t *control = (volatile uint32_t *)base;
+    uint32_t status;
+
+    mb(); /* Data written by the CPU must be visible to the PDMA */
+    pdma_transfer(dest, src, n, base);
+
+    do
+    {
+        status = *control;
+    } while (0U != (status & PDMA_CONTROL_RUN));
+
+    /* Release the channel, which also clears the done and error bits */
+    *control = 0U;
+    mb();
+
+    return (0U != (status & PDMA_CONTROL_ERROR)) ? 1U : 0U;
+}
+
+/***************************************************************************//**
+ * See mss_dma_memcpy.h for details of how to use this function.
+ */
+void *
+mpfs_dma_memcpy
+(
+    void *dest,
+    const void *src,
+    size_t n
+)
+{
+    uint32_t channel = PDMA_NUM_CHANNELS;
+
+    if (n >= g_dma_threshold)
+    {
+        channel = acquire_channel();
+    }
+
+    if (PDMA_NUM_CHANNELS == channel)
+    {
+        return memcpy(dest, src, n);
+    }
+
+    flush_cached_alias((uint64_t)src, n);
+    flush_cached_alias((uint64_t)dest, n);
+
+    if (0U != channel_copy(channel, (uint64_t)dest, (uint64_t)src, n))
+    {
+        (void)memcpy(dest, src, n);
+    }
+
+    /* Lines fetched through the cached window during the copy are stale */
+    flush_cached_alias((uint64_t)dest, n);
+
+    mpfs_dma_release_channel(channel);
+
+    return dest;
+}
+
+/***************************************************************************//**
+ * See mss_dma_memcpy.h for details of how to use this function.
+ */
+void *
+mpfs_dma_memset
+(
+    void *dest,
+    int c,
+    size_t n
+)
+{
+    uint8_t *p_dest = (uint8_t *)dest;
+    uint32_t channel = PDMA_NUM_CHANNELS;
+    size_t filled;
+    size_t chunk;
+
+    if ((n >= g_dma_threshold) && (n > MPFS_DMA_MEMSET_SEED_SIZE))
+    {
+        channel = acquire_channel();
+    }
+
+    if (PDMA_NUM_CHANNELS == channel)
+    {
+        return memset(dest, c, n);
+    }
+
+    flush_cached_alias((uint64_t)dest, n);
+
+    filled = MPFS_DMA_MEMSET_SEED_SIZE;
+    (void)memset(p_dest, c, filled);
+
+    /* Each copy doubles the filled region, source and destination never overlap */
+    while (filled < n)
+    {
+        chunk = ((n - filled) < filled) ? (n - filled) : filled;
+        if (0U != channel_copy(channel, (uint64_t)(p_dest + filled), (uint64_t)p_dest, chunk))
+        {
+            (void)memset(p_dest + filled, c, n - filled);
+            break;
+        }
+        filled += chunk;
+    }
+
+    flush_cached_alias((uint64_t)dest, n);
+
+    mpfs_dma_release_channel(channel);
+
+    return dest;
+}
+
+/***************************************************************************//**
+ * See mss_dma_memcpy.h for details of how to use this function.
+ */
+uint8_t
+mpfs_dma_reserve_channel
+(
+    uint32_t channel
+)
+{
+    uint32_t mask;
+
+    if (channel >= PDMA_NUM_CHANNELS)
+    {
+        return 0U;
+    }
+
+    mask = 1U << channel;
+    if ((0U != (g_dma_channels_owned & mask)) ||
+        (0U != (__sync_fetch_and_or(&g_dma_channels_owned, mask) & mask)))
+    {
+        return 0U;
+    }
+
+    return 1U;
+}
+
+/***************************************************************************//**
+ * See mss_dma_memcpy.h for details of how to use this function.
+ */
+void
+mpfs_dma_release_channel
+(
+    uint32_t channel
+)
+{
+    if (channel < PDMA_NUM_CHANNELS)
+    {
+        (void)__sync_fetch_and_and(&g_dma_channels_owned, ~(1U << channel));
+    }
+}
+
+/***************************************************************************//**
+ * See mss_dma_memcpy.h for details of how to use this function.
+ */
+void
+mpfs_dma_set_threshold
+(
+    size_t threshold
+)
+{
+    g_dma_threshold = threshold;
+}
+
+/***************************************************************************//**
+ * See mss_dma_memcpy.h for details of how to use this function.
+ */
+size_t
+mpfs_dma_get_threshold
+(
+    void
+)
+{
+    return g_dma_threshold;
+}
+
+#ifdef __cplusplus
+}
+#endif
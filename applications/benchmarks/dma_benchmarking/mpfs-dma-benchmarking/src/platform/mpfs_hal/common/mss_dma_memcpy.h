@@ -0,0 +1,167 @@
+/*******************************************************************************
+ * Copyright 2019-2023 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software
+ *
+ */
+
+/***************************************************************************
+ * @file mss_dma_memcpy.h
+ * @author Microchip-FPGA Embedded Systems Solutions
+ * @brief memcpy() and memset() using the PDMA, callable from any hart
+ *
+ */
+#ifndef MSS_DMA_MEMCPY_H
+#define MSS_DMA_MEMCPY_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * PDMA channels the service may use, one bit per channel. None are used by
+ * default, so every copy is made by the CPU until channels are set aside for
+ * the service by defining MPFS_DMA_MEMCPY_CHANNELS in mss_sw_config.h. A
+ * channel in the mask is only used while no other software has reserved it
+ * with mpfs_dma_reserve_channel() and no transfer is running on it.
+ */
+#ifndef MPFS_DMA_MEMCPY_CHANNELS
+#define MPFS_DMA_MEMCPY_CHANNELS        0x00U
+#endif
+
+/*
+ * Copies shorter than this are done by the CPU. The default can be replaced
+ * with the crossover measured on the target by the DMA benchmarking
+ * application, or changed at run time with mpfs_dma_set_threshold().
+ */
+#ifndef MPFS_DMA_MEMCPY_THRESHOLD
+#define MPFS_DMA_MEMCPY_THRESHOLD       4096U
+#endif
+
+/*
+ * mpfs_dma_memset() fills this many bytes with the CPU and then doubles the
+ * filled region with PDMA copies.
+ */
+#ifndef MPFS_DMA_MEMSET_SEED_SIZE
+#define MPFS_DMA_MEMSET_SEED_SIZE       256U
+#endif
+
+/*
+ * Distance from the non-cached DDR windows to the cached windows of the same
+ * memory, see the SEG registers configured in the MSS Configurator.
+ */
+#ifndef MPFS_DMA_NON_CACHED_32_OFFSET
+#define MPFS_DMA_NON_CACHED_32_OFFSET   0x40000000ULL
+#endif
+#ifndef MPFS_DMA_NON_CACHED_64_OFFSET
+#define MPFS_DMA_NON_CACHED_64_OFFSET   0x400000000ULL
+#endif
+
+/***************************************************************************//**
+ * Copies n bytes from src to dest and returns dest, as memcpy().
+ *
+ * Copies of at least the threshold are made by a free PDMA channel from
+ * MPFS_DMA_MEMCPY_CHANNELS, which the calling hart reserves until the copy is
+ * complete. If every channel is busy, or the copy is below the threshold, it
+ * is made by the CPU instead. A copy which the PDMA ends with an error is
+ * made again by the CPU. The function returns once the copy is complete.
+ *
+ * The PDMA is coherent with the L1 and L2 caches for the cached address
+ * windows, the L2 scratchpad and the LIMs. A range given by its address in a
+ * non-cached DDR window bypasses the L2, so the lines of the same memory in
+ * the cached window are flushed before the copy, and for the destination
+ * again after it. Cached data is then never stale, or written back over
+ * the copy.
+ *
+ * @param dest  destination address
+ * @param src   source address
+ * @param n     number of bytes to copy. The ranges must not overlap.
+ * @return dest
+ */
+void *
+mpfs_dma_memcpy
+(
+    void *dest,
+    const void *src,
+    size_t n
+);
+
+/***************************************************************************//**
+ * Sets n bytes at dest to the value c and returns dest, as memset().
+ *
+ * Fills of at least the threshold start with MPFS_DMA_MEMSET_SEED_SIZE bytes
+ * filled by the CPU. The filled region is then copied onto the following
+ * bytes by the PDMA, doubling in size each time, with the same channel
+ * sharing and cache maintenance as mpfs_dma_memcpy().
+ *
+ * @param dest  destination address
+ * @param c     fill value
+ * @param n     number of bytes to fill
+ * @return dest
+ */
+void *
+mpfs_dma_memset
+(
+    void *dest,
+    int c,
+    size_t n
+);
+
+/***************************************************************************//**
+ * Reserves a PDMA channel for the caller. Channels are shared between harts,
+ * and between mpfs_dma_memcpy(), the PDMA driver request queues and
+ * mss_mem_verify_pdma(), with an atomic ownership mask, so no channel is used
+ * by two of them at once.
+ *
+ * @param channel   PDMA channel, 0 to 3
+ * @return 1 if the channel was reserved, 0 if it is already reserved
+ */
+uint8_t
+mpfs_dma_reserve_channel
+(
+    uint32_t channel
+);
+
+/***************************************************************************//**
+ * Releases a channel reserved with mpfs_dma_reserve_channel().
+ *
+ * @param channel   PDMA channel, 0 to 3
+ */
+void
+mpfs_dma_release_channel
+(
+    uint32_t channel
+);
+
+/***************************************************************************//**
+ * Sets the size below which mpfs_dma_memcpy() and mpfs_dma_memset() use the
+ * CPU. Zero sends every request to the PDMA, which is how the crossover is
+ * measured.
+ *
+ * @param threshold size in bytes
+ */
+void
+mpfs_dma_set_threshold
+(
+    size_t threshold
+);
+
+/***************************************************************************//**
+ * Returns the size below which the CPU is used.
+ */
+size_t
+mpfs_dma_get_threshold
+(
+    void
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MSS_DMA_MEMCPY_H */
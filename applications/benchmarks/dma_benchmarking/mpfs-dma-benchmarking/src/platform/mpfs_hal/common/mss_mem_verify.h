@@ -0,0 +1,132 @@
+/*******************************************************************************
+ * Copyright 2019-2023 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software
+ *
+ */
+
+/***************************************************************************
+ * @file mss_mem_verify.h
+ * @author Microchip-FPGA Embedded Systems Solutions
+ * @brief Fast memory compare and fingerprint functions used to verify the
+ * result of DMA transfers and memory tests
+ *
+ */
+#ifndef MSS_MEM_VERIFY_H
+#define MSS_MEM_VERIFY_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define MSS_MEM_VERIFY_OK           0U
+#define MSS_MEM_VERIFY_MISMATCH     1U
+
+/* Initial value to pass to mss_mem_crc32c() */
+#define MSS_MEM_CRC32C_INIT         0U
+
+/***************************************************************************//**
+ * Compares length bytes at actual with the bytes at expected.
+ *
+ * Buffers with the same alignment within a 64 bit word are compared 32 bytes
+ * at a time using 64 bit loads. Other buffers are compared a byte at a time.
+ * A fence is issued once before the compare so that data written by a DMA
+ * master which has signalled completion is seen.
+ *
+ * @param expected  the reference data
+ * @param actual    the data to check
+ * @param length    the number of bytes to compare
+ * @param p_mismatch_offset if not NULL, set to the offset of the first byte
+ *                  which differs when MSS_MEM_VERIFY_MISMATCH is returned
+ * @return MSS_MEM_VERIFY_OK or MSS_MEM_VERIFY_MISMATCH
+ */
+uint32_t
+mss_mem_verify
+(
+    const void *expected,
+    const void *actual,
+    uint64_t length,
+    uint64_t *p_mismatch_offset
+);
+
+/***************************************************************************//**
+ * Compares length bytes at actual with the bytes at expected, using a PDMA
+ * channel to copy actual into a staging buffer a block at a time. The compare
+ * of each block runs while the next block is being copied.
+ *
+ * This is faster than mss_mem_verify() when actual is in memory which is slow
+ * for the CPU to read, such as non-cached DDR or the fabric, and the staging
+ * buffer is in fast memory such as LIM or scratchpad. The channel is reserved
+ * with mpfs_dma_reserve_channel() for the length of the check and is used
+ * without interrupts. If it is already reserved, or is running a transfer,
+ * the check is made by mss_mem_verify() instead.
+ *
+ * @param expected  the reference data
+ * @param actual    the data to check
+ * @param length    the number of bytes to compare
+ * @param p_mismatch_offset as for mss_mem_verify()
+ * @param staging   buffer of staging_size bytes, 8 byte aligned
+ * @param staging_size size of the staging buffer, at least 16 bytes. Half of it
+ *                  is filled by each PDMA transfer.
+ * @param pdma_channel the PDMA channel to use, 0 to 3
+ * @return MSS_MEM_VERIFY_OK or MSS_MEM_VERIFY_MISMATCH
+ */
+uint32_t
+mss_mem_verify_pdma
+(
+    const void *expected,
+    const void *actual,
+    uint64_t length,
+    uint64_t *p_mismatch_offset,
+    uint64_t *staging,
+    uint64_t staging_size,
+    uint8_t pdma_channel
+);
+
+/***************************************************************************//**
+ * Updates a CRC32C (Castagnoli) checksum with length bytes at data. Pass
+ * MSS_MEM_CRC32C_INIT to start a new checksum. The result of one call can be
+ * passed to the next to checksum data in pieces.
+ *
+ * A fingerprint lets data be checked without keeping a second copy, for
+ * example when the expected data was produced by the fabric.
+ *
+ * @param crc       the checksum so far
+ * @param data      the data
+ * @param length    the number of bytes
+ * @return the updated checksum
+ */
+uint32_t
+mss_mem_crc32c
+(
+    uint32_t crc,
+    const void *data,
+    uint64_t length
+);
+
+/***************************************************************************//**
+ * Checks length bytes at actual against a CRC32C fingerprint of the expected
+ * data. The location of a mismatch is not known in this mode.
+ *
+ * @param expected_crc the mss_mem_crc32c() result for the expected data
+ * @param actual    the data to check
+ * @param length    the number of bytes
+ * @return MSS_MEM_VERIFY_OK or MSS_MEM_VERIFY_MISMATCH
+ */
+uint32_t
+mss_mem_verify_crc32c
+(
+    uint32_t expected_crc,
+    const void *actual,
+    uint64_t length
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MSS_MEM_VERIFY_H */
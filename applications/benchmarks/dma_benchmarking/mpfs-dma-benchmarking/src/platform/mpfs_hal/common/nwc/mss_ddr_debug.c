@@ -789,7 +789,6 @@ uint32_t test_ddr(uint32_t no_of_iterations, volatile PATTERN_TEST_PARAMS *patte
     uint32_t pattern_length = sizeof(ddr_test_pattern) - (3 * sizeof(uint32_t));
     uint32_t * p_ddr_cached = (uint32_t *)BASE_ADDRESS_CACHED_32_DDR;
     uint32_t * p_ddr_noncached = (uint32_t *)BASE_ADDRESS_NON_CACHED_64_DDR;
-    uint32_t word_offset;
     uint32_t alive = 0;
     uint32_t alive_idx = 0U;
     uint32_t iteration = 0U;
@@ -801,30 +800,23 @@ uint32_t test_ddr(uint32_t no_of_iterations, volatile PATTERN_TEST_PARAMS *patte
 #endif
     while(iteration < no_of_iterations)
     {
-        int different = 0;
+        uint64_t mismatch_offset = 0U;
 
         load_test_buffers(p_ddr_cached, p_ddr_noncached, pattern_length);
 
-        different = memcmp(g_test_buffer_cached, g_test_buffer_not_cached, pattern_length);
-
-        if(different != 0)
+        if(mss_mem_verify(g_test_buffer_not_cached, g_test_buffer_cached, pattern_length, &mismatch_offset) != MSS_MEM_VERIFY_OK)
         {
-            for(word_offset = 0; word_offset < (pattern_length / sizeof(uint32_t)); word_offset++)
-            {
-                if(g_test_buffer_cached[word_offset] != g_test_buffer_not_cached[word_offset])
-                {
 #ifdef DEBUG_DDR_INIT
-                    uprint64(g_debug_uart, "  Mismatch, 0x", (uint64_t)p_ddr_cached);
-                    uprint32(g_debug_uart, "  offset:, 0x", (uint64_t)word_offset);
-                    uprint64(g_debug_uart, "  address: 0x", (uint64_t)(p_ddr_cached + word_offset));
-                    uprint32(g_debug_uart, "  expected (non-cached): 0x", g_test_buffer_not_cached[word_offset]);
-                    uprint32(g_debug_uart, "  found  (cached): 0x", (uint64_t)g_test_buffer_cached[word_offset]);
-                    uprint32(g_debug_uart, "  direct cached read: 0x", (uint32_t)*(p_ddr_cached + word_offset));
-                    uprint32(g_debug_uart, "  direct non-cached read: 0x", (uint32_t)*(p_ddr_noncached + word_offset));
+            uint32_t word_offset = (uint32_t)(mismatch_offset / sizeof(uint32_t));
+
+            uprint64(g_debug_uart, "  Mismatch, 0x", (uint64_t)p_ddr_cached);
+            uprint32(g_debug_uart, "  offset:, 0x", (uint64_t)word_offset);
+            uprint64(g_debug_uart, "  address: 0x", (uint64_t)(p_ddr_cached + word_offset));
+            uprint32(g_debug_uart, "  expected (non-cached): 0x", g_test_buffer_not_cached[word_offset]);
+            uprint32(g_debug_uart, "  found  (cached): 0x", (uint64_t)g_test_buffer_cached[word_offset]);
+            uprint32(g_debug_uart, "  direct cached read: 0x", (uint32_t)*(p_ddr_cached + word_offset));
+            uprint32(g_debug_uart, "  direct non-cached read: 0x", (uint32_t)*(p_ddr_noncached + word_offset));
 #endif
-                    break;
-                }
-            }
             error = 1U;
             return error;
         }
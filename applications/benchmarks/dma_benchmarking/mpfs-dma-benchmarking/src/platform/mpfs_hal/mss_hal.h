@@ -63,6 +63,8 @@ typedef long            ssize_t;
 #include "common/mss_util.h"
 #include "common/mss_mtrap.h"
 #include "common/mss_l2_cache.h"
+#include "common/mss_mem_verify.h"
+#include "common/mss_dma_memcpy.h"
 #include "common/mss_axiswitch.h"
 #include "common/mss_peripherals.h"
 #include "common/nwc/mss_cfm.h"
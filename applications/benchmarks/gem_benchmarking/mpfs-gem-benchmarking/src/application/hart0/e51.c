@@ -0,0 +1,847 @@
+/*******************************************************************************
+ * Copyright 2023 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * GEM benchmarking application running on the E51.
+ *
+ * Runs an RFC 2544 style throughput and latency sweep over the MSS Ethernet
+ * MAC using internal or external loopback. Results are printed on the UART as
+ * comma separated lines so that runs against different driver builds can be
+ * captured and compared.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "mpfs_hal/mss_hal.h"
+#include "drivers/mss/mss_gpio/mss_gpio.h"
+#include "drivers/mss/mss_mmuart/mss_uart.h"
+
+#include "drivers/mss/mss_ethernet_mac/mss_ethernet_registers.h"
+#include "drivers/mss/mss_ethernet_mac/mss_ethernet_mac_sw_cfg.h"
+#include "drivers/mss/mss_ethernet_mac/mss_ethernet_mac_regs.h"
+#include "drivers/mss/mss_ethernet_mac/mss_ethernet_mac.h"
+#include "drivers/mss/mss_ethernet_mac/phy.h"
+#include "inc/common.h"
+#include "gem_benchmarking_config.h"
+
+#if !((MSS_MAC_HW_PLATFORM == MSS_MAC_DESIGN_ICICLE_SGMII_GEM1) || \
+      (MSS_MAC_HW_PLATFORM == MSS_MAC_DESIGN_ICICLE_SGMII_GEM0) || \
+      (MSS_MAC_HW_PLATFORM == MSS_MAC_DESIGN_ICICLE_STD_GEM1) || \
+      (MSS_MAC_HW_PLATFORM == MSS_MAC_DESIGN_ICICLE_STD_GEM0))
+#error "The GEM benchmarking application only supports the Icicle Kit designs"
+#endif
+
+#define DEMO_UART       &g_mss_uart0_lo
+#define PRINT_STRING(x) MSS_UART_polled_tx_string(DEMO_UART, (uint8_t *)x);
+
+/*
+ * Benchmark frame layout. Frames are addressed to ourselves so they are
+ * accepted in both internal and external loopback.
+ */
+#define BENCH_ETHERTYPE        (0x88B5U) /* IEEE local experimental */
+#define BENCH_MAGIC            (0x47454D42UL) /* "GEMB" */
+#define BENCH_OFFSET_TYPE      (12U)
+#define BENCH_OFFSET_MAGIC     (14U)
+#define BENCH_OFFSET_TRIAL     (18U)
+#define BENCH_OFFSET_SEQ       (22U)
+#define BENCH_FCS_SIZE         (4U)
+
+/* Per frame overhead on the wire: preamble + SFD and the minimum IPG */
+#define BENCH_PREAMBLE_SIZE    (8U)
+#define BENCH_MIN_IPG_SIZE     (12U)
+
+#define BENCH_TX_BATCH         (MSS_MAC_TX_RING_SIZE - 1U)
+
+/* A cost measurement burst must fit in the receive ring as it is not polled */
+#if BENCH_TX_BATCH < MSS_MAC_RX_RING_SIZE
+#define BENCH_COST_BATCH       BENCH_TX_BATCH
+#else
+#define BENCH_COST_BATCH       MSS_MAC_RX_RING_SIZE
+#endif
+
+/* Where the driver places the descriptor rings and packet buffers */
+#if !defined(MSS_MAC_USE_DDR)
+#define BENCH_PLACEMENT        "static"
+#elif MSS_MAC_USE_DDR == MSS_MAC_MEM_DDR
+#define BENCH_PLACEMENT        "ddr-noncached"
+#elif MSS_MAC_USE_DDR == MSS_MAC_MEM_FIC0
+#define BENCH_PLACEMENT        "fic0"
+#elif MSS_MAC_USE_DDR == MSS_MAC_MEM_FIC1
+#define BENCH_PLACEMENT        "fic1"
+#elif MSS_MAC_USE_DDR == MSS_MAC_MEM_CRYPTO
+#define BENCH_PLACEMENT        "crypto"
+#elif MSS_MAC_USE_DDR == MSS_MAC_MEM_SCRATCHPAD
+#define BENCH_PLACEMENT        "scratchpad"
+#elif MSS_MAC_USE_DDR == MSS_MAC_MEM_CACHED_DDR
+#define BENCH_PLACEMENT        "ddr-cached"
+#else
+#define BENCH_PLACEMENT        "unknown"
+#endif
+
+#define PROBE_IDLE             0
+#define PROBE_ARMED            1
+#define PROBE_DONE             2
+
+typedef struct gem_bench_trial
+{
+    uint32_t frame_size;    /* Frame size including FCS */
+    uint32_t permille;      /* Offered load requested */
+    uint32_t tx_frames;     /* Frames the driver accepted */
+    uint32_t tx_done;       /* Frames the driver reported as sent */
+    uint32_t rx_frames;     /* Frames received back for this trial */
+    uint32_t rx_resource;   /* RX used bit read errors during the trial */
+    uint32_t rx_overruns;   /* RX FIFO overruns during the trial */
+    uint64_t duration_ns;   /* First transmit to last transmit completion */
+} gem_bench_trial_t;
+
+typedef struct gem_bench_latency
+{
+    uint32_t frame_size;
+    uint32_t count;
+    uint32_t lost;
+    uint64_t min_ns;
+    uint64_t max_ns;
+    uint64_t total_ns;
+} gem_bench_latency_t;
+
+/*
+ * With MSS_MAC_USE_DDR the packet buffers are allocated from the same memory
+ * region as the descriptor rings so the whole data path is in the placement
+ * under test.
+ */
+#if defined(MSS_MAC_USE_DDR)
+static uint8_t *g_mac_rx_buffer;
+static uint8_t *g_tx_frame;
+static uint8_t *g_probe_frame;
+#else
+static uint8_t g_mac_rx_buffer[MSS_MAC_RX_RING_SIZE * MSS_MAC_MAX_RX_BUF_SIZE]
+    __attribute__((aligned(MSS_MAC_CACHE_LINE_SIZE)));
+
+static uint8_t g_tx_frame[MSS_MAC_MAX_PACKET_SIZE]
+    __attribute__((aligned(MSS_MAC_CACHE_LINE_SIZE)));
+static uint8_t g_probe_frame[MSS_MAC_MAX_PACKET_SIZE]
+    __attribute__((aligned(MSS_MAC_CACHE_LINE_SIZE)));
+#endif
+static mss_mac_tx_pkt_info_t g_tx_list[BENCH_TX_BATCH];
+
+static const uint32_t g_frame_sizes[] = GEM_BENCH_FRAME_SIZES;
+
+mss_mac_cfg_t g_mac_config;
+mss_mac_instance_t *g_test_mac = &g_mac1;
+
+volatile uint64_t g_tick_counter = 0;
+
+static volatile uint32_t g_trial_id = 0U;
+static volatile uint32_t g_tx_done = 0U;
+static volatile uint32_t g_rx_frames = 0U;
+static volatile uint32_t g_rx_stale = 0U;
+
+static volatile int g_probe_state = PROBE_IDLE;
+static volatile uint32_t g_probe_seq = 0U;
+static volatile uint64_t g_probe_rx_ns = 0U;
+
+static char info_string[200];
+
+/**=============================================================================
+ * Frame field helpers - fields are big endian and not necessarily aligned.
+ */
+static void
+put_u32(uint8_t *p_field, uint32_t value)
+{
+    p_field[0] = (uint8_t)(value >> 24);
+    p_field[1] = (uint8_t)(value >> 16);
+    p_field[2] = (uint8_t)(value >> 8);
+    p_field[3] = (uint8_t)value;
+}
+
+static uint32_t
+get_u32(const uint8_t *p_field)
+{
+    return ((uint32_t)p_field[0] << 24) | ((uint32_t)p_field[1] << 16) |
+           ((uint32_t)p_field[2] << 8) | (uint32_t)p_field[3];
+}
+
+/**=============================================================================
+ * Current TSU time in nanoseconds.
+ */
+static uint64_t
+tsu_now_ns(void)
+{
+    mss_mac_tsu_time_t tsu_time;
+
+    MSS_MAC_read_TSU(g_test_mac, &tsu_time);
+
+    return ((((uint64_t)tsu_time.secs_msb << 32) | tsu_time.secs_lsb) * 1000000000ULL) +
+           tsu_time.nanoseconds;
+}
+
+/**=============================================================================
+ * Transmit completion handler, called once per frame.
+ */
+static void
+packet_tx_complete_handler(/* mss_mac_instance_t*/ void *this_mac,
+                           uint32_t queue_no,
+                           mss_mac_tx_desc_t *cdesc,
+                           void *caller_info)
+{
+    (void)this_mac;
+    (void)queue_no;
+    (void)cdesc;
+    (void)caller_info;
+
+    g_tx_done++;
+}
+
+/**=============================================================================
+ * Receive handler. Counts frames belonging to the current trial and timestamps
+ * latency probes, then hands the buffer straight back to the driver.
+ */
+static void
+mac_rx_callback(
+    /* mss_mac_instance_t */ void *this_mac,
+    uint32_t queue_no,
+    uint8_t *p_rx_packet,
+    uint32_t pckt_length,
+    mss_mac_rx_desc_t *cdesc,
+    void *caller_info)
+{
+    (void)queue_no;
+    (void)cdesc;
+    (void)caller_info;
+
+    if ((pckt_length >= (BENCH_OFFSET_SEQ + 4U)) &&
+        (BENCH_MAGIC == get_u32(&p_rx_packet[BENCH_OFFSET_MAGIC])))
+    {
+        if (g_trial_id != get_u32(&p_rx_packet[BENCH_OFFSET_TRIAL]))
+        {
+            g_rx_stale++;
+        }
+        else if (PROBE_ARMED == g_probe_state)
+        {
+            if (g_probe_seq == get_u32(&p_rx_packet[BENCH_OFFSET_SEQ]))
+            {
+                g_probe_rx_ns = tsu_now_ns();
+                g_probe_state = PROBE_DONE;
+            }
+        }
+        else
+        {
+            g_rx_frames++;
+        }
+    }
+
+    MSS_MAC_receive_pkt((mss_mac_instance_t *)this_mac, 0, p_rx_packet, 0, 1);
+}
+
+/**=============================================================================
+ * Build the benchmark frame header in the given buffer.
+ */
+static void
+build_frame(uint8_t *p_frame, uint32_t frame_size)
+{
+    memset(p_frame, 0x5A, frame_size);
+    memcpy(&p_frame[0], g_mac_config.mac_addr, 6U);
+    memcpy(&p_frame[6], g_mac_config.mac_addr, 6U);
+    p_frame[BENCH_OFFSET_TYPE] = (uint8_t)(BENCH_ETHERTYPE >> 8);
+    p_frame[BENCH_OFFSET_TYPE + 1U] = (uint8_t)BENCH_ETHERTYPE;
+    put_u32(&p_frame[BENCH_OFFSET_MAGIC], BENCH_MAGIC);
+    put_u32(&p_frame[BENCH_OFFSET_TRIAL], g_trial_id);
+    put_u32(&p_frame[BENCH_OFFSET_SEQ], 0U);
+}
+
+/**=============================================================================
+ * Wait for any frames still in the transmit ring from a previous trial.
+ */
+static void
+wait_tx_idle(void)
+{
+    uint64_t deadline = tsu_now_ns() + GEM_BENCH_TRIAL_TIMEOUT_NS;
+
+    while ((g_test_mac->queue[0].nb_available_tx_desc < MSS_MAC_TX_RING_SIZE) &&
+           (tsu_now_ns() < deadline))
+    {
+        ;
+    }
+}
+
+/**=============================================================================
+ * Program the GEM IPG stretch so that back to back frames of frame_size bytes
+ * occupy permille/1000 of the line.
+ *
+ * With stretch enabled the GEM uses an IPG of previous frame length *
+ * MUL / (DIV + 1) when that exceeds the standard 96 bit IPG. We pick the
+ * closest MUL/DIV pair for the IPG needed. The rate actually achieved is
+ * measured and reported separately so small rounding errors here do not
+ * affect the results.
+ */
+static void
+set_offered_load(uint32_t frame_size, uint32_t permille)
+{
+    uint64_t ipg_milli = 0U;
+    uint64_t target;
+    uint64_t achieved;
+    uint64_t error;
+    uint64_t best_error = ~0ULL;
+    uint32_t best_ratio = 0U;
+    uint32_t divisor;
+    uint32_t multiplier;
+
+    if (permille < 1000U)
+    {
+        /* IPG in 1/1000ths of a byte for the requested load */
+        target = ((uint64_t)(frame_size + BENCH_PREAMBLE_SIZE + BENCH_MIN_IPG_SIZE) * 1000000ULL) /
+                 permille;
+        ipg_milli = target - ((uint64_t)(frame_size + BENCH_PREAMBLE_SIZE) * 1000ULL);
+    }
+
+    /*
+     * Only change the IPG with the transmitter idle. The transmitter is left
+     * enabled as disabling it would rewind the queue pointer behind the
+     * driver's back.
+     */
+    wait_tx_idle();
+
+    if (ipg_milli <= (BENCH_MIN_IPG_SIZE * 1000U))
+    {
+        g_test_mac->mac_base->NETWORK_CONFIG &= ~GEM_IPG_STRETCH_ENABLE;
+    }
+    else
+    {
+        for (divisor = 0U; divisor <= GEM_IPG_STRETCH_DIV_MASK; divisor++)
+        {
+            multiplier = (uint32_t)(((ipg_milli * (divisor + 1U)) + (frame_size * 500U)) /
+                                    (frame_size * 1000U));
+            if ((0U != multiplier) && (multiplier <= GEM_IPG_STRETCH_MUL_MASK))
+            {
+                achieved = ((uint64_t)multiplier * frame_size * 1000U) / (divisor + 1U);
+                error = (achieved > ipg_milli) ? (achieved - ipg_milli) : (ipg_milli - achieved);
+                if (error < best_error)
+                {
+                    best_error = error;
+                    best_ratio = multiplier | (divisor << GEM_IPG_STRETCH_DIV_SHIFT);
+                }
+            }
+        }
+
+        g_test_mac->mac_base->STRETCH_RATIO = best_ratio;
+        g_test_mac->mac_base->NETWORK_CONFIG |= GEM_IPG_STRETCH_ENABLE;
+    }
+}
+
+/**=============================================================================
+ * Offer GEM_BENCH_TRIAL_FRAMES frames at the given load and count how many
+ * come back. Returns 1 if every frame was received.
+ */
+static int
+run_trial(uint32_t frame_size, uint32_t permille, gem_bench_trial_t *p_trial)
+{
+    uint64_t start;
+    uint64_t end;
+    uint64_t deadline;
+    uint32_t sent = 0U;
+    uint32_t batch;
+    uint32_t resource_start;
+    uint32_t overrun_start;
+
+    wait_tx_idle();
+
+    g_trial_id++;
+    put_u32(&g_tx_frame[BENCH_OFFSET_TRIAL], g_trial_id);
+    g_probe_state = PROBE_IDLE;
+    g_tx_done = 0U;
+    g_rx_frames = 0U;
+
+    set_offered_load(frame_size, permille);
+
+    resource_start = MSS_MAC_read_stat(g_test_mac, MSS_MAC_RX_RESOURCE_ERRORS);
+    overrun_start = MSS_MAC_read_stat(g_test_mac, MSS_MAC_RX_OVERRUNS);
+
+    start = tsu_now_ns();
+    deadline = start + GEM_BENCH_TRIAL_TIMEOUT_NS;
+
+    while ((sent < GEM_BENCH_TRIAL_FRAMES) && (tsu_now_ns() < deadline))
+    {
+        batch = GEM_BENCH_TRIAL_FRAMES - sent;
+        if (batch > BENCH_TX_BATCH)
+        {
+            batch = BENCH_TX_BATCH;
+        }
+
+        sent += MSS_MAC_send_pkts_stream(g_test_mac, 0, g_tx_list, batch);
+    }
+
+    while ((g_tx_done < sent) && (tsu_now_ns() < deadline))
+    {
+        ;
+    }
+
+    end = tsu_now_ns();
+
+    /* Give the last frames time to make it back through the loop */
+    deadline = end + GEM_BENCH_RX_DRAIN_NS;
+    while ((g_rx_frames < sent) && (tsu_now_ns() < deadline))
+    {
+        ;
+    }
+
+    p_trial->frame_size = frame_size;
+    p_trial->permille = permille;
+    p_trial->tx_frames = sent;
+    p_trial->tx_done = g_tx_done;
+    p_trial->rx_frames = g_rx_frames;
+    p_trial->rx_resource = MSS_MAC_read_stat(g_test_mac, MSS_MAC_RX_RESOURCE_ERRORS) -
+                           resource_start;
+    p_trial->rx_overruns = MSS_MAC_read_stat(g_test_mac, MSS_MAC_RX_OVERRUNS) - overrun_start;
+    p_trial->duration_ns = end - start;
+
+    return ((GEM_BENCH_TRIAL_FRAMES == sent) && (GEM_BENCH_TRIAL_FRAMES == p_trial->tx_done) &&
+            (GEM_BENCH_TRIAL_FRAMES == p_trial->rx_frames));
+}
+
+/**=============================================================================
+ * Print one trial in the machine readable format.
+ */
+static void
+print_trial(const char *p_kind, const gem_bench_trial_t *p_trial)
+{
+    uint64_t fps = 0U;
+    uint64_t kbps = 0U;
+
+    if (0U != p_trial->duration_ns)
+    {
+        fps = ((uint64_t)p_trial->tx_done * 1000000000ULL) / p_trial->duration_ns;
+        kbps = (fps * p_trial->frame_size * 8U) / 1000U;
+    }
+
+    sprintf(info_string,
+            "%s,%u,%u,%lu,%lu.%03lu,%u,%u,%u,%u,%u,%lu\n\r",
+            p_kind,
+            p_trial->frame_size,
+            p_trial->permille,
+            (unsigned long)fps,
+            (unsigned long)(kbps / 1000U),
+            (unsigned long)(kbps % 1000U),
+            p_trial->tx_frames,
+            p_trial->tx_done,
+            p_trial->rx_frames,
+            p_trial->rx_resource,
+            p_trial->rx_overruns,
+            (unsigned long)p_trial->duration_ns);
+    PRINT_STRING(info_string);
+}
+
+/**=============================================================================
+ * Binary search for the highest offered load with zero frame loss.
+ */
+static void
+throughput_search(uint32_t frame_size)
+{
+    gem_bench_trial_t trial;
+    gem_bench_trial_t best;
+    uint32_t low = 0U;
+    uint32_t high = 1000U;
+    uint32_t rate = 1000U;
+    uint32_t index;
+
+    build_frame(g_tx_frame, frame_size);
+    for (index = 0U; index < BENCH_TX_BATCH; index++)
+    {
+        g_tx_list[index].queue_no = 0U;
+        g_tx_list[index].length = frame_size - BENCH_FCS_SIZE;
+        g_tx_list[index].tx_buffer = g_tx_frame;
+        g_tx_list[index].p_user_data = (void *)0;
+    }
+
+    memset(&best, 0, sizeof(best));
+    best.frame_size = frame_size;
+
+    do
+    {
+        if (0 != run_trial(frame_size, rate, &trial))
+        {
+            print_trial("TRIAL,pass", &trial);
+            best = trial;
+            low = rate;
+        }
+        else
+        {
+            print_trial("TRIAL,fail", &trial);
+            high = rate;
+        }
+
+        rate = (low + high) / 2U;
+    } while ((high - low) > GEM_BENCH_RESOLUTION_PERMILLE);
+
+    print_trial("RESULT,throughput", &best);
+
+    set_offered_load(frame_size, 1000U);
+}
+
+/**=============================================================================
+ * Send single frames on an otherwise idle link and time the round trip with
+ * the TSU.
+ */
+static void
+latency_run(uint32_t frame_size)
+{
+    gem_bench_latency_t result;
+    uint64_t start;
+    uint64_t latency;
+    int32_t tx_status;
+    uint32_t seq;
+
+    memset(&result, 0, sizeof(result));
+    result.frame_size = frame_size;
+    result.min_ns = ~0ULL;
+
+    wait_tx_idle();
+
+    g_trial_id++;
+    build_frame(g_probe_frame, frame_size);
+
+    for (seq = 0U; seq < GEM_BENCH_LATENCY_FRAMES; seq++)
+    {
+        put_u32(&g_probe_frame[BENCH_OFFSET_SEQ], seq);
+        g_probe_seq = seq;
+        g_probe_state = PROBE_ARMED;
+
+        start = tsu_now_ns();
+        tx_status = MSS_MAC_send_pkt(g_test_mac,
+                                     0,
+                                     g_probe_frame,
+                                     frame_size - BENCH_FCS_SIZE,
+                                     (void *)0);
+
+        while ((MSS_MAC_SUCCESS == tx_status) && (PROBE_DONE != g_probe_state) &&
+               ((tsu_now_ns() - start) < GEM_BENCH_LATENCY_TIMEOUT_NS))
+        {
+            ;
+        }
+
+        if (PROBE_DONE == g_probe_state)
+        {
+            latency = g_probe_rx_ns - start;
+            result.count++;
+            result.total_ns += latency;
+            if (latency < result.min_ns)
+            {
+                result.min_ns = latency;
+            }
+
+            if (latency > result.max_ns)
+            {
+                result.max_ns = latency;
+            }
+        }
+        else
+        {
+            result.lost++;
+        }
+
+        g_probe_state = PROBE_IDLE;
+        wait_tx_idle();
+    }
+
+    if (0U == result.count)
+    {
+        result.min_ns = 0U;
+    }
+
+    sprintf(info_string,
+            "RESULT,latency,%u,%u,%lu,%lu,%lu,%u\n\r",
+            result.frame_size,
+            result.count,
+            (unsigned long)result.min_ns,
+            (unsigned long)((0U != result.count) ? (result.total_ns / result.count) : 0U),
+            (unsigned long)result.max_ns,
+            result.lost);
+    PRINT_STRING(info_string);
+}
+
+/**=============================================================================
+ * Poll schedule callback for the cost measurement. Nothing to do as the
+ * measurement calls MSS_MAC_rx_poll() itself.
+ */
+static void
+cost_poll_sched(/* mss_mac_instance_t*/ void *this_mac, uint32_t queue_no)
+{
+    (void)this_mac;
+    (void)queue_no;
+}
+
+/**=============================================================================
+ * Measure the CPU cycles the driver spends per frame on transmit and receive.
+ *
+ * The transmit cost is the time spent in MSS_MAC_send_pkts_stream() queuing a
+ * burst. The receive cost is the time spent in MSS_MAC_rx_poll() handing the
+ * same burst to the receive callback and re-arming the buffers, with the
+ * receive queue in poll mode so none of it happens in the interrupt handler.
+ * Both include any cache maintenance the placement requires. The transmit
+ * completion interrupt is not included.
+ */
+static void
+cost_run(uint32_t frame_size)
+{
+    uint64_t start;
+    uint64_t deadline;
+    uint64_t tx_cycles = 0U;
+    uint64_t rx_cycles = 0U;
+    uint32_t tx_frames = 0U;
+    uint32_t rx_frames = 0U;
+    uint32_t accepted;
+    uint32_t polled;
+    uint32_t round;
+
+    /* g_tx_list still holds this frame size from throughput_search() */
+    set_offered_load(frame_size, 1000U);
+
+    g_trial_id++;
+    put_u32(&g_tx_frame[BENCH_OFFSET_TRIAL], g_trial_id);
+    g_probe_state = PROBE_IDLE;
+
+    MSS_MAC_set_rx_poll_mode(g_test_mac, 0, cost_poll_sched, 0U);
+
+    for (round = 0U; round < GEM_BENCH_COST_ROUNDS; round++)
+    {
+        g_tx_done = 0U;
+
+        start = readmcycle();
+        accepted = MSS_MAC_send_pkts_stream(g_test_mac, 0, g_tx_list, BENCH_COST_BATCH);
+        tx_cycles += readmcycle() - start;
+        tx_frames += accepted;
+
+        deadline = tsu_now_ns() + GEM_BENCH_LATENCY_TIMEOUT_NS;
+        while ((g_tx_done < accepted) && (tsu_now_ns() < deadline))
+        {
+            ;
+        }
+
+        deadline = tsu_now_ns() + GEM_BENCH_COST_SETTLE_NS;
+        while (tsu_now_ns() < deadline)
+        {
+            ;
+        }
+
+        start = readmcycle();
+        do
+        {
+            polled = MSS_MAC_rx_poll(g_test_mac, 0);
+            rx_frames += polled;
+        } while (MSS_MAC_RX_RING_SIZE == polled);
+        rx_cycles += readmcycle() - start;
+    }
+
+    MSS_MAC_set_rx_poll_mode(g_test_mac, 0, (mss_mac_rx_poll_callback_t)0, 0U);
+
+    sprintf(info_string,
+            "RESULT,cost,%u,%u,%lu,%u,%lu\n\r",
+            frame_size,
+            tx_frames,
+            (unsigned long)((0U != tx_frames) ? (tx_cycles / tx_frames) : 0U),
+            rx_frames,
+            (unsigned long)((0U != rx_frames) ? (rx_cycles / rx_frames) : 0U));
+    PRINT_STRING(info_string);
+}
+
+/**=============================================================================
+ * Hardware setup, based on the mpfs-mac-simple-test low_level_init().
+ */
+static void
+low_level_init(void)
+{
+    uint32_t count;
+    mss_mac_tsu_config_t tsu_cfg;
+
+#if defined(MSS_MAC_USE_DDR)
+    g_mac_rx_buffer = MSS_MAC_alloc_dma_mem(MSS_MAC_RX_RING_SIZE * MSS_MAC_MAX_RX_BUF_SIZE);
+    g_tx_frame = MSS_MAC_alloc_dma_mem(MSS_MAC_MAX_PACKET_SIZE);
+    g_probe_frame = MSS_MAC_alloc_dma_mem(MSS_MAC_MAX_PACKET_SIZE);
+#endif
+
+    MSS_MAC_cfg_struct_def_init(&g_mac_config);
+
+    g_mac_config.speed_duplex_select = MSS_MAC_ANEG_1000M_FD;
+    g_mac_config.mac_addr[0] = 0x00;
+    g_mac_config.mac_addr[1] = 0xFC;
+    g_mac_config.mac_addr[2] = 0x00;
+    g_mac_config.mac_addr[3] = 0x12;
+    g_mac_config.mac_addr[4] = 0x34;
+    g_mac_config.mac_addr[5] = 0x56;
+
+    g_mac_config.tsu_clock_select = 1U;
+
+    /* Make sure the streamed frames are not paused or rejected */
+    g_mac_config.rx_flow_ctrl = MSS_MAC_RX_FLOW_CTRL_DISABLE;
+    g_mac_config.tx_flow_ctrl = MSS_MAC_TX_FLOW_CTRL_DISABLE;
+
+#if GEM_BENCH_LOOPBACK == GEM_BENCH_LOOPBACK_INTERNAL
+    g_mac_config.loopback = MSS_MAC_LOOPBACK_ENABLE;
+#endif
+
+    /*
+     * Start with GEM1 address as the standard Icicle design has the MDIO
+     * connected to GEM1.
+     */
+    g_mac_config.phy_addr = PHY_VSC8662_1_MDIO_ADDR;
+    g_mac_config.phy_type = MSS_MAC_DEV_PHY_VSC8662;
+    g_mac_config.pcs_phy_addr = SGMII_MDIO_ADDR;
+    g_mac_config.interface_type = TBI;
+    g_mac_config.phy_autonegotiate = MSS_MAC_VSC8662_phy_autonegotiate;
+    g_mac_config.phy_mac_autonegotiate = MSS_MAC_VSC8662_mac_autonegotiate;
+    g_mac_config.phy_get_link_status = MSS_MAC_VSC8662_phy_get_link_status;
+    g_mac_config.phy_init = MSS_MAC_VSC8662_phy_init;
+    g_mac_config.phy_set_link_speed = MSS_MAC_VSC8662_phy_set_link_speed;
+
+#if (MSS_MAC_HW_PLATFORM == MSS_MAC_DESIGN_ICICLE_SGMII_GEM0) || \
+    (MSS_MAC_HW_PLATFORM == MSS_MAC_DESIGN_ICICLE_STD_GEM0)
+    /* Init GEM1 for MDIO interface only */
+    g_mac_config.mac_addr[5] = 0x57;
+    MSS_MAC_init(&g_mac1, &g_mac_config);
+
+    g_mac_config.mac_addr[5] = 0x56;
+    g_test_mac = &g_mac0;
+    g_mac_config.phy_addr = PHY_VSC8662_0_MDIO_ADDR;
+    g_mac_config.phy_controller = &g_mac1;
+#else
+    g_test_mac = &g_mac1;
+    g_mac_config.mac_addr[5] = 0x57;
+#endif
+    MSS_MAC_init(g_test_mac, &g_mac_config);
+
+    /* Allocate all 4 segments to queue 0 as this is our only one... */
+    g_test_mac->mac_base->NETWORK_CONTROL &= ~GEM_ENABLE_TRANSMIT;
+    g_test_mac->mac_base->TX_Q_SEG_ALLOC_Q0TO3 = 2;
+    g_test_mac->mac_base->NETWORK_CONTROL |= GEM_ENABLE_TRANSMIT;
+
+    MSS_MAC_set_tx_callback(g_test_mac, 0, packet_tx_complete_handler);
+    MSS_MAC_set_rx_callback(g_test_mac, 0, mac_rx_callback);
+
+    for (count = 0; count < MSS_MAC_RX_RING_SIZE; ++count)
+    {
+        MSS_MAC_receive_pkt(g_test_mac,
+                            0,
+                            &g_mac_rx_buffer[count * MSS_MAC_MAX_RX_BUF_SIZE],
+                            0,
+                            (count != (MSS_MAC_RX_RING_SIZE - 1)) ? 0 : -1);
+    }
+
+    tsu_cfg.secs_msb = 0U;
+    tsu_cfg.secs_lsb = 0U;
+    tsu_cfg.nanoseconds = 0U;
+    tsu_cfg.ns_inc = GEM_BENCH_TSU_NS_INC;
+    tsu_cfg.sub_ns_inc = 0U;
+    MSS_MAC_init_TSU(g_test_mac, &tsu_cfg);
+}
+
+/**=============================================================================
+ * Wait for the PHY link when using external loopback.
+ */
+static void
+wait_for_link(void)
+{
+#if GEM_BENCH_LOOPBACK == GEM_BENCH_LOOPBACK_EXTERNAL
+    mss_mac_speed_t speed;
+    uint8_t fullduplex;
+
+    PRINT_STRING("# Waiting for link\n\r");
+    while (0U == MSS_MAC_get_link_status(g_test_mac, &speed, &fullduplex))
+    {
+        ;
+    }
+
+    if ((MSS_MAC_1000MBPS != speed) || (0U == fullduplex))
+    {
+        PRINT_STRING("# Warning: link is not 1000M full duplex\n\r");
+    }
+#endif
+}
+
+/*==============================================================================
+ *
+ */
+void
+E51_sysTick_IRQHandler(void)
+{
+    g_tick_counter += HART0_TICK_RATE_MS;
+}
+
+void e51(void);
+void
+e51(void)
+{
+    write_csr(mscratch, 0);
+    write_csr(mcause, 0);
+    write_csr(mepc, 0);
+
+    PLIC_init();
+
+    gem_bench_task(0);
+}
+
+/*==============================================================================
+ * Benchmark entry point. Runs the sweep once and then idles.
+ */
+void
+gem_bench_task(void *pvParameters)
+{
+    uint32_t index;
+
+    (void)pvParameters;
+
+    SYSREG->SOFT_RESET_CR = 0U;
+    SYSREG->SUBBLK_CLOCK_CR = 0xFFFFFFFFUL;
+
+    MSS_GPIO_init(GPIO2_LO);
+    MSS_GPIO_config(GPIO2_LO, MSS_GPIO_16, MSS_GPIO_OUTPUT_MODE); /* LED 0 */
+    MSS_GPIO_config(GPIO2_LO, MSS_GPIO_17, MSS_GPIO_OUTPUT_MODE); /* LED 1 */
+    MSS_GPIO_set_output(GPIO2_LO, MSS_GPIO_16, 0);
+    MSS_GPIO_set_output(GPIO2_LO, MSS_GPIO_17, 0);
+
+    SysTick_Config();
+
+    MSS_UART_init(DEMO_UART,
+                  MSS_UART_115200_BAUD,
+                  MSS_UART_DATA_8_BITS | MSS_UART_NO_PARITY | MSS_UART_ONE_STOP_BIT);
+
+    PRINT_STRING("\n\r# PolarFire SoC GEM benchmark\n\r");
+    __enable_irq();
+
+    low_level_init();
+    wait_for_link();
+
+    sprintf(info_string,
+            "CONFIG,%s,%s,%s,0x%08x,%u,%u,%u,%u,%u,%s\n\r",
+            GEM_BENCH_BUILD_TAG,
+            (GEM_BENCH_LOOPBACK == GEM_BENCH_LOOPBACK_INTERNAL) ? "internal" : "external",
+            (g_test_mac == &g_mac0) ? "gem0" : "gem1",
+            (unsigned int)g_test_mac->mac_base->REVISION_REG,
+            (unsigned int)MSS_MAC_TX_RING_SIZE,
+            (unsigned int)MSS_MAC_RX_RING_SIZE,
+            (unsigned int)GEM_BENCH_TRIAL_FRAMES,
+            (unsigned int)GEM_BENCH_RESOLUTION_PERMILLE,
+            (unsigned int)GEM_BENCH_LATENCY_FRAMES,
+            BENCH_PLACEMENT);
+    PRINT_STRING(info_string);
+    PRINT_STRING("# TRIAL|RESULT,throughput,size,permille,fps,mbps,tx,tx_done,rx,"
+                 "rx_resource,rx_overrun,ns\n\r");
+    PRINT_STRING("# RESULT,latency,size,count,min_ns,avg_ns,max_ns,lost\n\r");
+    PRINT_STRING("# RESULT,cost,size,tx,tx_cycles,rx,rx_cycles\n\r");
+
+    for (index = 0U; index < (sizeof(g_frame_sizes) / sizeof(g_frame_sizes[0])); index++)
+    {
+        MSS_GPIO_set_output(GPIO2_LO, MSS_GPIO_16, (index & 1U));
+        throughput_search(g_frame_sizes[index]);
+        latency_run(g_frame_sizes[index]);
+        cost_run(g_frame_sizes[index]);
+    }
+
+    sprintf(info_string, "DONE,%u\n\r", (unsigned int)g_rx_stale);
+    PRINT_STRING(info_string);
+    MSS_GPIO_set_output(GPIO2_LO, MSS_GPIO_17, 1);
+
+    while (1)
+    {
+        ;
+    }
+}
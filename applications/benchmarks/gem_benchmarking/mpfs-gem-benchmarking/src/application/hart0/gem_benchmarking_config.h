@@ -0,0 +1,80 @@
+/*******************************************************************************
+ * Copyright 2023 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Configuration for the GEM benchmarking application.
+ *
+ */
+
+#ifndef GEM_BENCHMARKING_CONFIG_H_
+#define GEM_BENCHMARKING_CONFIG_H_
+
+/*
+ * Loopback path used for the benchmark.
+ *
+ *  GEM_BENCH_LOOPBACK_INTERNAL - frames are looped back inside the GEM, no
+ *                                cable or PHY involved. Measures the driver and
+ *                                DMA path only.
+ *  GEM_BENCH_LOOPBACK_EXTERNAL - frames go out through the PHY and must be
+ *                                returned by a loopback plug or a cable to a
+ *                                reflector. The link must come up before the
+ *                                benchmark starts.
+ */
+#define GEM_BENCH_LOOPBACK_INTERNAL     0
+#define GEM_BENCH_LOOPBACK_EXTERNAL     1
+
+#define GEM_BENCH_LOOPBACK              GEM_BENCH_LOOPBACK_INTERNAL
+
+/*
+ * Frame sizes to sweep, in bytes including the 4 byte FCS. These are the
+ * standard RFC 2544 Ethernet frame sizes.
+ */
+#define GEM_BENCH_FRAME_SIZES           {64U, 128U, 256U, 512U, 1024U, 1280U, 1518U}
+
+/* Number of frames offered in each throughput trial */
+#define GEM_BENCH_TRIAL_FRAMES          (100000U)
+
+/*
+ * Resolution of the zero loss throughput search in 1/1000ths of line rate.
+ * The search stops when the pass/fail window is no wider than this.
+ */
+#define GEM_BENCH_RESOLUTION_PERMILLE   (5U)
+
+/* Time allowed for in flight frames to arrive after the last transmit */
+#define GEM_BENCH_RX_DRAIN_NS           (10000000ULL)
+
+/* Time allowed for a trial before it is abandoned */
+#define GEM_BENCH_TRIAL_TIMEOUT_NS      (5000000000ULL)
+
+/* Number of single frame latency probes per frame size */
+#define GEM_BENCH_LATENCY_FRAMES        (1000U)
+
+/* Time allowed for a latency probe to come back before it is counted lost */
+#define GEM_BENCH_LATENCY_TIMEOUT_NS    (1000000ULL)
+
+/*
+ * Number of bursts timed in the per frame driver cost measurement. Each burst
+ * is as many frames as fit in the transmit and receive rings.
+ */
+#define GEM_BENCH_COST_ROUNDS           (100U)
+
+/* Time allowed for a cost measurement burst to land in the receive ring */
+#define GEM_BENCH_COST_SETTLE_NS        (100000ULL)
+
+/* Nominal line rate in Mbps, used to convert the search rate to an IPG */
+#define GEM_BENCH_LINE_RATE_MBPS        (1000U)
+
+/*
+ * TSU nanoseconds increment per TSU clock tick. The TSU is clocked at 125MHz
+ * on the Icicle Kit reference designs.
+ */
+#define GEM_BENCH_TSU_NS_INC            (8U)
+
+/*
+ * Free form label printed on the CONFIG line so results from different driver
+ * builds can be told apart, for example a git commit id.
+ */
+#define GEM_BENCH_BUILD_TAG             "local"
+
+#endif /* GEM_BENCHMARKING_CONFIG_H_ */
@@ -0,0 +1,683 @@
+/*******************************************************************************
+ * Copyright 2019 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file main.c
+ * @author Microchip FPGA Embedded Systems Solutions
+ * @brief Linux test harness for the MSS Ethernet MAC driver.
+ *
+ * Runs the driver's transmit and receive paths against the GEM model in
+ * gem_model.c. With no arguments the ring handling tests are run. With
+ * "bench [count]" the per packet cost of the driver's transmit and receive
+ * paths is measured instead.
+ *
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "mpfs_hal/mss_hal.h"
+
+#include "drivers/mss/mss_ethernet_mac/mss_ethernet_registers.h"
+#include "drivers/mss/mss_ethernet_mac/mss_ethernet_mac_regs.h"
+#include "drivers/mss/mss_ethernet_mac/mss_ethernet_mac_sw_cfg.h"
+#include "drivers/mss/mss_ethernet_mac/mss_ethernet_mac.h"
+#include "drivers/mss/mss_ethernet_mac/phy.h"
+
+#include "gem_model/gem_model.h"
+
+#define TEST_FRAME_LENGTH   (64U)
+#define TEST_MAX_RECORDS    (64U)
+#define TEST_SEQ_OFFSET     (14U) /* Sequence number goes after the MAC header */
+
+#define CHECK(cond)                                                            \
+    do                                                                         \
+    {                                                                          \
+        if (!(cond))                                                           \
+        {                                                                      \
+            (void)printf("    %s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            g_test_failed = 1;                                                 \
+        }                                                                      \
+    } while (0)
+
+typedef struct
+{
+    uint32_t queue_no;
+    uint32_t length;
+    uint32_t seq;
+    void    *p_user_data;
+} frame_record_t;
+
+static mss_mac_cfg_t g_mac_config;
+
+static uint8_t g_rx_buffers[MSS_MAC_RX_RING_SIZE][MSS_MAC_MAX_RX_BUF_SIZE] __attribute__((aligned(64)));
+static uint8_t g_tx_buffers[TEST_MAX_RECORDS][TEST_FRAME_LENGTH] __attribute__((aligned(64)));
+
+/* What the GEM model put on the wire, in order */
+static frame_record_t g_wire[TEST_MAX_RECORDS];
+static uint32_t g_wire_count;
+
+/* Transmit completions reported by the driver, in order */
+static frame_record_t g_tx_done[TEST_MAX_RECORDS];
+static uint32_t g_tx_done_count;
+
+/* Frames passed to the receive callback, in order */
+static frame_record_t g_rx_done[TEST_MAX_RECORDS];
+static uint32_t g_rx_done_count;
+
+/* Receive buffers the callback has kept instead of giving back to the driver */
+static uint8_t *g_rx_held[MSS_MAC_RX_RING_SIZE];
+static uint32_t g_rx_held_count;
+static uint32_t g_rx_hold;
+
+static uint32_t g_test_failed;
+static uint32_t g_record;
+
+/******************************************************************************
+ * Frames carry a 32 bit sequence number so the order can be checked at the
+ * other end.
+ */
+static void
+frame_fill(uint8_t *p_frame, uint32_t seq)
+{
+    uint32_t index;
+
+    for (index = 0U; index < TEST_FRAME_LENGTH; index++)
+    {
+        p_frame[index] = (uint8_t)(index + seq);
+    }
+
+    (void)memcpy(&p_frame[TEST_SEQ_OFFSET], &seq, sizeof(seq));
+}
+
+static uint32_t
+frame_seq(const uint8_t *p_frame)
+{
+    uint32_t seq;
+
+    (void)memcpy(&seq, &p_frame[TEST_SEQ_OFFSET], sizeof(seq));
+
+    return (seq);
+}
+
+/******************************************************************************
+ * GEM model transmit hook.
+ */
+static void
+wire_hook(uint32_t gem,
+          uint32_t is_emac,
+          uint32_t queue_no,
+          const uint8_t *p_frame,
+          uint32_t length,
+          void *p_user)
+{
+    (void)gem;
+    (void)is_emac;
+    (void)p_user;
+
+    if ((0U != g_record) && (g_wire_count < TEST_MAX_RECORDS))
+    {
+        g_wire[g_wire_count].queue_no = queue_no;
+        g_wire[g_wire_count].length = length;
+        g_wire[g_wire_count].seq = frame_seq(p_frame);
+        g_wire_count++;
+    }
+}
+
+/******************************************************************************
+ * Driver transmit completion callback.
+ */
+static void
+tx_callback(void *this_mac, uint32_t queue_no, mss_mac_tx_desc_t *cdesc, void *p_user_data)
+{
+    (void)this_mac;
+    (void)cdesc;
+
+    if ((0U != g_record) && (g_tx_done_count < TEST_MAX_RECORDS))
+    {
+        g_tx_done[g_tx_done_count].queue_no = queue_no;
+        g_tx_done[g_tx_done_count].p_user_data = p_user_data;
+        g_tx_done_count++;
+    }
+}
+
+/******************************************************************************
+ * Driver receive callback. Hands the buffer straight back unless the test has
+ * asked for buffers to be held.
+ */
+static void
+rx_callback(void *this_mac,
+            uint32_t queue_no,
+            uint8_t *p_rx_packet,
+            uint32_t pckt_length,
+            mss_mac_rx_desc_t *cdesc,
+            void *p_user_data)
+{
+    (void)cdesc;
+
+    if ((0U != g_record) && (g_rx_done_count < TEST_MAX_RECORDS))
+    {
+        g_rx_done[g_rx_done_count].queue_no = queue_no;
+        g_rx_done[g_rx_done_count].length = pckt_length;
+        g_rx_done[g_rx_done_count].seq = frame_seq(p_rx_packet);
+        g_rx_done[g_rx_done_count].p_user_data = p_user_data;
+        g_rx_done_count++;
+    }
+
+    if ((0U != g_rx_hold) && (g_rx_held_count < MSS_MAC_RX_RING_SIZE))
+    {
+        g_rx_held[g_rx_held_count] = p_rx_packet;
+        g_rx_held_count++;
+    }
+    else
+    {
+        (void)MSS_MAC_receive_pkt((mss_mac_instance_t *)this_mac, queue_no, p_rx_packet,
+                                  p_user_data, MSS_MAC_INT_ENABLE);
+    }
+}
+
+/******************************************************************************
+ * Brings GEM0 up on a fresh model with the NULL PHY and callbacks on every
+ * queue.
+ */
+static void
+mac_setup(void)
+{
+    uint32_t queue_no;
+
+    gem_model_reset();
+    gem_model_set_tx_hook(wire_hook, NULL);
+
+    g_wire_count = 0U;
+    g_tx_done_count = 0U;
+    g_rx_done_count = 0U;
+    g_rx_held_count = 0U;
+    g_rx_hold = 0U;
+    g_record = 1U;
+
+    MSS_MAC_cfg_struct_def_init(&g_mac_config);
+    g_mac_config.mac_addr[0] = 0x00;
+    g_mac_config.mac_addr[1] = 0xFC;
+    g_mac_config.mac_addr[2] = 0x00;
+    g_mac_config.mac_addr[3] = 0x12;
+    g_mac_config.mac_addr[4] = 0x34;
+    g_mac_config.mac_addr[5] = 0x56;
+    g_mac_config.phy_type = MSS_MAC_DEV_PHY_NULL;
+    g_mac_config.interface_type = NULL_PHY;
+    g_mac_config.phy_autonegotiate = MSS_MAC_NULL_phy_autonegotiate;
+    g_mac_config.phy_mac_autonegotiate = MSS_MAC_NULL_phy_mac_autonegotiate;
+    g_mac_config.phy_get_link_status = MSS_MAC_NULL_phy_get_link_status;
+    g_mac_config.phy_init = MSS_MAC_NULL_phy_init;
+    g_mac_config.phy_set_link_speed = MSS_MAC_NULL_phy_set_link_speed;
+
+    MSS_MAC_init(&g_mac0, &g_mac_config);
+
+    for (queue_no = 0U; queue_no < MSS_MAC_QUEUE_COUNT; queue_no++)
+    {
+        MSS_MAC_set_tx_callback(&g_mac0, queue_no, tx_callback);
+        MSS_MAC_set_rx_callback(&g_mac0, queue_no, rx_callback);
+    }
+
+    /* Let the GEM settle after the TRANSMIT_START set by the init */
+    (void)gem_model_run();
+}
+
+/******************************************************************************
+ * Gives the GEM all the receive buffers, the last one arming the interrupt.
+ */
+static void
+rx_arm(uint32_t queue_no)
+{
+    uint32_t index;
+
+    for (index = 0U; index < MSS_MAC_RX_RING_SIZE; index++)
+    {
+        (void)MSS_MAC_receive_pkt(&g_mac0, queue_no, g_rx_buffers[index],
+                                  (void *)g_rx_buffers[index],
+                                  ((MSS_MAC_RX_RING_SIZE - 1U) == index) ? MSS_MAC_INT_ARM
+                                                                         : MSS_MAC_INT_DISABLE);
+    }
+}
+
+static int32_t
+rx_inject(uint32_t seq)
+{
+    uint8_t frame[TEST_FRAME_LENGTH];
+
+    frame_fill(frame, seq);
+
+    return (gem_model_receive(0U, 0U, 0U, frame, TEST_FRAME_LENGTH));
+}
+
+/******************************************************************************
+ * MSS_MAC_send_pkts() queues at most MSS_MAC_TX_RING_SIZE - 1 frames per
+ * queue, ending each chain on a USED/WRAP stop descriptor. The GEM sends them
+ * in order, writes back the USED bit of each, halts on the stop descriptor and
+ * txpkt_handler() reports each one before disabling the queue.
+ */
+static void
+test_send_pkts(void)
+{
+    mss_mac_tx_pkt_info_t packets[MSS_MAC_TX_RING_SIZE + 2U];
+    mss_mac_queue_t *p_queue0 = &g_mac0.queue[0];
+    const gem_model_stats_t *p_stats;
+    uint32_t index;
+    uint32_t pass;
+    uint32_t done;
+    uint32_t seq = 0U;
+
+    mac_setup();
+    p_stats = gem_model_get_stats(0U, 0U);
+
+    for (pass = 0U; pass < 2U; pass++)
+    {
+        g_wire_count = 0U;
+        g_tx_done_count = 0U;
+
+        /* One more frame than queue 0 has room for, plus one on queue 1 */
+        for (index = 0U; index < MSS_MAC_TX_RING_SIZE; index++)
+        {
+            frame_fill(g_tx_buffers[index], seq + index);
+            packets[index].queue_no = 0U;
+            packets[index].length = TEST_FRAME_LENGTH;
+            packets[index].tx_buffer = g_tx_buffers[index];
+            packets[index].p_user_data = (void *)g_tx_buffers[index];
+        }
+
+        frame_fill(g_tx_buffers[index], 100U + pass);
+        packets[index].queue_no = 1U;
+        packets[index].length = TEST_FRAME_LENGTH;
+        packets[index].tx_buffer = g_tx_buffers[index];
+        packets[index].p_user_data = (void *)g_tx_buffers[index];
+        index++;
+
+        packets[index].queue_no = 0U;
+        packets[index].length = 0U;
+        packets[index].tx_buffer = NULL;
+        packets[index].p_user_data = NULL;
+
+        CHECK(MSS_MAC_ERR_OK == MSS_MAC_send_pkts(&g_mac0, 3U, packets));
+        CHECK(1U == p_queue0->nb_available_tx_desc);
+        CHECK(0U != (p_queue0->tx_desc_tab[MSS_MAC_TX_RING_SIZE - 1U].status & GEM_TX_DMA_USED));
+        CHECK(0U != (p_queue0->tx_desc_tab[MSS_MAC_TX_RING_SIZE - 1U].status & GEM_TX_DMA_WRAP));
+
+        /* Nothing moves until the GEM runs */
+        CHECK(0U == g_wire_count);
+
+        CHECK(MSS_MAC_TX_RING_SIZE == gem_model_run());
+
+        /* Queue 0 frames in order, the extra one dropped by the driver */
+        for (index = 0U; index < (MSS_MAC_TX_RING_SIZE - 1U); index++)
+        {
+            CHECK(0U != (p_queue0->tx_desc_tab[index].status & GEM_TX_DMA_USED));
+        }
+
+        for (index = 0U; index < g_wire_count; index++)
+        {
+            if (0U == g_wire[index].queue_no)
+            {
+                CHECK(seq == g_wire[index].seq);
+                CHECK(TEST_FRAME_LENGTH == g_wire[index].length);
+                seq++;
+            }
+            else
+            {
+                CHECK(1U == g_wire[index].queue_no);
+                CHECK((100U + pass) == g_wire[index].seq);
+            }
+        }
+
+        CHECK(MSS_MAC_TX_RING_SIZE == g_wire_count);
+        CHECK(MSS_MAC_TX_RING_SIZE == g_tx_done_count);
+        seq++; /* Skip the dropped frame */
+
+        done = 0U;
+        for (index = 0U; index < g_tx_done_count; index++)
+        {
+            if (0U == g_tx_done[index].queue_no)
+            {
+                CHECK(g_tx_done[index].p_user_data == (void *)g_tx_buffers[done]);
+                done++;
+            }
+        }
+
+        CHECK((MSS_MAC_TX_RING_SIZE - 1U) == done);
+
+        /* Both queues back to idle and disabled */
+        CHECK(MSS_MAC_TX_RING_SIZE == p_queue0->nb_available_tx_desc);
+        CHECK(MSS_MAC_TX_RING_SIZE == g_mac0.queue[1].nb_available_tx_desc);
+        CHECK(0U != (gem_model_tx_queue_ptr(0U, 0U, 0U) & 1U));
+        CHECK(0U != (gem_model_tx_queue_ptr(0U, 0U, 1U) & 1U));
+    }
+
+    CHECK(0U == p_stats->tx_underruns);
+    CHECK(0U != p_stats->tx_used_halts);
+    CHECK(0U != p_stats->irqs[0]);
+    CHECK(0U != p_stats->irqs[1]);
+}
+
+/******************************************************************************
+ * Receive ring wrap. With the callback handing each buffer straight back the
+ * GEM follows the WRAP bit on the last descriptor back to the start of
+ * rx_desc_tab and rxpkt_handler() follows it round in step.
+ */
+static void
+test_rx_wrap(void)
+{
+    const uint32_t frames = (MSS_MAC_RX_RING_SIZE * 2U) + 2U;
+    const gem_model_stats_t *p_stats;
+    uint32_t base;
+    uint32_t seq;
+
+    mac_setup();
+    p_stats = gem_model_get_stats(0U, 0U);
+    rx_arm(0U);
+
+    base = (uint32_t)(uintptr_t)g_mac0.queue[0].rx_desc_tab;
+    CHECK(base == gem_model_rx_queue_ptr(0U, 0U, 0U));
+    CHECK(0U != (g_mac0.queue[0].rx_desc_tab[MSS_MAC_RX_RING_SIZE - 1U].addr_low & GEM_RX_DMA_WRAP));
+
+    for (seq = 0U; seq < frames; seq++)
+    {
+        CHECK(GEM_MODEL_RX_OK == rx_inject(seq));
+
+        /* Let two frames build up at a time so the handler loops */
+        if (0U != (seq & 1U))
+        {
+            CHECK(0U != gem_model_service());
+        }
+    }
+
+    CHECK(frames == g_rx_done_count);
+    for (seq = 0U; seq < g_rx_done_count; seq++)
+    {
+        CHECK(seq == g_rx_done[seq].seq);
+        CHECK(TEST_FRAME_LENGTH == g_rx_done[seq].length);
+        CHECK(g_rx_done[seq].p_user_data ==
+              (void *)g_rx_buffers[seq % MSS_MAC_RX_RING_SIZE]);
+    }
+
+    CHECK((frames / MSS_MAC_RX_RING_SIZE) == p_stats->rx_wraps);
+    CHECK((base + ((frames % MSS_MAC_RX_RING_SIZE) * (uint32_t)sizeof(mss_mac_rx_desc_t))) ==
+          gem_model_rx_queue_ptr(0U, 0U, 0U));
+    CHECK((frames % MSS_MAC_RX_RING_SIZE) == g_mac0.queue[0].first_rx_desc_index);
+    CHECK(0U == g_mac0.queue[0].nb_available_rx_desc);
+    CHECK(0U == g_mac0.queue[0].rx_overflow);
+    CHECK(0U == p_stats->rx_no_buffer);
+}
+
+/******************************************************************************
+ * Receive USED bit handling. While the application holds every buffer each
+ * descriptor keeps its USED bit, so the next frame is dropped and the GEM
+ * raises RX used bit read. Once the buffers are returned reception carries on
+ * from the descriptor it stopped at.
+ */
+static void
+test_rx_used_bit(void)
+{
+    const gem_model_stats_t *p_stats;
+    uint32_t base;
+    uint32_t index;
+    uint32_t seq;
+
+    mac_setup();
+    p_stats = gem_model_get_stats(0U, 0U);
+    rx_arm(0U);
+    base = (uint32_t)(uintptr_t)g_mac0.queue[0].rx_desc_tab;
+
+    g_rx_hold = 1U;
+    for (seq = 0U; seq < MSS_MAC_RX_RING_SIZE; seq++)
+    {
+        CHECK(GEM_MODEL_RX_OK == rx_inject(seq));
+    }
+
+    CHECK(0U != gem_model_service());
+    CHECK(MSS_MAC_RX_RING_SIZE == g_rx_done_count);
+    CHECK(MSS_MAC_RX_RING_SIZE == g_rx_held_count);
+    CHECK(MSS_MAC_RX_RING_SIZE == g_mac0.queue[0].nb_available_rx_desc);
+
+    for (index = 0U; index < MSS_MAC_RX_RING_SIZE; index++)
+    {
+        CHECK(0U != (g_mac0.queue[0].rx_desc_tab[index].addr_low & GEM_RX_DMA_USED));
+    }
+
+    /* Ring is full of held buffers, so these are dropped at descriptor 0 */
+    CHECK(GEM_MODEL_RX_NO_BUFFER == rx_inject(seq));
+    CHECK(GEM_MODEL_RX_NO_BUFFER == rx_inject(seq + 1U));
+    CHECK(base == gem_model_rx_queue_ptr(0U, 0U, 0U));
+    CHECK(0U != gem_model_service());
+    CHECK(0U != g_mac0.queue[0].rx_overflow);
+    CHECK(MSS_MAC_RX_RING_SIZE == g_rx_done_count);
+    CHECK(2U == p_stats->rx_no_buffer);
+
+    /* Hand the buffers back and reception resumes where it left off */
+    g_rx_hold = 0U;
+    for (index = 0U; index < g_rx_held_count; index++)
+    {
+        (void)MSS_MAC_receive_pkt(&g_mac0, 0U, g_rx_held[index], (void *)g_rx_held[index],
+                                  MSS_MAC_INT_ENABLE);
+    }
+
+    g_rx_held_count = 0U;
+    CHECK(0U == g_mac0.queue[0].nb_available_rx_desc);
+    CHECK(0U == (g_mac0.queue[0].rx_desc_tab[0].addr_low & GEM_RX_DMA_USED));
+
+    for (index = 0U; index < MSS_MAC_RX_RING_SIZE; index++)
+    {
+        CHECK(GEM_MODEL_RX_OK == rx_inject(100U + index));
+        CHECK(0U != gem_model_service());
+    }
+
+    CHECK((2U * MSS_MAC_RX_RING_SIZE) == g_rx_done_count);
+    for (index = 0U; index < MSS_MAC_RX_RING_SIZE; index++)
+    {
+        CHECK((100U + index) == g_rx_done[MSS_MAC_RX_RING_SIZE + index].seq);
+    }
+
+    CHECK(2U == p_stats->rx_wraps);
+    CHECK(base == gem_model_rx_queue_ptr(0U, 0U, 0U));
+}
+
+/******************************************************************************
+ * Ring mode transmit with MSS_MAC_send_pkt_sg(). The GEM only writes back the
+ * USED bit in the first descriptor of each frame and may stop part way through
+ * the queued frames, so tx_ring_reclaim() has to walk to the LAST descriptor
+ * of each frame and restart the transmitter if it stopped early.
+ */
+static void
+test_send_pkt_sg_wrap(void)
+{
+    const uint32_t frames = (MSS_MAC_TX_RING_SIZE * 3U) + 1U;
+    const gem_model_stats_t *p_stats;
+    mss_mac_tx_frag_t frags[2];
+    mss_mac_queue_t *p_queue0 = &g_mac0.queue[0];
+    uint32_t queued = 0U;
+    uint32_t index;
+    uint32_t full = 0U;
+
+    mac_setup();
+    p_stats = gem_model_get_stats(0U, 0U);
+
+    while (queued < frames)
+    {
+        /* Alternate single and two fragment frames */
+        frame_fill(g_tx_buffers[queued], queued);
+        frags[0].tx_buffer = g_tx_buffers[queued];
+        if (0U != (queued & 1U))
+        {
+            frags[0].length = TEST_SEQ_OFFSET + 4U;
+            frags[1].tx_buffer = &g_tx_buffers[queued][TEST_SEQ_OFFSET + 4U];
+            frags[1].length = TEST_FRAME_LENGTH - (TEST_SEQ_OFFSET + 4U);
+        }
+        else
+        {
+            frags[0].length = TEST_FRAME_LENGTH;
+        }
+
+        if (MSS_MAC_ERR_OK == MSS_MAC_send_pkt_sg(&g_mac0, 0U, frags,
+                                                  (0U != (queued & 1U)) ? 2U : 1U,
+                                                  (void *)g_tx_buffers[queued]))
+        {
+            queued++;
+        }
+        else
+        {
+            /*
+             * Ring full. Let the GEM send one frame only, the handler then
+             * reclaims it while the GEM is still running.
+             */
+            full++;
+            CHECK(0U != (gem_model_transmit(0U, 0U, 1U)));
+            (void)gem_model_service();
+        }
+
+        /* Every so often let the GEM catch up and stop at the USED bit */
+        if (0U == (queued % 5U))
+        {
+            (void)gem_model_run();
+        }
+    }
+
+    (void)gem_model_run();
+
+    CHECK(0U != full);
+    CHECK(0U != p_queue0->tx_restart);
+    CHECK(frames == g_wire_count);
+    CHECK(frames == g_tx_done_count);
+    for (index = 0U; index < g_wire_count; index++)
+    {
+        CHECK(index == g_wire[index].seq);
+        CHECK(TEST_FRAME_LENGTH == g_wire[index].length);
+        CHECK(g_tx_done[index].p_user_data == (void *)g_tx_buffers[index]);
+    }
+
+    CHECK(MSS_MAC_TX_RING_SIZE == p_queue0->nb_available_tx_desc);
+    CHECK(p_queue0->current_tx_desc == p_queue0->next_free_tx_desc_index);
+    CHECK(((uint32_t)(uintptr_t)&p_queue0->tx_desc_tab[p_queue0->current_tx_desc]) ==
+          gem_model_tx_queue_ptr(0U, 0U, 0U));
+    CHECK(0U != p_stats->tx_wraps);
+    CHECK(0U != p_stats->tx_used_halts);
+    CHECK(0U == p_stats->tx_underruns);
+}
+
+/******************************************************************************
+ * Per packet cost of the driver paths, GEM model included.
+ */
+static uint64_t
+time_ns(void)
+{
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (((uint64_t)now.tv_sec * 1000000000ULL) + (uint64_t)now.tv_nsec);
+}
+
+static void
+bench(uint32_t count)
+{
+    mss_mac_tx_pkt_info_t packets[MSS_MAC_TX_RING_SIZE];
+    uint8_t frame[TEST_FRAME_LENGTH];
+    uint64_t start;
+    uint64_t elapsed;
+    uint32_t index;
+    uint32_t sent = 0U;
+
+    mac_setup();
+    g_record = 0U;
+
+    /* MSS_MAC_send_pkts() batches of MSS_MAC_TX_RING_SIZE - 1 */
+    for (index = 0U; index < (MSS_MAC_TX_RING_SIZE - 1U); index++)
+    {
+        frame_fill(g_tx_buffers[index], index);
+        packets[index].queue_no = 0U;
+        packets[index].length = TEST_FRAME_LENGTH;
+        packets[index].tx_buffer = g_tx_buffers[index];
+        packets[index].p_user_data = NULL;
+    }
+
+    packets[index].length = 0U;
+    packets[index].tx_buffer = NULL;
+
+    start = time_ns();
+    while (sent < count)
+    {
+        (void)MSS_MAC_send_pkts(&g_mac0, 1U, packets);
+        sent += gem_model_run();
+    }
+
+    elapsed = time_ns() - start;
+    (void)printf("send_pkts:   %10u frames %8.1f ns/frame\n", sent, (double)elapsed / (double)sent);
+
+    /* MSS_MAC_receive_pkt() from the receive callback, one interrupt each */
+    rx_arm(0U);
+    frame_fill(frame, 0U);
+    start = time_ns();
+    for (index = 0U; index < count; index++)
+    {
+        (void)gem_model_receive(0U, 0U, 0U, frame, TEST_FRAME_LENGTH);
+        (void)gem_model_service();
+    }
+
+    elapsed = time_ns() - start;
+    (void)printf("receive_pkt: %10u frames %8.1f ns/frame\n", count,
+                 (double)elapsed / (double)count);
+
+    /* Model only, for subtracting from the above */
+    g_mac0.queue[0].pckt_rx_callback = NULL;
+    start = time_ns();
+    for (index = 0U; index < count; index++)
+    {
+        (void)gem_model_receive(0U, 0U, 0U, frame, TEST_FRAME_LENGTH);
+    }
+
+    elapsed = time_ns() - start;
+    (void)printf("model only:  %10u frames %8.1f ns/frame\n", count,
+                 (double)elapsed / (double)count);
+}
+
+/******************************************************************************
+ *
+ */
+static const struct
+{
+    const char *name;
+    void (*run)(void);
+} g_tests[] = {
+    { "send_pkts", test_send_pkts },
+    { "rx_wrap", test_rx_wrap },
+    { "rx_used_bit", test_rx_used_bit },
+    { "send_pkt_sg_wrap", test_send_pkt_sg_wrap },
+};
+
+int
+main(int argc, char *argv[])
+{
+    uint32_t index;
+    uint32_t failures = 0U;
+
+    /* Keep the output in order with any assertion message */
+    (void)setvbuf(stdout, NULL, _IOLBF, 0U);
+
+    if ((argc > 1) && (0 == strcmp(argv[1], "bench")))
+    {
+        bench((argc > 2) ? (uint32_t)strtoul(argv[2], NULL, 0) : 1000000U);
+        return (0);
+    }
+
+    for (index = 0U; index < (sizeof(g_tests) / sizeof(g_tests[0])); index++)
+    {
+        g_test_failed = 0U;
+        g_tests[index].run();
+        (void)printf("%s %s\n", (0U != g_test_failed) ? "FAIL" : "PASS", g_tests[index].name);
+        failures += g_test_failed;
+    }
+
+    (void)printf("%u of %u tests failed\n", failures,
+                 (uint32_t)(sizeof(g_tests) / sizeof(g_tests[0])));
+
+    return ((0U != failures) ? 1 : 0);
+}
@@ -0,0 +1,97 @@
+/*******************************************************************************
+ * Copyright 2019 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file mss_ethernet_mac_sw_cfg.h
+ * @author Microchip FPGA Embedded Systems Solutions
+ * @brief MSS Ethernet MAC driver configuration for the host GEM model build.
+ *
+ * This follows the GEM benchmarking board configuration but only the NULL PHY
+ * is built and the rings are kept small so that the tests wrap them quickly.
+ * See the reference copy in platform/platform_config_reference for a full
+ * description of each option.
+ *
+ */
+
+#ifndef MICROSEMI__FIRMWARE__POLARFIRE_SOC_MSS_ETHERNET_MAC_DRIVER__1_8_104_CONFIGURATION_HEADER
+#define MICROSEMI__FIRMWARE__POLARFIRE_SOC_MSS_ETHERNET_MAC_DRIVER__1_8_104_CONFIGURATION_HEADER
+
+#define MSS_MAC_UNH_TEST
+
+#define CORE_VENDOR "Microsemi"
+#define CORE_LIBRARY "Firmware"
+#define CORE_NAME "PolarFire_SoC_MSS_Ethernet_MAC_Driver"
+#define CORE_VERSION "1.8.104"
+
+#define NULL_PHY                        (0x0001U)
+#define GMII                            (0x0002U)
+#define TBI                             (0x0004U)
+#define GMII_SGMII                      (0x0008U)
+
+#define MSS_MAC_DEV_PHY_NULL            (0x0001U)
+#define MSS_MAC_DEV_PHY_VSC8575         (0x0002U)
+#define MSS_MAC_DEV_PHY_VSC8541         (0x0004U)
+#define MSS_MAC_DEV_PHY_DP83867         (0x0008U)
+#define MSS_MAC_DEV_PHY_VSC8575_LITE    (0x0010U)
+#define MSS_MAC_DEV_PHY_VSC8662         (0x0020U)
+#define MSS_MAC_DEV_PHY_RTL8211         (0x0040U)
+
+#define MSS_MAC_DESIGN_ICICLE_STD_GEM0  (22)
+
+#define MSS_MAC_PHYS         (MSS_MAC_DEV_PHY_NULL)
+#define MSS_MAC_HW_PLATFORM  MSS_MAC_DESIGN_ICICLE_STD_GEM0
+
+/*
+ * Small rings so that the harness can wrap them with a handful of frames. The
+ * descriptors live in the driver's instance structures and the packet
+ * buffers in the harness, both in static storage.
+ */
+#define MSS_MAC_RX_RING_SIZE (4U)
+#define MSS_MAC_TX_RING_SIZE (4U)
+
+#define MSS_MAC_USE_PHY_VSC8575      (0U != (MSS_MAC_PHYS & MSS_MAC_DEV_PHY_VSC8575))
+#define MSS_MAC_USE_PHY_VSC8575_LITE (0U != (MSS_MAC_PHYS & MSS_MAC_DEV_PHY_VSC8575_LITE))
+#define MSS_MAC_USE_PHY_VSC8541      (0U != (MSS_MAC_PHYS & MSS_MAC_DEV_PHY_VSC8541))
+#define MSS_MAC_USE_PHY_DP83867      (0U != (MSS_MAC_PHYS & MSS_MAC_DEV_PHY_DP83867))
+#define MSS_MAC_USE_PHY_NULL         (0U != (MSS_MAC_PHYS & MSS_MAC_DEV_PHY_NULL))
+#define MSS_MAC_USE_PHY_VSC8662      (0U != (MSS_MAC_PHYS & MSS_MAC_DEV_PHY_VSC8662))
+#define MSS_MAC_USE_PHY_RTL8211      (0U != (MSS_MAC_PHYS & MSS_MAC_DEV_PHY_RTL8211))
+
+#define MSS_MAC_TIME_STAMPED_MODE      (0)
+#define MSS_MAC_64_BIT_ADDRESS_MODE    (0)
+
+#define MSS_MAC_MEM_DDR    (0)
+#define MSS_MAC_MEM_FIC0   (1)
+#define MSS_MAC_MEM_FIC1   (2)
+#define MSS_MAC_MEM_CRYPTO (3)
+#define MSS_MAC_MEM_SCRATCHPAD  (4)
+#define MSS_MAC_MEM_CACHED_DDR  (5)
+
+#define MSS_MAC_QUEUE_COUNT (4)
+
+#define MSS_MAC_TYPE_1_SCREENERS  (4U)
+#define MSS_MAC_TYPE_2_SCREENERS  (4U)
+#define MSS_MAC_TYPE_2_ETHERTYPES (4U)
+#define MSS_MAC_TYPE_2_COMPARERS  (12U)
+
+#define MSS_MAC_EMAC_TYPE_2_SCREENERS  (2U)
+#define MSS_MAC_EMAC_TYPE_2_COMPARERS  (6U)
+
+/*
+ * Point the driver at the GEM model register blocks instead of the GEM0/GEM1
+ * addresses. There is no separate high address alias in the model.
+ */
+uint64_t gem_model_reg_base(uint32_t gem, uint32_t is_emac);
+
+#define MSS_MAC0_BASE        (gem_model_reg_base(0U, 0U))
+#define MSS_EMAC0_BASE       (gem_model_reg_base(0U, 1U))
+#define MSS_MAC1_BASE        (gem_model_reg_base(1U, 0U))
+#define MSS_EMAC1_BASE       (gem_model_reg_base(1U, 1U))
+
+#define MSS_MAC0_BASE_HI     MSS_MAC0_BASE
+#define MSS_EMAC0_BASE_HI    MSS_EMAC0_BASE
+#define MSS_MAC1_BASE_HI     MSS_MAC1_BASE
+#define MSS_EMAC1_BASE_HI    MSS_EMAC1_BASE
+
+#endif /* MICROSEMI__FIRMWARE__POLARFIRE_SOC_MSS_ETHERNET_MAC_DRIVER__1_8_104_CONFIGURATION_HEADER */
@@ -0,0 +1,758 @@
+/*******************************************************************************
+ * Copyright 2019 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file gem_model.c
+ * @author Microchip FPGA Embedded Systems Solutions
+ * @brief Host software model of the PolarFire SoC GEM DMA interface.
+ *
+ * See gem_model.h for what is modelled.
+ *
+ */
+
+#include <string.h>
+
+#include "mpfs_hal/mss_hal.h"
+
+#include "drivers/mss/mss_ethernet_mac/mss_ethernet_registers.h"
+#include "drivers/mss/mss_ethernet_mac/mss_ethernet_mac_regs.h"
+#include "drivers/mss/mss_ethernet_mac/mss_ethernet_mac_sw_cfg.h"
+#include "drivers/mss/mss_ethernet_mac/mss_ethernet_mac.h"
+
+#include "gem_model/gem_model.h"
+
+/* Reserved status register bit the model keeps set to detect driver writes */
+#define GEM_MODEL_WRITE_MARKER     BIT_31
+
+/* Interrupt causes the model raises, all of which the driver handles */
+#define GEM_MODEL_INTS (GEM_RECEIVE_COMPLETE | GEM_RX_USED_BIT_READ | GEM_TRANSMIT_COMPLETE)
+
+/* Limit on descriptors in one transmit frame, guards against a missing LAST */
+#define GEM_MODEL_MAX_TX_FRAGS     (256U)
+
+/* Limit on handler calls in one service, guards against an interrupt storm */
+#define GEM_MODEL_MAX_SERVICE_LOOPS (1000U)
+
+#define GEM_MODEL_MAX_FRAME        (16384U)
+
+typedef uint8_t (*gem_model_handler_t)(void);
+
+/*
+ * Register pointers and internal state for one MAC, i.e. the pMAC or the eMAC
+ * of a GEM.
+ */
+typedef struct
+{
+    uint32_t gem;
+    uint32_t is_emac;
+    uint32_t queue_count;
+
+    volatile uint32_t *network_control;
+    volatile uint32_t *network_status;
+    volatile uint32_t *dma_config;
+    volatile uint32_t *transmit_status;
+    volatile uint32_t *receive_status;
+    volatile uint32_t *upper_tx_q_base;
+    volatile uint32_t *upper_rx_q_base;
+    volatile uint32_t *int_status[GEM_MODEL_QUEUE_COUNT];
+    volatile uint32_t *int_enable[GEM_MODEL_QUEUE_COUNT];
+    volatile uint32_t *int_disable[GEM_MODEL_QUEUE_COUNT];
+    volatile uint32_t *int_mask[GEM_MODEL_QUEUE_COUNT];
+    volatile uint32_t *transmit_q_ptr[GEM_MODEL_QUEUE_COUNT];
+    volatile uint32_t *receive_q_ptr[GEM_MODEL_QUEUE_COUNT];
+    volatile uint32_t *rxbuf_size[GEM_MODEL_QUEUE_COUNT];
+
+    PLIC_IRQn_Type irq[GEM_MODEL_QUEUE_COUNT];
+    gem_model_handler_t handler[GEM_MODEL_QUEUE_COUNT];
+
+    /* Queue pointer state. The *_seen values are what the model last wrote. */
+    uint32_t tx_base[GEM_MODEL_QUEUE_COUNT];
+    uint32_t tx_seen[GEM_MODEL_QUEUE_COUNT];
+    uint32_t tx_halted[GEM_MODEL_QUEUE_COUNT];
+    uint32_t rx_base[GEM_MODEL_QUEUE_COUNT];
+    uint32_t rx_seen[GEM_MODEL_QUEUE_COUNT];
+
+    uint32_t tx_go;
+    uint32_t tsr;
+    uint32_t rsr;
+
+    uint32_t int_latched[GEM_MODEL_QUEUE_COUNT];
+    uint32_t int_seen[GEM_MODEL_QUEUE_COUNT];
+    uint32_t int_enabled[GEM_MODEL_QUEUE_COUNT];
+
+    gem_model_stats_t stats;
+} gem_model_mac_t;
+
+static MAC_TypeDef g_model_mac_regs[GEM_MODEL_GEM_COUNT];
+static eMAC_TypeDef g_model_emac_regs[GEM_MODEL_GEM_COUNT];
+static gem_model_mac_t g_model_macs[GEM_MODEL_GEM_COUNT][2];
+
+static gem_model_tx_hook_t g_tx_hook;
+static void *g_tx_hook_user;
+
+static uint8_t g_tx_frame[GEM_MODEL_MAX_FRAME];
+
+/******************************************************************************
+ * Sets up the register pointers and interrupt routing for one MAC.
+ */
+static void
+model_mac_init(gem_model_mac_t *p_mac, uint32_t gem, uint32_t is_emac)
+{
+    static const gem_model_handler_t pmac_handlers[GEM_MODEL_GEM_COUNT][GEM_MODEL_QUEUE_COUNT] = {
+        { PLIC_mac0_int_IRQHandler, PLIC_mac0_queue1_IRQHandler,
+          PLIC_mac0_queue2_IRQHandler, PLIC_mac0_queue3_IRQHandler },
+        { PLIC_mac1_int_IRQHandler, PLIC_mac1_queue1_IRQHandler,
+          PLIC_mac1_queue2_IRQHandler, PLIC_mac1_queue3_IRQHandler }
+    };
+    static const PLIC_IRQn_Type pmac_irqs[GEM_MODEL_GEM_COUNT][GEM_MODEL_QUEUE_COUNT] = {
+        { MAC0_INT_PLIC, MAC0_QUEUE1_PLIC, MAC0_QUEUE2_PLIC, MAC0_QUEUE3_PLIC },
+        { MAC1_INT_PLIC, MAC1_QUEUE1_PLIC, MAC1_QUEUE2_PLIC, MAC1_QUEUE3_PLIC }
+    };
+    MAC_TypeDef *p_regs = &g_model_mac_regs[gem];
+    eMAC_TypeDef *p_eregs = &g_model_emac_regs[gem];
+    uint32_t queue_no;
+
+    (void)memset(p_mac, 0, sizeof(gem_model_mac_t));
+    p_mac->gem = gem;
+    p_mac->is_emac = is_emac;
+
+    if (0U == is_emac)
+    {
+        p_mac->queue_count = GEM_MODEL_QUEUE_COUNT;
+        p_mac->network_control = &p_regs->NETWORK_CONTROL;
+        p_mac->network_status = (volatile uint32_t *)&p_regs->NETWORK_STATUS;
+        p_mac->dma_config = &p_regs->DMA_CONFIG;
+        p_mac->transmit_status = &p_regs->TRANSMIT_STATUS;
+        p_mac->receive_status = &p_regs->RECEIVE_STATUS;
+        p_mac->upper_tx_q_base = &p_regs->UPPER_TX_Q_BASE_ADDR;
+        p_mac->upper_rx_q_base = &p_regs->UPPER_RX_Q_BASE_ADDR;
+
+        p_mac->int_status[0] = &p_regs->INT_STATUS;
+        p_mac->int_status[1] = &p_regs->INT_Q1_STATUS;
+        p_mac->int_status[2] = &p_regs->INT_Q2_STATUS;
+        p_mac->int_status[3] = &p_regs->INT_Q3_STATUS;
+        p_mac->int_enable[0] = &p_regs->INT_ENABLE;
+        p_mac->int_enable[1] = &p_regs->INT_Q1_ENABLE;
+        p_mac->int_enable[2] = &p_regs->INT_Q2_ENABLE;
+        p_mac->int_enable[3] = &p_regs->INT_Q3_ENABLE;
+        p_mac->int_disable[0] = &p_regs->INT_DISABLE;
+        p_mac->int_disable[1] = &p_regs->INT_Q1_DISABLE;
+        p_mac->int_disable[2] = &p_regs->INT_Q2_DISABLE;
+        p_mac->int_disable[3] = &p_regs->INT_Q3_DISABLE;
+        p_mac->int_mask[0] = &p_regs->INT_MASK;
+        p_mac->int_mask[1] = &p_regs->INT_Q1_MASK;
+        p_mac->int_mask[2] = &p_regs->INT_Q2_MASK;
+        p_mac->int_mask[3] = &p_regs->INT_Q3_MASK;
+        p_mac->transmit_q_ptr[0] = &p_regs->TRANSMIT_Q_PTR;
+        p_mac->transmit_q_ptr[1] = &p_regs->TRANSMIT_Q1_PTR;
+        p_mac->transmit_q_ptr[2] = &p_regs->TRANSMIT_Q2_PTR;
+        p_mac->transmit_q_ptr[3] = &p_regs->TRANSMIT_Q3_PTR;
+        p_mac->receive_q_ptr[0] = &p_regs->RECEIVE_Q_PTR;
+        p_mac->receive_q_ptr[1] = &p_regs->RECEIVE_Q1_PTR;
+        p_mac->receive_q_ptr[2] = &p_regs->RECEIVE_Q2_PTR;
+        p_mac->receive_q_ptr[3] = &p_regs->RECEIVE_Q3_PTR;
+        p_mac->rxbuf_size[0] = NULL; /* Queue 0 size is in DMA_CONFIG */
+        p_mac->rxbuf_size[1] = &p_regs->DMA_RXBUF_SIZE_Q1;
+        p_mac->rxbuf_size[2] = &p_regs->DMA_RXBUF_SIZE_Q2;
+        p_mac->rxbuf_size[3] = &p_regs->DMA_RXBUF_SIZE_Q3;
+
+        for (queue_no = 0U; queue_no < GEM_MODEL_QUEUE_COUNT; queue_no++)
+        {
+            p_mac->irq[queue_no] = pmac_irqs[gem][queue_no];
+            p_mac->handler[queue_no] = pmac_handlers[gem][queue_no];
+        }
+    }
+    else
+    {
+        p_mac->queue_count = 1U;
+        p_mac->network_control = &p_eregs->NETWORK_CONTROL;
+        p_mac->network_status = (volatile uint32_t *)&p_eregs->NETWORK_STATUS;
+        p_mac->dma_config = &p_eregs->DMA_CONFIG;
+        p_mac->transmit_status = &p_eregs->TRANSMIT_STATUS;
+        p_mac->receive_status = &p_eregs->RECEIVE_STATUS;
+        p_mac->upper_tx_q_base = &p_eregs->UPPER_TX_Q_BASE_ADDR;
+        p_mac->upper_rx_q_base = &p_eregs->UPPER_RX_Q_BASE_ADDR;
+        p_mac->int_status[0] = &p_eregs->INT_STATUS;
+        p_mac->int_enable[0] = &p_eregs->INT_ENABLE;
+        p_mac->int_disable[0] = &p_eregs->INT_DISABLE;
+        p_mac->int_mask[0] = &p_eregs->INT_MASK;
+        p_mac->transmit_q_ptr[0] = &p_eregs->TRANSMIT_Q_PTR;
+        p_mac->receive_q_ptr[0] = &p_eregs->RECEIVE_Q_PTR;
+        p_mac->rxbuf_size[0] = NULL;
+        p_mac->irq[0] = (0U == gem) ? MAC0_EMAC_PLIC : MAC1_EMAC_PLIC;
+        p_mac->handler[0] = (0U == gem) ? PLIC_mac0_emac_IRQHandler : PLIC_mac1_emac_IRQHandler;
+    }
+
+    /* Reset values: queues disabled, all interrupts masked, MDIO idle */
+    for (queue_no = 0U; queue_no < p_mac->queue_count; queue_no++)
+    {
+        *p_mac->transmit_q_ptr[queue_no] = 1U;
+        *p_mac->receive_q_ptr[queue_no] = 1U;
+        p_mac->tx_seen[queue_no] = 1U;
+        p_mac->rx_seen[queue_no] = 1U;
+        p_mac->tx_base[queue_no] = 1U;
+        p_mac->rx_base[queue_no] = 1U;
+        *p_mac->int_mask[queue_no] = 0xFFFFFFFFU;
+    }
+
+    *p_mac->network_status = GEM_MAN_DONE;
+    *p_mac->transmit_status = GEM_MODEL_WRITE_MARKER;
+    *p_mac->receive_status = GEM_MODEL_WRITE_MARKER;
+}
+
+/******************************************************************************
+ * Converts a queue pointer register value to the descriptor it points at.
+ */
+static void *
+model_dma_addr(uint32_t high, uint32_t low)
+{
+    return ((void *)(uintptr_t)(((uint64_t)high << 32) | (uint64_t)low));
+}
+
+/******************************************************************************
+ * Returns true if the PLIC line for a queue is enabled on any hart.
+ */
+static uint32_t
+model_plic_enabled(PLIC_IRQn_Type irq)
+{
+    uint32_t word = (uint32_t)irq / 32U;
+    uint32_t bit = (uint32_t)1U << ((uint32_t)irq % 32U);
+
+    return (0U != ((PLIC->HART0_MMODE_ENA[word] | PLIC->HART1_MMODE_ENA[word] |
+                    PLIC->HART2_MMODE_ENA[word] | PLIC->HART3_MMODE_ENA[word] |
+                    PLIC->HART4_MMODE_ENA[word]) & bit));
+}
+
+/******************************************************************************
+ * Picks up what the driver has written to the registers since the model last
+ * looked and presents the current model state in the registers.
+ */
+static void
+model_sync(gem_model_mac_t *p_mac)
+{
+    uint32_t queue_no;
+    uint32_t value;
+
+    for (queue_no = 0U; queue_no < p_mac->queue_count; queue_no++)
+    {
+        /* A queue pointer write sets both the base and the current pointer */
+        value = *p_mac->transmit_q_ptr[queue_no];
+        if (value != p_mac->tx_seen[queue_no])
+        {
+            p_mac->tx_base[queue_no] = value;
+            p_mac->tx_seen[queue_no] = value;
+            p_mac->tx_halted[queue_no] = 0U;
+        }
+
+        value = *p_mac->receive_q_ptr[queue_no];
+        if (value != p_mac->rx_seen[queue_no])
+        {
+            p_mac->rx_base[queue_no] = value;
+            p_mac->rx_seen[queue_no] = value;
+        }
+
+        /*
+         * Interrupt enable and disable are write only strobes. The driver's
+         * reset sequence disables everything before enabling what it uses, so
+         * if both have been written the disable goes first.
+         */
+        value = *p_mac->int_disable[queue_no];
+        if (0U != value)
+        {
+            p_mac->int_enabled[queue_no] &= ~value;
+            *p_mac->int_disable[queue_no] = 0U;
+        }
+
+        value = *p_mac->int_enable[queue_no];
+        if (0U != value)
+        {
+            p_mac->int_enabled[queue_no] |= value;
+            *p_mac->int_enable[queue_no] = 0U;
+        }
+
+        *p_mac->int_mask[queue_no] = ~p_mac->int_enabled[queue_no];
+
+        /* Interrupt status is write one to clear */
+        value = *p_mac->int_status[queue_no];
+        if (value != p_mac->int_seen[queue_no])
+        {
+            p_mac->int_latched[queue_no] &= ~value;
+        }
+
+        *p_mac->int_status[queue_no] = p_mac->int_latched[queue_no];
+        p_mac->int_seen[queue_no] = p_mac->int_latched[queue_no];
+    }
+
+    /* Transmit and receive status are write one to clear */
+    value = *p_mac->transmit_status;
+    if (0U == (value & GEM_MODEL_WRITE_MARKER))
+    {
+        p_mac->tsr &= ~value;
+    }
+
+    value = *p_mac->receive_status;
+    if (0U == (value & GEM_MODEL_WRITE_MARKER))
+    {
+        p_mac->rsr &= ~value;
+    }
+
+    /* TRANSMIT_START is a strobe which restarts every halted queue */
+    value = *p_mac->network_control;
+    if (0U != (value & GEM_TRANSMIT_START))
+    {
+        *p_mac->network_control = value & ~GEM_TRANSMIT_START;
+        if (0U != (value & GEM_ENABLE_TRANSMIT))
+        {
+            p_mac->tx_go = 1U;
+            for (queue_no = 0U; queue_no < p_mac->queue_count; queue_no++)
+            {
+                p_mac->tx_halted[queue_no] = 0U;
+            }
+        }
+    }
+
+    /* Disabling transmit stops the engine and resets the queue pointers */
+    if (0U == (value & GEM_ENABLE_TRANSMIT))
+    {
+        p_mac->tx_go = 0U;
+        for (queue_no = 0U; queue_no < p_mac->queue_count; queue_no++)
+        {
+            *p_mac->transmit_q_ptr[queue_no] = p_mac->tx_base[queue_no];
+            p_mac->tx_seen[queue_no] = p_mac->tx_base[queue_no];
+        }
+    }
+
+    *p_mac->transmit_status =
+        p_mac->tsr | GEM_MODEL_WRITE_MARKER | ((0U != p_mac->tx_go) ? GEM_TRANSMIT_GO : 0U);
+    *p_mac->receive_status = p_mac->rsr | GEM_MODEL_WRITE_MARKER;
+}
+
+/******************************************************************************
+ * Moves a queue pointer on to the next descriptor, following the WRAP bit
+ * back to the queue base.
+ */
+static uint32_t
+model_next_ptr(uint32_t current, uint32_t base, uint32_t wrap, uint32_t desc_size,
+               uint64_t *p_wraps)
+{
+    uint32_t next;
+
+    if (0U != wrap)
+    {
+        next = base & ~(uint32_t)3U;
+        (*p_wraps)++;
+    }
+    else
+    {
+        next = current + desc_size;
+    }
+
+    return (next);
+}
+
+/******************************************************************************
+ * Sends one frame from a transmit queue. Returns 1 if a frame was sent and 0
+ * if the queue has halted.
+ */
+static uint32_t
+model_tx_frame(gem_model_mac_t *p_mac, uint32_t queue_no)
+{
+    mss_mac_tx_desc_t *p_first;
+    mss_mac_tx_desc_t *p_desc;
+    uint32_t ptr = *p_mac->transmit_q_ptr[queue_no] & ~(uint32_t)3U;
+    uint32_t length = 0U;
+    uint32_t frags = 0U;
+    uint32_t last = 0U;
+    uint32_t status;
+    uint32_t frag_length;
+    uint8_t *p_buffer;
+
+    p_first = (mss_mac_tx_desc_t *)model_dma_addr(*p_mac->upper_tx_q_base, ptr);
+    if (0U != (p_first->status & GEM_TX_DMA_USED))
+    {
+        p_mac->tx_halted[queue_no] = 1U;
+        p_mac->tsr |= GEM_USED_BIT_READ;
+        p_mac->stats.tx_used_halts++;
+        return (0U);
+    }
+
+    p_desc = p_first;
+    while ((0U == last) && (frags < GEM_MODEL_MAX_TX_FRAGS))
+    {
+        status = p_desc->status;
+        if ((p_desc != p_first) && (0U != (status & GEM_TX_DMA_USED)))
+        {
+            break; /* Ran out of descriptors part way through the frame */
+        }
+
+        frag_length = status & GEM_TX_DMA_BUFF_LEN;
+#if defined(MSS_MAC_64_BIT_ADDRESS_MODE)
+        p_buffer = (uint8_t *)model_dma_addr(p_desc->addr_high, p_desc->addr_low);
+#else
+        p_buffer = (uint8_t *)model_dma_addr(0U, p_desc->addr_low);
+#endif
+        if ((length + frag_length) <= GEM_MODEL_MAX_FRAME)
+        {
+            (void)memcpy(&g_tx_frame[length], p_buffer, frag_length);
+        }
+
+        length += frag_length;
+        frags++;
+        last = status & GEM_TX_DMA_LAST;
+
+        ptr = model_next_ptr(ptr, p_mac->tx_base[queue_no], status & GEM_TX_DMA_WRAP,
+                             (uint32_t)sizeof(mss_mac_tx_desc_t), &p_mac->stats.tx_wraps);
+        p_desc = (mss_mac_tx_desc_t *)model_dma_addr(*p_mac->upper_tx_q_base, ptr);
+    }
+
+    /* The GEM only writes back the first descriptor of each frame */
+    if (0U == last)
+    {
+        p_first->status |= GEM_TX_DMA_USED | GEM_TX_DMA_UNDERRUN;
+        p_mac->tsr |= GEM_STAT_TRANSMIT_UNDER_RUN;
+        p_mac->tx_halted[queue_no] = 1U;
+        p_mac->stats.tx_underruns++;
+    }
+    else
+    {
+        p_first->status |= GEM_TX_DMA_USED;
+        p_mac->stats.tx_frames++;
+        p_mac->stats.tx_bytes += length;
+        if ((NULL != g_tx_hook) && (length <= GEM_MODEL_MAX_FRAME))
+        {
+            g_tx_hook(p_mac->gem, p_mac->is_emac, queue_no, g_tx_frame, length, g_tx_hook_user);
+        }
+    }
+
+    *p_mac->transmit_q_ptr[queue_no] = ptr;
+    p_mac->tx_seen[queue_no] = ptr;
+
+    /* The next descriptor is fetched straight away, so a stop is seen now */
+    if ((0U != last) && (0U != (p_desc->status & GEM_TX_DMA_USED)))
+    {
+        p_mac->tx_halted[queue_no] = 1U;
+        p_mac->tsr |= GEM_USED_BIT_READ;
+        p_mac->stats.tx_used_halts++;
+    }
+
+    p_mac->tsr |= GEM_STAT_TRANSMIT_COMPLETE;
+    p_mac->int_latched[queue_no] |= GEM_TRANSMIT_COMPLETE;
+
+    return ((0U != last) ? 1U : 0U);
+}
+
+/******************************************************************************
+ * See gem_model.h for details of how to use this function.
+ */
+void
+gem_model_reset(void)
+{
+    uint32_t gem;
+
+    (void)memset(g_model_mac_regs, 0, sizeof(g_model_mac_regs));
+    (void)memset(g_model_emac_regs, 0, sizeof(g_model_emac_regs));
+
+    for (gem = 0U; gem < GEM_MODEL_GEM_COUNT; gem++)
+    {
+        model_mac_init(&g_model_macs[gem][0], gem, 0U);
+        model_mac_init(&g_model_macs[gem][1], gem, 1U);
+    }
+
+    g_tx_hook = NULL;
+    g_tx_hook_user = NULL;
+}
+
+/******************************************************************************
+ * See gem_model.h for details of how to use this function.
+ */
+uint64_t
+gem_model_reg_base(uint32_t gem, uint32_t is_emac)
+{
+    uint64_t base;
+
+    ASSERT(gem < GEM_MODEL_GEM_COUNT);
+    if (0U == is_emac)
+    {
+        base = (uint64_t)(uintptr_t)&g_model_mac_regs[gem];
+    }
+    else
+    {
+        base = (uint64_t)(uintptr_t)&g_model_emac_regs[gem];
+    }
+
+    return (base);
+}
+
+/******************************************************************************
+ * See gem_model.h for details of how to use this function.
+ */
+void
+gem_model_set_tx_hook(gem_model_tx_hook_t hook, void *p_user)
+{
+    g_tx_hook = hook;
+    g_tx_hook_user = p_user;
+}
+
+/******************************************************************************
+ * See gem_model.h for details of how to use this function.
+ */
+uint32_t
+gem_model_transmit(uint32_t gem, uint32_t is_emac, uint32_t budget)
+{
+    gem_model_mac_t *p_mac = &g_model_macs[gem][(0U != is_emac) ? 1U : 0U];
+    uint32_t sent = 0U;
+    uint32_t queue_no;
+    uint32_t active;
+
+    model_sync(p_mac);
+
+    while ((0U != p_mac->tx_go) && (sent < budget))
+    {
+        /* Highest numbered queue with work goes first, as on the GEM */
+        active = 0U;
+        queue_no = p_mac->queue_count;
+        while ((0U != queue_no) && (sent < budget))
+        {
+            queue_no--;
+            if ((0U == (*p_mac->transmit_q_ptr[queue_no] & 1U)) &&
+                (0U == p_mac->tx_halted[queue_no]))
+            {
+                active = 1U;
+                sent += model_tx_frame(p_mac, queue_no);
+            }
+        }
+
+        if (0U == active)
+        {
+            p_mac->tx_go = 0U;
+        }
+    }
+
+    /* Transmit goes idle as soon as the last queue stops */
+    active = 0U;
+    for (queue_no = 0U; queue_no < p_mac->queue_count; queue_no++)
+    {
+        if ((0U == (*p_mac->transmit_q_ptr[queue_no] & 1U)) &&
+            (0U == p_mac->tx_halted[queue_no]))
+        {
+            active = 1U;
+        }
+    }
+
+    if (0U == active)
+    {
+        p_mac->tx_go = 0U;
+    }
+
+    model_sync(p_mac);
+
+    return (sent);
+}
+
+/******************************************************************************
+ * See gem_model.h for details of how to use this function.
+ */
+int32_t
+gem_model_receive(uint32_t gem,
+                  uint32_t is_emac,
+                  uint32_t queue_no,
+                  const uint8_t *p_frame,
+                  uint32_t length)
+{
+    gem_model_mac_t *p_mac = &g_model_macs[gem][(0U != is_emac) ? 1U : 0U];
+    mss_mac_rx_desc_t *p_desc;
+    uint32_t ptr;
+    uint32_t buffer_size;
+    uint32_t addr_low;
+    int32_t result;
+
+    ASSERT(queue_no < p_mac->queue_count);
+    model_sync(p_mac);
+
+    ptr = *p_mac->receive_q_ptr[queue_no];
+    if (0U == queue_no)
+    {
+        buffer_size = ((*p_mac->dma_config & GEM_RX_BUF_SIZE) >> GEM_RX_BUF_SIZE_SHIFT) * 64U;
+    }
+    else
+    {
+        buffer_size = (*p_mac->rxbuf_size[queue_no] & GEM_DMA_RX_Q_BUF_SIZE) * 64U;
+    }
+
+    if ((0U == (*p_mac->network_control & GEM_ENABLE_RECEIVE)) || (0U != (ptr & 1U)))
+    {
+        p_mac->stats.rx_disabled++;
+        result = GEM_MODEL_RX_DISABLED;
+    }
+    else if (length > buffer_size)
+    {
+        p_mac->stats.rx_too_long++;
+        result = GEM_MODEL_RX_TOO_LONG;
+    }
+    else
+    {
+        ptr &= ~(uint32_t)3U;
+        p_desc = (mss_mac_rx_desc_t *)model_dma_addr(*p_mac->upper_rx_q_base, ptr);
+        addr_low = p_desc->addr_low;
+
+        if (0U != (addr_low & GEM_RX_DMA_USED))
+        {
+            /* Frame is dropped and the pointer stays on the used descriptor */
+            p_mac->rsr |= GEM_BUFFER_NOT_AVAILABLE;
+            p_mac->int_latched[queue_no] |= GEM_RX_USED_BIT_READ;
+            p_mac->stats.rx_no_buffer++;
+            result = GEM_MODEL_RX_NO_BUFFER;
+        }
+        else
+        {
+#if defined(MSS_MAC_64_BIT_ADDRESS_MODE)
+            (void)memcpy(model_dma_addr(p_desc->addr_high, addr_low & ~(uint32_t)3U),
+                         p_frame, length);
+#else
+            (void)memcpy(model_dma_addr(0U, addr_low & ~(uint32_t)3U), p_frame, length);
+#endif
+            p_desc->status = (length & (GEM_RX_DMA_BUFF_LEN | GEM_RX_DMA_JUMBO_BIT_13)) |
+                             GEM_RX_DMA_START_OF_FRAME | GEM_RX_DMA_END_OF_FRAME;
+            p_desc->addr_low = addr_low | GEM_RX_DMA_USED;
+
+            ptr = model_next_ptr(ptr, p_mac->rx_base[queue_no], addr_low & GEM_RX_DMA_WRAP,
+                                 (uint32_t)sizeof(mss_mac_rx_desc_t), &p_mac->stats.rx_wraps);
+            *p_mac->receive_q_ptr[queue_no] = ptr;
+            p_mac->rx_seen[queue_no] = ptr;
+
+            p_mac->rsr |= GEM_FRAME_RECEIVED;
+            p_mac->int_latched[queue_no] |= GEM_RECEIVE_COMPLETE;
+            p_mac->stats.rx_frames++;
+            p_mac->stats.rx_bytes += length;
+            result = GEM_MODEL_RX_OK;
+        }
+    }
+
+    model_sync(p_mac);
+
+    return (result);
+}
+
+/******************************************************************************
+ * See gem_model.h for details of how to use this function.
+ */
+uint32_t
+gem_model_service(void)
+{
+    gem_model_mac_t *p_mac;
+    uint32_t calls = 0U;
+    uint32_t loops = 0U;
+    uint32_t delivered = 1U;
+    uint32_t presented;
+    uint32_t gem;
+    uint32_t mac;
+    uint32_t queue_no;
+
+    while (0U != delivered)
+    {
+        delivered = 0U;
+        for (gem = 0U; gem < GEM_MODEL_GEM_COUNT; gem++)
+        {
+            for (mac = 0U; mac < 2U; mac++)
+            {
+                p_mac = &g_model_macs[gem][mac];
+                model_sync(p_mac);
+
+                for (queue_no = 0U; queue_no < p_mac->queue_count; queue_no++)
+                {
+                    presented = p_mac->int_latched[queue_no];
+                    if ((0U != (presented & p_mac->int_enabled[queue_no] & GEM_MODEL_INTS)) &&
+                        (0U != model_plic_enabled(p_mac->irq[queue_no])))
+                    {
+                        (void)p_mac->handler[queue_no]();
+
+                        /* The handler acknowledges everything it was shown */
+                        p_mac->int_latched[queue_no] &= ~presented;
+                        p_mac->int_seen[queue_no] = *p_mac->int_status[queue_no];
+                        model_sync(p_mac);
+
+                        p_mac->stats.irqs[queue_no]++;
+                        calls++;
+                        delivered = 1U;
+                    }
+                }
+            }
+        }
+
+        loops++;
+        ASSERT(loops < GEM_MODEL_MAX_SERVICE_LOOPS);
+        if (loops >= GEM_MODEL_MAX_SERVICE_LOOPS)
+        {
+            delivered = 0U;
+        }
+    }
+
+    return (calls);
+}
+
+/******************************************************************************
+ * See gem_model.h for details of how to use this function.
+ */
+uint32_t
+gem_model_run(void)
+{
+    uint32_t total = 0U;
+    uint32_t sent = 1U;
+    uint32_t gem;
+
+    while (0U != sent)
+    {
+        /*
+         * One frame at a time with the interrupts serviced in between, as the
+         * interrupt latency on the target is well below a frame time.
+         */
+        sent = 0U;
+        for (gem = 0U; gem < GEM_MODEL_GEM_COUNT; gem++)
+        {
+            sent += gem_model_transmit(gem, 0U, 1U);
+            (void)gem_model_service();
+            sent += gem_model_transmit(gem, 1U, 1U);
+            (void)gem_model_service();
+        }
+
+        total += sent;
+    }
+
+    return (total);
+}
+
+/******************************************************************************
+ * See gem_model.h for details of how to use this function.
+ */
+uint32_t
+gem_model_tx_queue_ptr(uint32_t gem, uint32_t is_emac, uint32_t queue_no)
+{
+    gem_model_mac_t *p_mac = &g_model_macs[gem][(0U != is_emac) ? 1U : 0U];
+
+    model_sync(p_mac);
+
+    return (*p_mac->transmit_q_ptr[queue_no]);
+}
+
+/******************************************************************************
+ * See gem_model.h for details of how to use this function.
+ */
+uint32_t
+gem_model_rx_queue_ptr(uint32_t gem, uint32_t is_emac, uint32_t queue_no)
+{
+    gem_model_mac_t *p_mac = &g_model_macs[gem][(0U != is_emac) ? 1U : 0U];
+
+    model_sync(p_mac);
+
+    return (*p_mac->receive_q_ptr[queue_no]);
+}
+
+/******************************************************************************
+ * See gem_model.h for details of how to use this function.
+ */
+const gem_model_stats_t *
+gem_model_get_stats(uint32_t gem, uint32_t is_emac)
+{
+    return (&g_model_macs[gem][(0U != is_emac) ? 1U : 0U].stats);
+}
@@ -0,0 +1,165 @@
+/*******************************************************************************
+ * Copyright 2019 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file gem_model.h
+ * @author Microchip FPGA Embedded Systems Solutions
+ * @brief Host software model of the PolarFire SoC GEM DMA interface.
+ *
+ * The model provides the pMAC and eMAC register blocks of GEM0 and GEM1 as
+ * ordinary memory and implements the part of the GEM the MSS Ethernet MAC
+ * driver's data path depends on:
+ *
+ *  - Transmit and receive descriptor rings. The queue pointer registers hold
+ *    the address of the descriptor the DMA engine will use next, as on the
+ *    GEM. Writing one also sets the base the engine returns to when it
+ *    follows a WRAP bit.
+ *  - The USED bit. Transmit stops at a descriptor with USED set and the model
+ *    sets USED in the first descriptor of each frame it has sent. A frame
+ *    arriving at a receive descriptor with USED set is dropped and reported
+ *    with the RX used bit read status and interrupt.
+ *  - Completion interrupts. Receive complete, RX used bit read and transmit
+ *    complete are latched per queue and delivered by calling the driver's
+ *    PLIC interrupt handler when the queue interrupt is enabled in the GEM
+ *    and the PLIC line is enabled on any hart.
+ *
+ * Nothing runs concurrently with the driver. The model looks at the registers
+ * and moves data only when one of the functions below is called, so a test
+ * decides exactly where in a driver sequence the hardware makes progress.
+ *
+ * Because the registers are plain memory the model cannot see individual
+ * writes, only the value left behind:
+ *
+ *  - INT_ENABLE and INT_DISABLE are cleared each time the model looks at them
+ *    so any value found there is a new write. If the driver has written both
+ *    the disable is applied first, matching its reset sequence.
+ *  - Bit 31 of TRANSMIT_STATUS and RECEIVE_STATUS is reserved on the GEM. The
+ *    model keeps it set so a write of any other value is seen as a write one
+ *    to clear.
+ *  - The interrupt status bits presented to a handler are cleared when the
+ *    handler returns, as the driver's handler acknowledges everything it
+ *    reads. Outside a handler a changed INT_STATUS value is taken as a write
+ *    one to clear.
+ *
+ * Only the PLIC interrupt routing is modelled. Receive frames must fit in one
+ * receive buffer, as configured by the driver. Longer frames are dropped and
+ * counted.
+ *
+ * Descriptors and buffers are addressed through the low 32 bits stored by the
+ * driver plus the upper queue base address registers or the descriptor high
+ * word, so the harness must be linked as a non position independent
+ * executable to keep its static data below 4GB.
+ *
+ */
+
+#ifndef GEM_MODEL_H_
+#define GEM_MODEL_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define GEM_MODEL_GEM_COUNT     (2U)
+#define GEM_MODEL_QUEUE_COUNT   (4U)
+
+/* gem_model_receive() results */
+#define GEM_MODEL_RX_OK         (0)
+#define GEM_MODEL_RX_DISABLED   (1) /* Receive or the queue is not enabled */
+#define GEM_MODEL_RX_NO_BUFFER  (2) /* Descriptor had USED set, frame dropped */
+#define GEM_MODEL_RX_TOO_LONG   (3) /* Frame larger than the receive buffer */
+
+typedef struct
+{
+    uint64_t tx_frames;        /* Frames passed to the transmit hook */
+    uint64_t tx_bytes;
+    uint64_t tx_used_halts;    /* Transmit stopped at a USED descriptor */
+    uint64_t tx_underruns;     /* USED descriptor found part way through a frame */
+    uint64_t tx_wraps;         /* WRAP bits followed by the transmit engine */
+    uint64_t rx_frames;        /* Frames written to receive buffers */
+    uint64_t rx_bytes;
+    uint64_t rx_no_buffer;     /* Frames dropped at a USED receive descriptor */
+    uint64_t rx_disabled;      /* Frames dropped with receive disabled */
+    uint64_t rx_too_long;
+    uint64_t rx_wraps;         /* WRAP bits followed by the receive engine */
+    uint64_t irqs[GEM_MODEL_QUEUE_COUNT]; /* Handler calls per queue */
+} gem_model_stats_t;
+
+/*
+ * Called for every frame the transmit engine sends. The frame is only valid
+ * for the duration of the call.
+ */
+typedef void (*gem_model_tx_hook_t)(uint32_t gem,
+                                    uint32_t is_emac,
+                                    uint32_t queue_no,
+                                    const uint8_t *p_frame,
+                                    uint32_t length,
+                                    void *p_user);
+
+/*******************************************************************************
+ * Returns every register block and model state to its reset value and removes
+ * the transmit hook. Call before MSS_MAC_init().
+ */
+void gem_model_reset(void);
+
+/*******************************************************************************
+ * Returns the address of the pMAC (is_emac == 0) or eMAC register block of a
+ * GEM. Used for the MSS_MAC0_BASE et al overrides.
+ */
+uint64_t gem_model_reg_base(uint32_t gem, uint32_t is_emac);
+
+/*******************************************************************************
+ * Sets the function which receives transmitted frames.
+ */
+void gem_model_set_tx_hook(gem_model_tx_hook_t hook, void *p_user);
+
+/*******************************************************************************
+ * Runs the transmit engine of one MAC for at most budget frames. The engine
+ * only runs after the driver has set TRANSMIT_START and stops once every
+ * enabled queue has reached a USED descriptor. Returns the number of frames
+ * sent. Interrupts are latched but not delivered.
+ */
+uint32_t gem_model_transmit(uint32_t gem, uint32_t is_emac, uint32_t budget);
+
+/*******************************************************************************
+ * Delivers one frame to a receive queue of one MAC. Returns one of the
+ * GEM_MODEL_RX_ results. Interrupts are latched but not delivered.
+ */
+int32_t gem_model_receive(uint32_t gem,
+                          uint32_t is_emac,
+                          uint32_t queue_no,
+                          const uint8_t *p_frame,
+                          uint32_t length);
+
+/*******************************************************************************
+ * Picks up register writes made by the driver and calls the interrupt handler
+ * for every queue with an enabled interrupt pending, repeating until none is
+ * left. Returns the number of handler calls.
+ */
+uint32_t gem_model_service(void);
+
+/*******************************************************************************
+ * Runs all transmit engines until none has work left, one frame at a time
+ * with interrupts serviced after each. Returns the number of frames sent.
+ */
+uint32_t gem_model_run(void);
+
+/*******************************************************************************
+ * Returns the queue register value the transmit or receive engine will use
+ * next, i.e. the descriptor address with the queue disable bit.
+ */
+uint32_t gem_model_tx_queue_ptr(uint32_t gem, uint32_t is_emac, uint32_t queue_no);
+uint32_t gem_model_rx_queue_ptr(uint32_t gem, uint32_t is_emac, uint32_t queue_no);
+
+/*******************************************************************************
+ * Returns the statistics of one MAC.
+ */
+const gem_model_stats_t *gem_model_get_stats(uint32_t gem, uint32_t is_emac);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* GEM_MODEL_H_ */
@@ -0,0 +1,33 @@
+/*******************************************************************************
+ * Copyright 2019 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * @file hal_assert.h
+ * @author Microchip FPGA Embedded Systems Solutions
+ * @brief Host replacement for hal/hal_assert.h. Assertions abort the harness
+ * through the C library instead of executing an ebreak.
+ *
+ */
+#ifndef HAL_ASSERT_HEADER
+#define HAL_ASSERT_HEADER
+
+#include <assert.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if defined(NDEBUG)
+#define ASSERT(CHECK)
+#define HAL_ASSERT(CHECK)
+#else
+#define ASSERT(CHECK)     assert(CHECK)
+#define HAL_ASSERT(CHECK) ASSERT(CHECK);
+#endif /* NDEBUG */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* HAL_ASSERT_HEADER */
@@ -0,0 +1,209 @@
+/*******************************************************************************
+ * Copyright 2019-2022 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software
+ *
+ */
+
+/*******************************************************************************
+ * @file mss_hal.h
+ * @author Microchip-FPGA Embedded Systems Solutions
+ * @brief Host replacement for the MPFS HAL include file.
+ *
+ * This takes the place of mpfs_hal/mss_hal.h when the MSS Ethernet MAC driver
+ * is built for Linux. It provides only what the driver uses. The SYSREG and
+ * PLIC blocks are ordinary memory and the PLIC enables are read back by the
+ * GEM model to decide whether a queue interrupt can be delivered.
+ *
+ */
+
+#ifndef MSS_HAL_H
+#define MSS_HAL_H
+
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "hal/hal_assert.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define mb() __atomic_thread_fence(__ATOMIC_SEQ_CST)
+
+/*------------------------------------------------------------------------------
+ * System registers. Only the fields the MAC driver touches are present.
+ */
+typedef struct
+{
+    volatile uint32_t SOFT_RESET_CR;
+    volatile uint32_t SUBBLK_CLOCK_CR;
+    volatile uint32_t APBBUS_CR;
+    volatile uint32_t MAC_CR;
+} SYSREG_TypeDef;
+
+extern SYSREG_TypeDef g_host_sysreg;
+
+#define SYSREG (&g_host_sysreg)
+
+/*------------------------------------------------------------------------------
+ * PLIC. The interrupt numbers match mss_plic.h.
+ */
+#define OFFSET_TO_MSS_GLOBAL_INTS 13U
+
+typedef enum
+{
+    PLIC_INVALID_INT_OFFSET     = 0,
+    PLIC_MAC0_INT_INT_OFFSET    = 51 + OFFSET_TO_MSS_GLOBAL_INTS,
+    PLIC_MAC0_QUEUE1_INT_OFFSET = 52 + OFFSET_TO_MSS_GLOBAL_INTS,
+    PLIC_MAC0_QUEUE2_INT_OFFSET = 53 + OFFSET_TO_MSS_GLOBAL_INTS,
+    PLIC_MAC0_QUEUE3_INT_OFFSET = 54 + OFFSET_TO_MSS_GLOBAL_INTS,
+    PLIC_MAC0_EMAC_INT_OFFSET   = 55 + OFFSET_TO_MSS_GLOBAL_INTS,
+    PLIC_MAC0_MMSL_INT_OFFSET   = 56 + OFFSET_TO_MSS_GLOBAL_INTS,
+    PLIC_MAC1_INT_INT_OFFSET    = 57 + OFFSET_TO_MSS_GLOBAL_INTS,
+    PLIC_MAC1_QUEUE1_INT_OFFSET = 58 + OFFSET_TO_MSS_GLOBAL_INTS,
+    PLIC_MAC1_QUEUE2_INT_OFFSET = 59 + OFFSET_TO_MSS_GLOBAL_INTS,
+    PLIC_MAC1_QUEUE3_INT_OFFSET = 60 + OFFSET_TO_MSS_GLOBAL_INTS,
+    PLIC_MAC1_EMAC_INT_OFFSET   = 61 + OFFSET_TO_MSS_GLOBAL_INTS,
+    PLIC_MAC1_MMSL_INT_OFFSET   = 62 + OFFSET_TO_MSS_GLOBAL_INTS
+} PLIC_IRQn_Type;
+
+#define INVALID_IRQn     PLIC_INVALID_INT_OFFSET
+#define MAC0_INT_PLIC    PLIC_MAC0_INT_INT_OFFSET
+#define MAC0_QUEUE1_PLIC PLIC_MAC0_QUEUE1_INT_OFFSET
+#define MAC0_QUEUE2_PLIC PLIC_MAC0_QUEUE2_INT_OFFSET
+#define MAC0_QUEUE3_PLIC PLIC_MAC0_QUEUE3_INT_OFFSET
+#define MAC0_EMAC_PLIC   PLIC_MAC0_EMAC_INT_OFFSET
+#define MAC0_MMSL_PLIC   PLIC_MAC0_MMSL_INT_OFFSET
+#define MAC1_INT_PLIC    PLIC_MAC1_INT_INT_OFFSET
+#define MAC1_QUEUE1_PLIC PLIC_MAC1_QUEUE1_INT_OFFSET
+#define MAC1_QUEUE2_PLIC PLIC_MAC1_QUEUE2_INT_OFFSET
+#define MAC1_QUEUE3_PLIC PLIC_MAC1_QUEUE3_INT_OFFSET
+#define MAC1_EMAC_PLIC   PLIC_MAC1_EMAC_INT_OFFSET
+#define MAC1_MMSL_PLIC   PLIC_MAC1_MMSL_INT_OFFSET
+
+#define EXT_IRQ_KEEP_ENABLED 0U
+
+#define PLIC_SET_UP_REGISTERS 6U
+#define PLIC_NUM_SOURCES      187U
+
+typedef struct
+{
+    volatile uint32_t SOURCE_PRIORITY[PLIC_NUM_SOURCES];
+    volatile uint32_t HART0_MMODE_ENA[PLIC_SET_UP_REGISTERS];
+    volatile uint32_t HART1_MMODE_ENA[PLIC_SET_UP_REGISTERS];
+    volatile uint32_t HART2_MMODE_ENA[PLIC_SET_UP_REGISTERS];
+    volatile uint32_t HART3_MMODE_ENA[PLIC_SET_UP_REGISTERS];
+    volatile uint32_t HART4_MMODE_ENA[PLIC_SET_UP_REGISTERS];
+} PLIC_Type;
+
+extern PLIC_Type g_host_plic;
+
+#define PLIC (&g_host_plic)
+
+/*
+ * The hart the driver is running on as far as the PLIC enables are concerned.
+ * Defaults to U54_1.
+ */
+extern uint32_t g_host_hart_id;
+
+static inline volatile uint32_t *
+host_plic_hart_enables(uint32_t hart_id)
+{
+    volatile uint32_t *p_enables;
+
+    switch (hart_id)
+    {
+        case 0U:
+            p_enables = PLIC->HART0_MMODE_ENA;
+            break;
+
+        case 1U:
+            p_enables = PLIC->HART1_MMODE_ENA;
+            break;
+
+        case 2U:
+            p_enables = PLIC->HART2_MMODE_ENA;
+            break;
+
+        case 3U:
+            p_enables = PLIC->HART3_MMODE_ENA;
+            break;
+
+        default:
+            p_enables = PLIC->HART4_MMODE_ENA;
+            break;
+    }
+
+    return (p_enables);
+}
+
+static inline void
+PLIC_EnableIRQ(PLIC_IRQn_Type IRQn)
+{
+    host_plic_hart_enables(g_host_hart_id)[IRQn / 32U] |= (uint32_t)1 << (IRQn % 32U);
+}
+
+static inline void
+PLIC_DisableIRQ(PLIC_IRQn_Type IRQn)
+{
+    host_plic_hart_enables(g_host_hart_id)[IRQn / 32U] &= ~((uint32_t)1 << (IRQn % 32U));
+}
+
+static inline void
+PLIC_SetPriority(PLIC_IRQn_Type IRQn, uint32_t priority)
+{
+    if ((IRQn > PLIC_INVALID_INT_OFFSET) && (IRQn < PLIC_NUM_SOURCES))
+    {
+        PLIC->SOURCE_PRIORITY[IRQn - 1] = priority;
+    }
+}
+
+/*
+ * GEM interrupt handlers, provided by the MAC driver and called by the GEM
+ * model in place of the PLIC dispatch in mss_plic.c.
+ */
+uint8_t  PLIC_mac0_int_IRQHandler(void);
+uint8_t  PLIC_mac0_queue1_IRQHandler(void);
+uint8_t  PLIC_mac0_queue2_IRQHandler(void);
+uint8_t  PLIC_mac0_queue3_IRQHandler(void);
+uint8_t  PLIC_mac0_emac_IRQHandler(void);
+uint8_t  PLIC_mac1_int_IRQHandler(void);
+uint8_t  PLIC_mac1_queue1_IRQHandler(void);
+uint8_t  PLIC_mac1_queue2_IRQHandler(void);
+uint8_t  PLIC_mac1_queue3_IRQHandler(void);
+uint8_t  PLIC_mac1_emac_IRQHandler(void);
+
+/*------------------------------------------------------------------------------
+ * Local interrupts. The numbers match mss_legacy_defines.h. The model only
+ * delivers PLIC interrupts so these just record the enable state.
+ */
+#define LOCAL_INT_UNUSED    127U
+
+#define MAC0_INT_U54_INT    8
+#define MAC0_QUEUE1_U54_INT 7
+#define MAC0_QUEUE2_U54_INT 6
+#define MAC0_QUEUE3_U54_INT 5
+#define MAC0_EMAC_U54_INT   4
+#define MAC0_MMSL_U54_INT   3
+
+#define MAC1_INT_U54_INT    8
+#define MAC1_QUEUE1_U54_INT 7
+#define MAC1_QUEUE2_U54_INT 6
+#define MAC1_QUEUE3_U54_INT 5
+#define MAC1_EMAC_U54_INT   4
+#define MAC1_MMSL_U54_INT   3
+
+extern uint64_t g_host_local_irq_enables;
+
+void __enable_local_irq(uint8_t local_interrupt);
+void __disable_local_irq(uint8_t local_interrupt);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MSS_HAL_H */
@@ -0,0 +1,66 @@
+/*******************************************************************************
+ * Copyright 2019-2022 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * MPFS HAL Embedded Software
+ *
+ */
+
+/*******************************************************************************
+ * @file mss_hal_host.c
+ * @author Microchip-FPGA Embedded Systems Solutions
+ * @brief Storage and functions behind the host replacement for mss_hal.h.
+ *
+ */
+
+#include "mpfs_hal/mss_hal.h"
+#include "hal/hal.h"
+
+SYSREG_TypeDef g_host_sysreg;
+PLIC_Type g_host_plic;
+uint32_t g_host_hart_id = 1U;
+uint64_t g_host_local_irq_enables = 0U;
+
+/*******************************************************************************
+ *
+ */
+void
+__enable_local_irq(uint8_t local_interrupt)
+{
+    if (local_interrupt < 64U)
+    {
+        g_host_local_irq_enables |= (uint64_t)1U << local_interrupt;
+    }
+}
+
+/*******************************************************************************
+ *
+ */
+void
+__disable_local_irq(uint8_t local_interrupt)
+{
+    if (local_interrupt < 64U)
+    {
+        g_host_local_irq_enables &= ~((uint64_t)1U << local_interrupt);
+    }
+}
+
+/*******************************************************************************
+ * The harness is single threaded and interrupts are only ever delivered by the
+ * GEM model between driver calls, so there is nothing to mask here.
+ */
+psr_t
+HAL_disable_interrupts(void)
+{
+    return (0U);
+}
+
+/*******************************************************************************
+ *
+ */
+void
+HAL_restore_interrupts(psr_t saved_psr)
+{
+    (void)saved_psr;
+}
@@ -36,6 +36,35 @@ extern "C" {
 /* size of address space taken by one stream descriptor address register*/
 #define STREAM_DESC_ADD_SPACE				    (0x04u)
 
+/* flow control bits of a descriptor configuration word */
+#define DESC_CFG_FLOW_CONTROL_MASK              (ID0CFG_SRCDVALID_MASK | \
+                                                 ID0CFG_DESTDRDY_MASK | \
+                                                 ID0CFG_DESCVALID_MASK)
+
+/* configuration word of the link between two external descriptors */
+#define EXT_DESC_LINK_MASK                      (ID0CFG_CHAIN_MASK | \
+                                                 ID0CFG_EXDESC_MASK)
+
+/* memory barrier ordering descriptor words before the configuration word */
+#ifndef AXI4DMA_DESC_BARRIER
+#define AXI4DMA_DESC_BARRIER()                  __sync_synchronize()
+#endif
+
+static void
+commit_internal_desc
+(
+    axi4dma_instance_t* this_dmac,
+    axi4dma_desc_id_t desc_id,
+    const axi4dma_ext_desc_t* shadow
+);
+
+static void
+arm_stream_desc
+(
+    axi4dma_stream_ring_t* ring,
+    uint32_t slot
+);
+
 /***************************************************************************//**
  * See core_axi4dmacontroller.h for description of this function.
  */
@@ -61,6 +90,9 @@ AXI4DMA_init
             this_dmac->intr_mask[idx] = 0x0u;
         }
 
+        /* Nothing is known about the descriptor registers yet */
+        this_dmac->shadow_valid = 0x0u;
+
         ret = 0;
     }
 
@@ -177,56 +209,19 @@ AXI4DMA_configure
     if ((NULL_POINTER != this_dmac) && (desc_id <= INTRN_DESC_31) &&
             (0u != byte_count) && (0u != src_addr) && (0u != dest_addr))
     {
-        HAL_set_32bit_reg_field((this_dmac->base_addr + (desc_id * DESC_ADD_SPACE)),
-                                ID0CFG_SRC_OP,
-                                (src_op & ID0CFG_SRC_OP_MASK));    // Source OP
-
-        HAL_set_32bit_reg_field((this_dmac->base_addr + (desc_id * DESC_ADD_SPACE)),
-                                ID0CFG_DEST_OP,
-                                (dest_op & ID0CFG_SRC_OP_MASK));    // Destination OP
-                            
-        HAL_set_32bit_reg_field((this_dmac->base_addr + (desc_id * DESC_ADD_SPACE)),
-                                ID0CFG_CHAIN,
-                                0);                                 //chain = 0
-
-        HAL_set_32bit_reg_field((this_dmac->base_addr + (desc_id * DESC_ADD_SPACE)),
-                                ID0CFG_EXDESC,
-                                0);                                 //Ext Desc = 0
-
-        //single descriptor without chain bit always generates interrupt
-        //Next Descriptor ignored
-
-        HAL_set_32bit_reg_field((this_dmac->base_addr + (desc_id * DESC_ADD_SPACE)),
-                                ID0BYTECNT_NUM,
-                                byte_count);                        //Byte count
-
-        HAL_set_32bit_reg_field((this_dmac->base_addr + (desc_id * DESC_ADD_SPACE)),
-                                ID0SRCADDR_ADDR,
-                                src_addr);                         //Source Address
-
-        HAL_set_32bit_reg_field((this_dmac->base_addr + (desc_id * DESC_ADD_SPACE)),
-                                ID0DESTADDR_ADDR,
-                                dest_addr);                        //Destination address
-
-        /* Desc_valid bit must be written last as any changes to desc registers clears this bit
-         * automatically if it was set.
-         * Data Valid and Desc_valid bit are being set together as there could be a chance that
-         * if start bit is already set or external Start input line is already high and Data Valid
-         * is set before setting desc_valid bit could result rarely into interrupt for starting on
-         * invalid descriptor.
-         * */
-
-        HAL_set_32bit_reg_field((this_dmac->base_addr + (desc_id * DESC_ADD_SPACE)),
-                                    ID0CFG_SRCDVALID,
-                                    0x1);   // Setting the source data valid bit
-
-        HAL_set_32bit_reg_field((this_dmac->base_addr + (desc_id * DESC_ADD_SPACE)),
-                                    ID0CFG_DESTDRDY,
-                                    0x1);   // Setting the destination data ready bit
-
-        HAL_set_32bit_reg_field((this_dmac->base_addr + (desc_id * DESC_ADD_SPACE)),
-                                    ID0CFG_DESCVALID,
-                                    0x1);    // Setting the descriptor valid bit
+        axi4dma_ext_desc_t shadow;
+
+        /* single descriptor without chain bit always generates interrupt,
+         * Next Descriptor ignored */
+        shadow.config = ((src_op << ID0CFG_SRC_OP_SHIFT) & ID0CFG_SRC_OP_MASK) |
+                        ((dest_op << ID0CFG_DEST_OP_SHIFT) & ID0CFG_DEST_OP_MASK) |
+                        DESC_CFG_FLOW_CONTROL_MASK;
+        shadow.xfr_count = byte_count;
+        shadow.src_addr = src_addr;
+        shadow.dest_addr = dest_addr;
+        shadow.next_desc = 0u;
+
+        commit_internal_desc(this_dmac, desc_id, &shadow);
 
         ret = 0;
     }
@@ -262,70 +257,27 @@ AXI4DMA_configure_chain
 
             if(desc_id > INTRN_DESC_31)
             {
-                (*((uint32_t*)desc_id + 1)) = desc_data->xfr_count;
-                (*((uint32_t*)desc_id + 2)) = desc_data->src_addr;
-                (*((uint32_t*)desc_id + 3)) = desc_data->dest_addr;
-                (*((uint32_t*)desc_id + 4)) = desc_data->next_desc;
-                (*(uint32_t*)desc_id) = desc_data->desc_cfg;
+                /* desc_id holds the address of an external descriptor */
+                axi4dma_ext_desc_t* ext_desc = (axi4dma_ext_desc_t*)(uintptr_t)desc_id;
+
+                ext_desc->xfr_count = this_cfg->xfr_count;
+                ext_desc->src_addr = this_cfg->src_addr;
+                ext_desc->dest_addr = this_cfg->dest_addr;
+                ext_desc->next_desc = this_cfg->next_desc;
+                AXI4DMA_DESC_BARRIER();
+                ext_desc->config = this_cfg->desc_cfg | ID0CFG_DESCVALID_MASK;
             }
             else
             {
-                HAL_set_32bit_reg_field((this_dmac->base_addr +
-                                        (desc_id * DESC_ADD_SPACE)),
-                                        ID0CFG_SRC_OP,
-                                        this_cfg->desc_cfg | ID0CFG_SRC_OP_MASK);   //Source OP
-
-                HAL_set_32bit_reg_field((this_dmac->base_addr +
-                                        (desc_id * DESC_ADD_SPACE)),
-                                        ID0CFG_DEST_OP,
-                                        this_cfg->desc_cfg | ID0CFG_DEST_OP_MASK);  //Destination OP
-
-                HAL_set_32bit_reg_field((this_dmac->base_addr +
-                                        (desc_id * DESC_ADD_SPACE)),
-                                        ID0CFG_CHAIN,
-                                        this_cfg->desc_cfg | ID0CFG_CHAIN_MASK);    //chain
-
-                HAL_set_32bit_reg_field((this_dmac->base_addr +
-                                        (desc_id * DESC_ADD_SPACE)),
-                                        ID0CFG_EXDESC,
-                                        (this_cfg->desc_cfg | ID0CFG_EXDESC_MASK)); //Ext Desc
-
-                HAL_set_32bit_reg_field((this_dmac->base_addr +
-                        (desc_id * DESC_ADD_SPACE)),
-                                        ID0CFG_INTR,
-                                        (this_cfg->desc_cfg | ID0CFG_INTR_MASK));   //interrupt on process
-
-                HAL_set_32bit_reg_field((this_dmac->base_addr +
-                                        (desc_id * DESC_ADD_SPACE)),
-                                        ID0NEXTDESC_ADDR,
-                                        this_cfg->next_desc);                       //Next Descriptor
-
-                HAL_set_32bit_reg_field((this_dmac->base_addr +
-                                        (desc_id * DESC_ADD_SPACE)),
-                                        ID0BYTECNT_NUM,
-                                        this_cfg->xfr_count);                       //Byte count
-
-                HAL_set_32bit_reg_field((this_dmac->base_addr +
-                                        (desc_id * DESC_ADD_SPACE)),
-                                        ID0SRCADDR_ADDR,
-                                        this_cfg->src_addr);                        //Source Address
-
-                HAL_set_32bit_reg_field((this_dmac->base_addr +
-                                        (desc_id * DESC_ADD_SPACE)),
-                                        ID0CFG_DESTDRDY,
-                                        this_cfg->dest_addr);                       //Destination address
-
-                /* Desc_valid bit must be written last as any changes to desc registers clears this bit
-                 * automatically if it was set.
-                 * Data Valid and Desc_valid bit are being set together as there could be a chance that
-                 * if start bit is already set or external Start input line is already high and Data Valid
-                 * is set before setting desc_valid bit could result rarely into interrupt for starting on
-                 * invalid descriptor.
-                 * */
-                HAL_set_32bit_reg_field((this_dmac->base_addr +
-                                        (desc_id * DESC_ADD_SPACE)),
-                                        ID0CFG_DESCVALID,
-                                        0x06);    //Data ready and descriptor valid set together
+                axi4dma_ext_desc_t shadow;
+
+                shadow.config = this_cfg->desc_cfg | ID0CFG_DESCVALID_MASK;
+                shadow.xfr_count = this_cfg->xfr_count;
+                shadow.src_addr = this_cfg->src_addr;
+                shadow.dest_addr = this_cfg->dest_addr;
+                shadow.next_desc = this_cfg->next_desc;
+
+                commit_internal_desc(this_dmac, desc_id, &shadow);
             }
         }
 
@@ -335,6 +287,251 @@ AXI4DMA_configure_chain
     return(ret);
 }
 
+/***************************************************************************//**
+ * See core_axi4dmacontroller.h for description of this function.
+ */
+int32_t
+AXI4DMA_ext_chain_init
+(
+    axi4dma_ext_chain_t* chain,
+    axi4dma_ext_desc_t* desc_mem,
+    uint32_t max_desc
+)
+{
+    int32_t ret = PARAM_ERROR;
+
+    HAL_ASSERT(NULL_POINTER != chain);
+    HAL_ASSERT(NULL_POINTER != desc_mem);
+    HAL_ASSERT(0u != max_desc);
+
+    if((NULL_POINTER != chain) && (NULL_POINTER != desc_mem) && (0u != max_desc))
+    {
+        chain->desc = desc_mem;
+        chain->max_desc = max_desc;
+        chain->num_desc = 0u;
+
+        ret = 0;
+    }
+
+    return(ret);
+}
+
+/***************************************************************************//**
+ * See core_axi4dmacontroller.h for description of this function.
+ */
+int32_t
+AXI4DMA_ext_chain_add
+(
+    axi4dma_ext_chain_t* chain,
+    uint32_t desc_cfg,
+    uint32_t xfr_count,
+    uint32_t src_addr,
+    uint32_t dest_addr
+)
+{
+    axi4dma_ext_desc_t* this_desc;
+    int32_t ret = PARAM_ERROR;
+
+    HAL_ASSERT(NULL_POINTER != chain);
+    HAL_ASSERT(0u != xfr_count);
+
+    if((NULL_POINTER != chain) && (chain->num_desc < chain->max_desc) &&
+       (0u != xfr_count))
+    {
+        /* Composed without the valid bit, see AXI4DMA_ext_chain_commit() */
+        this_desc = &chain->desc[chain->num_desc];
+        this_desc->config = desc_cfg & ~(DESC_CFG_FLOW_CONTROL_MASK | EXT_DESC_LINK_MASK);
+        this_desc->config |= desc_cfg & (ID0CFG_SRCDVALID_MASK | ID0CFG_DESTDRDY_MASK);
+        this_desc->xfr_count = xfr_count;
+        this_desc->src_addr = src_addr;
+        this_desc->dest_addr = dest_addr;
+        this_desc->next_desc = 0u;
+
+        ret = (int32_t)chain->num_desc;
+        chain->num_desc++;
+    }
+
+    return(ret);
+}
+
+/***************************************************************************//**
+ * See core_axi4dmacontroller.h for description of this function.
+ */
+uint32_t
+AXI4DMA_ext_chain_commit
+(
+    axi4dma_ext_chain_t* chain
+)
+{
+    uint32_t idx;
+    uint32_t link;
+
+    HAL_ASSERT(NULL_POINTER != chain);
+    HAL_ASSERT(0u != chain->num_desc);
+
+    if((NULL_POINTER == chain) || (0u == chain->num_desc))
+    {
+        return 0u;
+    }
+
+    /* Link each descriptor to the next one while none of them is valid */
+    for(idx = 0u; idx < chain->num_desc; idx++)
+    {
+        chain->desc[idx].config &= ~(ID0CFG_DESCVALID_MASK | EXT_DESC_LINK_MASK);
+
+        if((idx + 1u) < chain->num_desc)
+        {
+            link = (uint32_t)(uintptr_t)&chain->desc[idx + 1u];
+            chain->desc[idx].next_desc = link;
+            chain->desc[idx].config |= EXT_DESC_LINK_MASK;
+        }
+        else
+        {
+            chain->desc[idx].next_desc = 0u;
+        }
+    }
+
+    /* Validate from the tail so that the DMA never follows a link into a
+     * descriptor which is still being written. */
+    idx = chain->num_desc;
+    while(idx > 0u)
+    {
+        idx--;
+        AXI4DMA_DESC_BARRIER();
+        chain->desc[idx].config |= ID0CFG_DESCVALID_MASK;
+    }
+    AXI4DMA_DESC_BARRIER();
+
+    return (uint32_t)(uintptr_t)&chain->desc[0];
+}
+
+/***************************************************************************//**
+ * See core_axi4dmacontroller.h for description of this function.
+ */
+int8_t
+AXI4DMA_configure_ext_chain
+(
+    axi4dma_instance_t* this_dmac,
+    axi4dma_desc_id_t desc_id,
+    axi4dma_ext_chain_t* chain
+)
+{
+    axi4dma_ext_desc_t shadow;
+    uint32_t first_desc;
+    int32_t ret = PARAM_ERROR;
+
+    HAL_ASSERT(NULL_POINTER != this_dmac);
+    HAL_ASSERT(desc_id <= INTRN_DESC_31);
+
+    if((NULL_POINTER != this_dmac) && (desc_id <= INTRN_DESC_31))
+    {
+        first_desc = AXI4DMA_ext_chain_commit(chain);
+
+        if(0u != first_desc)
+        {
+            /* Internal descriptor which only points at the external chain */
+            shadow.config = (OP_NOOP << ID0CFG_SRC_OP_SHIFT) |
+                            (OP_NOOP << ID0CFG_DEST_OP_SHIFT) |
+                            EXT_DESC_LINK_MASK |
+                            DESC_CFG_FLOW_CONTROL_MASK;
+            shadow.xfr_count = 0u;
+            shadow.src_addr = 0u;
+            shadow.dest_addr = 0u;
+            shadow.next_desc = first_desc;
+
+            commit_internal_desc(this_dmac, desc_id, &shadow);
+
+            ret = 0;
+        }
+    }
+
+    return(ret);
+}
+
+/***************************************************************************//**
+ * See core_axi4dmacontroller.h for description of this function.
+ */
+int8_t
+AXI4DMA_stream_ring_init
+(
+    axi4dma_stream_ring_t* ring,
+    axi4dma_instance_t* this_dmac,
+    axi4dma_stream_desc_t* desc_mem,
+    axi4dma_tdest_signal_t tdest_signal_num,
+    uint8_t config,
+    uint32_t buf_addr,
+    uint32_t buf_size,
+    uint32_t num_buf
+)
+{
+    int32_t ret = PARAM_ERROR;
+
+    HAL_ASSERT(NULL_POINTER != ring);
+    HAL_ASSERT(NULL_POINTER != this_dmac);
+    HAL_ASSERT(NULL_POINTER != desc_mem);
+    HAL_ASSERT(0u != buf_addr);
+    HAL_ASSERT(0u != buf_size);
+    HAL_ASSERT(num_buf > 1u);
+    HAL_ASSERT(tdest_signal_num <= TDEST_3);
+
+    if ((NULL_POINTER != ring) && (NULL_POINTER != this_dmac) &&
+        (NULL_POINTER != desc_mem) && (0u != buf_addr) && (0u != buf_size) &&
+        (num_buf > 1u) && (tdest_signal_num <= TDEST_3))
+    {
+        ring->this_dmac = this_dmac;
+        ring->desc = desc_mem;
+        ring->num_buf = num_buf;
+        ring->buf_addr = buf_addr;
+        ring->buf_size = buf_size;
+        ring->tdest = tdest_signal_num;
+        ring->config = config;
+        ring->producer = 0u;
+        ring->consumer = 0u;
+        ring->overruns = 0u;
+
+        arm_stream_desc(ring, 0u);
+
+        ret = 0;
+    }
+
+    return(ret);
+}
+
+/***************************************************************************//**
+ * See core_axi4dmacontroller.h for description of this function.
+ */
+int8_t
+AXI4DMA_stream_ring_isr
+(
+    axi4dma_stream_ring_t* ring,
+    uint32_t ext_desc_addr
+)
+{
+    uint32_t slot = ring->producer % ring->num_buf;
+    int32_t ret = PARAM_ERROR;
+
+    if (ext_desc_addr == (uint32_t)(uintptr_t)&ring->desc[slot])
+    {
+        if ((ring->producer - ring->consumer) < (ring->num_buf - 1u))
+        {
+            /* Hand the buffer to the application and fill the next one */
+            ring->producer++;
+            slot = ring->producer % ring->num_buf;
+        }
+        else
+        {
+            /* Every other buffer is waiting for the application */
+            ring->overruns++;
+        }
+
+        arm_stream_desc(ring, slot);
+
+        ret = 0;
+    }
+
+    return(ret);
+}
+
 /***************************************************************************//**
  * See core_axi4dmacontroller.h for description of this function.
  */
@@ -348,6 +545,97 @@ AXI4DMA_start_transfer
     HAL_set_32bit_reg(this_dmac->base_addr, START, (0x00000001u << desc_id));
 }
 
+/***************************************************************************//**
+ * Writes the stream descriptor of a ring buffer, configuration word last, and
+ * points the stream descriptor address register of the ring's TDEST at it.
+ */
+static void
+arm_stream_desc
+(
+    axi4dma_stream_ring_t* ring,
+    uint32_t slot
+)
+{
+    axi4dma_stream_desc_t* desc = &ring->desc[slot];
+
+    desc->xfr_count = ring->buf_size;
+    desc->dest_addr = ring->buf_addr + (slot * ring->buf_size);
+    AXI4DMA_DESC_BARRIER();
+    desc->config = ring->config;
+    AXI4DMA_DESC_BARRIER();
+
+    HAL_set_32bit_reg((ring->this_dmac->base_addr +
+                      (ring->tdest * STREAM_DESC_ADD_SPACE)),
+                      STR0ADDR,
+                      (0xFFFFFFFFu & (uintptr_t)desc));
+}
+
+/***************************************************************************//**
+ * Writes an internal descriptor from its memory-side shadow. Each register is
+ * written whole, and the byte count and address registers are only written
+ * when they differ from the values last written through the driver. The
+ * configuration register is always written, last, as writing any other
+ * descriptor register clears its valid bit.
+ */
+static void
+commit_internal_desc
+(
+    axi4dma_instance_t* this_dmac,
+    axi4dma_desc_id_t desc_id,
+    const axi4dma_ext_desc_t* shadow
+)
+{
+    uint32_t desc_base = this_dmac->base_addr + (desc_id * DESC_ADD_SPACE);
+    axi4dma_ext_desc_t* last = 0;
+
+    if(desc_id < AXI4DMA_NUM_OF_INTERNAL_DESC)
+    {
+        last = &this_dmac->shadow[desc_id];
+    }
+
+    if((0 == last) || (0u == (this_dmac->shadow_valid & (0x1u << desc_id))))
+    {
+        HAL_set_32bit_reg(desc_base, ID0BYTECNT, shadow->xfr_count);
+        HAL_set_32bit_reg(desc_base, ID0SRCADDR, shadow->src_addr);
+        HAL_set_32bit_reg(desc_base, ID0DESTADDR, shadow->dest_addr);
+        HAL_set_32bit_reg(desc_base, ID0NEXTDESC, shadow->next_desc);
+    }
+    else
+    {
+        if(last->xfr_count != shadow->xfr_count)
+        {
+            HAL_set_32bit_reg(desc_base, ID0BYTECNT, shadow->xfr_count);
+        }
+        if(last->src_addr != shadow->src_addr)
+        {
+            HAL_set_32bit_reg(desc_base, ID0SRCADDR, shadow->src_addr);
+        }
+        if(last->dest_addr != shadow->dest_addr)
+        {
+            HAL_set_32bit_reg(desc_base, ID0DESTADDR, shadow->dest_addr);
+        }
+        if(last->next_desc != shadow->next_desc)
+        {
+            HAL_set_32bit_reg(desc_base, ID0NEXTDESC, shadow->next_desc);
+        }
+    }
+
+    /* Desc_valid bit must be written last as any changes to desc registers clears this bit
+     * automatically if it was set.
+     * Data Valid and Desc_valid bit are being set together as there could be a chance that
+     * if start bit is already set or external Start input line is already high and Data Valid
+     * is set before setting desc_valid bit could result rarely into interrupt for starting on
+     * invalid descriptor.
+     * */
+    HAL_set_32bit_reg(desc_base, ID0CFG, shadow->config);
+
+    if(0 != last)
+    {
+        *last = *shadow;
+        this_dmac->shadow_valid |= (0x1u << desc_id);
+    }
+}
+
 #ifdef __cplusplus
 }
 #endif
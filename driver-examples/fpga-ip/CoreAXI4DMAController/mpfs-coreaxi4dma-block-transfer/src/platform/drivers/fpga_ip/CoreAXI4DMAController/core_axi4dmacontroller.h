@@ -70,6 +70,29 @@
   --------------------------------
   Configuration
   --------------------------------
+  Internal descriptors are configured with AXI4DMA_configure() and
+  AXI4DMA_configure_chain(). The driver composes each descriptor in a
+  memory-side shadow held in the axi4dma_instance_t structure and writes it to
+  the IP with whole register writes, the configuration register last. Byte
+  count and address registers which have not changed since they were last
+  written through the driver are not written again. Reprogramming a chain
+  between frames therefore usually costs one or two fabric register writes per
+  descriptor rather than a read-modify-write of each field.
+
+  The desc_cfg member of axi4dma_desc_t is a complete descriptor configuration
+  word, built from the AXI4DMA_DESC_xxx constants below. The descriptor valid
+  bit is always set by the driver.
+
+  Long chains are best held in memory as external descriptors. An
+  axi4dma_ext_chain_t is set up over an array of axi4dma_ext_desc_t with
+  AXI4DMA_ext_chain_init() and filled with AXI4DMA_ext_chain_add(). The
+  AXI4DMA_configure_ext_chain() function links the descriptors, makes them
+  valid and points an internal descriptor at the head of the chain, which is
+  then started with AXI4DMA_start_transfer(). The descriptor array must be in
+  memory which the IP can reach and which is not cached, or the application
+  must flush it to memory before starting the transfer. To run the chain again
+  with new addresses, call AXI4DMA_ext_chain_init() and add the descriptors
+  again, this only writes memory.
 
   --------------------------------
   Reading and Setting GPIO State
@@ -90,6 +113,26 @@
   number has caused this interrupt. The AXI4DMA_transfer_status() can also be
   used with stream transfer events.
 
+  --------------------------------
+  Continuous Stream Capture
+  --------------------------------
+  A stream descriptor set up with AXI4DMA_configure_stream() captures one
+  buffer. For a continuous stream, AXI4DMA_stream_ring_init() sets up a ring of
+  stream descriptors, one per buffer, and arms the first one. The application
+  calls AXI4DMA_stream_ring_isr() from its interrupt handler when a stream
+  descriptor completes. This re-arms the stream with the descriptor of the next
+  free buffer, so the next buffer fills while the application processes the
+  last one. Between the completion and the re-arm the IP holds off the stream
+  master, so no data is lost as long as the master honours TREADY.
+
+  The application takes filled buffers in order with AXI4DMA_stream_ring_get()
+  and gives each one back with AXI4DMA_stream_ring_release(). One buffer is
+  always owned by the DMA. If a stream descriptor completes while all other
+  buffers are still waiting to be released, the buffer just filled is armed
+  again and its data is dropped. The overruns member of the ring counts these
+  events, and the buffers being processed by the application are never
+  overwritten.
+
  *//*=========================================================================*/
 #ifndef LEGACY_DIR_STRUCTURE
 #include "hal/hal.h"
@@ -156,6 +199,32 @@ extern "C" {
 #define AXI4DMA_DEST_ADDR_VALID                        (0x00000001u << 1u)
 #define AXI4DMA_DESCRIPTOR_VALID                       (0x00000001u << 2u)
 
+/*-------------------------------------------------------------------------*//**
+  Descriptor configuration word
+  ===============================
+  These constant definitions are used to build the desc_cfg member of the
+  axi4dma_desc_t structure and the desc_cfg parameter of
+  AXI4DMA_ext_chain_add().
+
+  | Constant                      | Description                               |
+  |-------------------------------|-------------------------------------------|
+  | AXI4DMA_DESC_SRC_OP(op)       | source operation, axi4dma_op_type_t       |
+  | AXI4DMA_DESC_DEST_OP(op)      | destination operation, axi4dma_op_type_t  |
+  | AXI4DMA_DESC_CHAIN            | another descriptor follows this one       |
+  | AXI4DMA_DESC_EXT_NEXT         | the next descriptor is external           |
+  | AXI4DMA_DESC_INTR             | interrupt when this descriptor completes  |
+  | AXI4DMA_DESC_SRC_DATA_VALID   | source data valid                         |
+  | AXI4DMA_DESC_DEST_DATA_READY  | destination data ready                    |
+
+ */
+#define AXI4DMA_DESC_SRC_OP(op)        (((uint32_t)(op) << ID0CFG_SRC_OP_SHIFT) & ID0CFG_SRC_OP_MASK)
+#define AXI4DMA_DESC_DEST_OP(op)       (((uint32_t)(op) << ID0CFG_DEST_OP_SHIFT) & ID0CFG_DEST_OP_MASK)
+#define AXI4DMA_DESC_CHAIN             ID0CFG_CHAIN_MASK
+#define AXI4DMA_DESC_EXT_NEXT          ID0CFG_EXDESC_MASK
+#define AXI4DMA_DESC_INTR              ID0CFG_INTR_MASK
+#define AXI4DMA_DESC_SRC_DATA_VALID    ID0CFG_SRCDVALID_MASK
+#define AXI4DMA_DESC_DEST_DATA_READY   ID0CFG_DESTDRDY_MASK
+
 typedef enum __axi4dma_desc_id
 {
     INTRN_DESC_0 = 0,
@@ -248,11 +317,55 @@ typedef struct
 } axi4dma_stream_desc_t;
 
 /*******************************************************************************
+ * Layout of an external descriptor in memory. The same layout is used for the
+ * driver's shadow of the internal descriptor registers.
  */
 typedef struct
+{
+    uint32_t config;
+    uint32_t xfr_count;
+    uint32_t src_addr;
+    uint32_t dest_addr;
+    uint32_t next_desc;
+} axi4dma_ext_desc_t;
+
+/*******************************************************************************
+ * Ring of stream buffers, see AXI4DMA_stream_ring_init(). The producer and
+ * consumer members are free running counts of the buffers filled by the DMA
+ * and released by the application.
+ */
+typedef struct
+{
+    struct axi4dma_instance*    this_dmac;
+    axi4dma_stream_desc_t*      desc;
+    uint32_t                    num_buf;
+    uint32_t                    buf_addr;
+    uint32_t                    buf_size;
+    axi4dma_tdest_signal_t      tdest;
+    uint8_t                     config;
+    volatile uint32_t           producer;
+    volatile uint32_t           consumer;
+    volatile uint32_t           overruns;
+} axi4dma_stream_ring_t;
+
+/*******************************************************************************
+ * Chain of external descriptors, see AXI4DMA_ext_chain_init().
+ */
+typedef struct
+{
+    axi4dma_ext_desc_t*         desc;
+    uint32_t                    max_desc;
+    uint32_t                    num_desc;
+} axi4dma_ext_chain_t;
+
+/*******************************************************************************
+ */
+typedef struct axi4dma_instance
 {
     uint32_t                    base_addr;
     uint32_t                    intr_mask[AXI4DMA_NUM_OF_INTERRUPTS];
+    axi4dma_ext_desc_t          shadow[AXI4DMA_NUM_OF_INTERNAL_DESC];
+    uint32_t                    shadow_valid;
 } axi4dma_instance_t;
 
 /*-------------------------------------------------------------------------*//**
@@ -594,6 +707,28 @@ AXI4DMA_configure
     uint32_t dest_addr
 );
 
+/*-------------------------------------------------------------------------*//**
+  The AXI4DMA_configure_chain() function configures num_desc descriptors from
+  the desc_data array. Internal descriptors are written to the IP from the
+  driver's shadow, see the Configuration section above. A desc_id greater than
+  INTRN_DESC_31 is taken to be the address of an external descriptor, which is
+  written in memory with its configuration word last.
+
+  @param this_dmac
+    The this_dmac parameter is a pointer to a axi4dma_instance_t structure which
+    holds all data regarding this instance of the CoreAXI4DMAController.
+
+  @param desc_data
+    The desc_data parameter points to an array of descriptor settings. The
+    desc_cfg member of each is built from the AXI4DMA_DESC_xxx constants.
+
+  @param num_desc
+    The num_desc parameter is the number of entries in desc_data.
+
+   @return
+    This function returns zero value on successful execution. A negative value
+    is returned in case of error.
+ */
 int8_t
 AXI4DMA_configure_chain
 (
@@ -602,6 +737,271 @@ AXI4DMA_configure_chain
     uint8_t num_desc
 );
 
+/*-------------------------------------------------------------------------*//**
+  The AXI4DMA_ext_chain_init() function sets up an empty chain of external
+  descriptors over the desc_mem array.
+
+  @param chain
+    The chain parameter is a pointer to the axi4dma_ext_chain_t structure to
+    set up.
+
+  @param desc_mem
+    The desc_mem parameter points to an array of max_desc descriptors in memory
+    which the CoreAXI4DMAController IP can access.
+
+  @param max_desc
+    The max_desc parameter is the number of descriptors in desc_mem.
+
+   @return
+    This function returns zero value on successful execution. A negative value
+    is returned in case of error.
+ */
+int32_t
+AXI4DMA_ext_chain_init
+(
+    axi4dma_ext_chain_t* chain,
+    axi4dma_ext_desc_t* desc_mem,
+    uint32_t max_desc
+);
+
+/*-------------------------------------------------------------------------*//**
+  The AXI4DMA_ext_chain_add() function appends a descriptor to the chain. The
+  descriptor is only written to memory. It is linked to the next descriptor and
+  made valid by AXI4DMA_ext_chain_commit().
+
+  @param chain
+    The chain parameter is a pointer to a chain set up by
+    AXI4DMA_ext_chain_init().
+
+  @param desc_cfg
+    The desc_cfg parameter is built from AXI4DMA_DESC_SRC_OP(),
+    AXI4DMA_DESC_DEST_OP(), AXI4DMA_DESC_INTR, AXI4DMA_DESC_SRC_DATA_VALID and
+    AXI4DMA_DESC_DEST_DATA_READY. The chain bits are set by the driver.
+
+  @param xfr_count
+    The xfr_count parameter is the number of bytes to transfer.
+
+  @param src_addr
+    The src_addr parameter is the source address.
+
+  @param dest_addr
+    The dest_addr parameter is the destination address.
+
+   @return
+    This function returns the index of the descriptor in the chain. A negative
+    value is returned if the chain is full or a parameter is invalid.
+ */
+int32_t
+AXI4DMA_ext_chain_add
+(
+    axi4dma_ext_chain_t* chain,
+    uint32_t desc_cfg,
+    uint32_t xfr_count,
+    uint32_t src_addr,
+    uint32_t dest_addr
+);
+
+/*-------------------------------------------------------------------------*//**
+  The AXI4DMA_ext_chain_commit() function links each descriptor of the chain
+  to the next and then sets the descriptor valid bits, starting from the last
+  descriptor.
+
+  @param chain
+    The chain parameter is a pointer to a chain set up by
+    AXI4DMA_ext_chain_init().
+
+   @return
+    This function returns the address of the first descriptor, to be used as
+    the next descriptor of an internal descriptor. Zero is returned if the
+    chain is empty.
+ */
+uint32_t
+AXI4DMA_ext_chain_commit
+(
+    axi4dma_ext_chain_t* chain
+);
+
+/*-------------------------------------------------------------------------*//**
+  The AXI4DMA_configure_ext_chain() function commits the chain and configures
+  the internal descriptor desc_id to point at its first descriptor. The chain
+  is started by calling AXI4DMA_start_transfer() for desc_id.
+
+  @param this_dmac
+    The this_dmac parameter is a pointer to a axi4dma_instance_t structure which
+    holds all data regarding this instance of the CoreAXI4DMAController.
+
+  @param desc_id
+    The desc_id parameter is the internal descriptor used to start the chain.
+
+  @param chain
+    The chain parameter is a pointer to a chain set up by
+    AXI4DMA_ext_chain_init().
+
+   @return
+    This function returns zero value on successful execution. A negative value
+    is returned in case of error.
+
+  Example:
+
+  @code
+    static axi4dma_ext_desc_t g_desc_mem[32];
+    axi4dma_ext_chain_t chain;
+    uint32_t idx;
+
+    AXI4DMA_ext_chain_init(&chain, g_desc_mem, 32u);
+    for (idx = 0u; idx < 32u; idx++)
+    {
+        AXI4DMA_ext_chain_add(&chain,
+                              AXI4DMA_DESC_SRC_OP(OP_INC_ADDR) |
+                              AXI4DMA_DESC_DEST_OP(OP_INC_ADDR) |
+                              AXI4DMA_DESC_SRC_DATA_VALID |
+                              AXI4DMA_DESC_DEST_DATA_READY,
+                              FRAME_SIZE,
+                              src_addr + (idx * FRAME_SIZE),
+                              dest_addr + (idx * FRAME_SIZE));
+    }
+    AXI4DMA_configure_ext_chain(&g_dmac, INTRN_DESC_0, &chain);
+    AXI4DMA_start_transfer(&g_dmac, INTRN_DESC_0);
+  @endcode
+ */
+int8_t
+AXI4DMA_configure_ext_chain
+(
+    axi4dma_instance_t* this_dmac,
+    axi4dma_desc_id_t desc_id,
+    axi4dma_ext_chain_t* chain
+);
+
+/*-------------------------------------------------------------------------*//**
+  The AXI4DMA_stream_ring_init() function sets up a ring of num_buf stream
+  buffers of buf_size bytes each, starting at buf_addr, with one stream
+  descriptor per buffer in desc_mem. The descriptor of the first buffer is
+  armed for the TDEST signal tdest_signal_num, so the capture starts with the
+  first stream transaction after this function returns. The stream descriptor
+  completion interrupt must be enabled with AXI4DMA_enable_irq().
+
+  @param ring
+    The ring parameter is a pointer to the axi4dma_stream_ring_t structure to
+    set up.
+
+  @param this_dmac
+    The this_dmac parameter is a pointer to a axi4dma_instance_t structure which
+    holds all data regarding this instance of the CoreAXI4DMAController.
+
+  @param desc_mem
+    The desc_mem parameter points to an array of num_buf stream descriptors in
+    memory which the CoreAXI4DMAController IP can access.
+
+  @param tdest_signal_num
+    The tdest_signal_num parameter is the TDEST of the stream to capture.
+
+  @param config
+    The config parameter is the stream descriptor configuration, see
+    AXI4DMA_configure_stream().
+
+  @param buf_addr
+    The buf_addr parameter is the address of the first buffer. The buffers are
+    contiguous.
+
+  @param buf_size
+    The buf_size parameter is the size of each buffer in bytes.
+
+  @param num_buf
+    The num_buf parameter is the number of buffers, at least two.
+
+   @return
+    This function returns zero value on successful execution. A negative value
+    is returned in case of error.
+ */
+int8_t
+AXI4DMA_stream_ring_init
+(
+    axi4dma_stream_ring_t* ring,
+    axi4dma_instance_t* this_dmac,
+    axi4dma_stream_desc_t* desc_mem,
+    axi4dma_tdest_signal_t tdest_signal_num,
+    uint8_t config,
+    uint32_t buf_addr,
+    uint32_t buf_size,
+    uint32_t num_buf
+);
+
+/*-------------------------------------------------------------------------*//**
+  The AXI4DMA_stream_ring_isr() function is called from the application's
+  CoreAXI4DMAController interrupt handler when AXI4DMA_transfer_status() reports
+  that a stream descriptor has completed. It marks the buffer as filled and
+  re-arms the stream with the next free buffer.
+
+  @param ring
+    The ring parameter is a pointer to a ring set up by
+    AXI4DMA_stream_ring_init().
+
+  @param ext_desc_addr
+    The ext_desc_addr parameter is the descriptor address returned by
+    AXI4DMA_transfer_status().
+
+   @return
+    This function returns zero if the completion was for the descriptor armed
+    by this ring. A negative value is returned otherwise, and the ring is not
+    changed.
+ */
+int8_t
+AXI4DMA_stream_ring_isr
+(
+    axi4dma_stream_ring_t* ring,
+    uint32_t ext_desc_addr
+);
+
+/*-------------------------------------------------------------------------*//**
+  The AXI4DMA_stream_ring_get() function returns the address of the oldest
+  filled buffer which has not been released, or zero if there is none. The
+  buffer stays owned by the application until AXI4DMA_stream_ring_release() is
+  called.
+
+  @param ring
+    The ring parameter is a pointer to a ring set up by
+    AXI4DMA_stream_ring_init().
+
+   @return
+    The address of the buffer, or zero.
+ */
+static inline uint32_t
+AXI4DMA_stream_ring_get
+(
+    axi4dma_stream_ring_t* ring
+)
+{
+    uint32_t buf_addr = 0u;
+
+    if (ring->producer != ring->consumer)
+    {
+        buf_addr = ring->buf_addr +
+                   ((ring->consumer % ring->num_buf) * ring->buf_size);
+    }
+
+    return buf_addr;
+}
+
+/*-------------------------------------------------------------------------*//**
+  The AXI4DMA_stream_ring_release() function gives the buffer returned by
+  AXI4DMA_stream_ring_get() back to the DMA.
+
+  @param ring
+    The ring parameter is a pointer to a ring set up by
+    AXI4DMA_stream_ring_init().
+ */
+static inline void
+AXI4DMA_stream_ring_release
+(
+    axi4dma_stream_ring_t* ring
+)
+{
+    if (ring->producer != ring->consumer)
+    {
+        ring->consumer++;
+    }
+}
+
 /***************************************************************************//**
  * This function starts the DMA transfer. This function does not need to be used
  * with the stream transfers.
@@ -16,6 +16,12 @@
 /* Defining the number of words / bytes to transfer*/
 #define TRANSFER_SIZE_BYTES          (1000000u)
 
+/* Continuous capture: a ring of STREAM_RING_BUFFERS buffers of
+ * STREAM_RING_BUFFER_SIZE_BYTES each, filled STREAM_CAPTURE_BUFFERS times*/
+#define STREAM_RING_BUFFERS            (8u)
+#define STREAM_RING_BUFFER_SIZE_BYTES  (65536u)
+#define STREAM_CAPTURE_BUFFERS         (1024u)
+
 /* Defining memory addresses*/
 #define STREAM_GEN_BASE_ADDRESS      (0x40000F00u)
 #define DMA_CONTROL_BASE_ADDRESS     (0x60010000u)
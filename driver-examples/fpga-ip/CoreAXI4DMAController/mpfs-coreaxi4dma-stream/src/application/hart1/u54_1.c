@@ -26,17 +26,21 @@ transfer_status_t stream_status;
 volatile uint8_t uart_recieve_buffer_length = 0u;
 uint8_t uart_recieve_buffer[UART_RECIEVE_BUFFER_MAX_SIZE] = {0u};
 static volatile dma_error_status_t dma_transfer_error_type = NO_ERROR;
+static axi4dma_stream_ring_t stream_ring;
+static volatile bool stream_capture_running = false;
 
 const uint8_t greeting_message[] = "\r\n\r\n\r\n **** PolarFire SoC CoreAXI4DMAController "
                                    "Stream Example ****\r\n";
 
-const uint8_t selection_message[] = "\r\nPress <SPACE> to perform an AXI4DMA Stream transfer!\r\n";
+const uint8_t selection_message[] = "\r\nPress <SPACE> to perform an AXI4DMA Stream transfer!\r\n"
+                                    "Press <c> to perform a continuous AXI4DMA Stream capture!\r\n";
 
 /* Functions*/
 uint8_t fabric_f2h_2_plic_IRQHandler(void);
 static void configure_board(void);
 static void coreaxidma_stream_transfer(void);
-static bool does_stream_transferred_data_match(uint64_t *);
+static void coreaxidma_stream_capture(void);
+static bool does_stream_transferred_data_match(uint64_t *, uint32_t, uint64_t);
 static void report_transfer_error(void);
 
 void
@@ -77,6 +81,11 @@ u54_1(void)
                     MSS_UART_polled_tx_string(uart1, selection_message);
                     break;
 
+                case 'c':
+                    coreaxidma_stream_capture();
+                    MSS_UART_polled_tx_string(uart1, selection_message);
+                    break;
+
                 default:
                     MSS_UART_polled_tx_string(uart1, "\r\n\r\nInvalid Option Selected!!\r\n");
                     MSS_UART_polled_tx_string(uart1, selection_message);
@@ -134,7 +143,9 @@ coreaxidma_stream_transfer(void)
             MSS_UART_polled_tx_string(uart1, "> Stream transfer complete!\r\n");
 
             /* Verify data written matches expected*/
-            if (true == does_stream_transferred_data_match((uint64_t *)transfer_dest_address))
+            if (true == does_stream_transferred_data_match((uint64_t *)transfer_dest_address,
+                                                       TRANSFER_SIZE_ROUNDED,
+                                                       1u))
             {
                 MSS_UART_polled_tx_string(uart1, "> Data matches!\r\n\r\n");
             }
@@ -153,6 +164,97 @@ coreaxidma_stream_transfer(void)
     }
 }
 
+void
+coreaxidma_stream_capture(void)
+{
+    uint8_t transfer_message[160] = {0};
+    uint32_t buffer_address;
+    uint32_t mismatches = 0u;
+    uint32_t discontinuities = 0u;
+    uint64_t buffer_words = STREAM_PATTERN_COUNT(STREAM_RING_BUFFER_SIZE_BYTES);
+    uint64_t first_value;
+    uint64_t next_value = 1u;
+
+    /* One incrementing pattern for the whole capture, split across the buffers */
+    STREAM_GEN_PATTERN_COUNT_REG = (uint32_t)(buffer_words * STREAM_CAPTURE_BUFFERS);
+
+    AXI4DMA_init(core_axi4_dma_controller, DMA_CONTROL_BASE_ADDRESS);
+    stream_status = STREAM_INCOMPLETE;
+
+    /* One stream descriptor per ring buffer, all armed from the interrupt */
+    AXI4DMA_stream_ring_init(&stream_ring,
+                             core_axi4_dma_controller,
+                             tdest0_stream_descriptor,
+                             TDEST_0,
+                             STREAM_DESCRIPTOR_VALID | STREAM_DEST_DATA_READY | STREAM_DEST_OPERAND,
+                             transfer_dest_address,
+                             ROUND_TO_DATA_WIDTH(STREAM_RING_BUFFER_SIZE_BYTES),
+                             STREAM_RING_BUFFERS);
+
+    AXI4DMA_enable_irq(core_axi4_dma_controller,
+                       IRQ_NUM_0,
+                       AXI4DMA_OP_COMPLETE_INTR_MASK | AXI4DMA_WR_ERR_INTR_MASK |
+                           AXI4DMA_RD_ERR_INTR_MASK | AXI4DMA_INVALID_DESC_INTR_MASK);
+
+    sprintf(transfer_message,
+            "\r\n\r\nCoreAXI4 DMA: Continuous Stream Capture\r\n"
+            "> Capturing %-i buffers of %-i bytes into a ring of %-i\r\n",
+            STREAM_CAPTURE_BUFFERS,
+            STREAM_RING_BUFFER_SIZE_BYTES,
+            STREAM_RING_BUFFERS);
+    MSS_UART_polled_tx_string(uart1, transfer_message);
+
+    stream_capture_running = true;
+    STREAM_GEN_START_REG = START_STREAM_GEN;
+
+    /* Consume buffers as they are filled. Packets the ring had no room for
+     * are counted as overruns by the driver. */
+    while (((stream_ring.consumer + stream_ring.overruns) < STREAM_CAPTURE_BUFFERS) &&
+           (TRANSFER_ERROR != stream_status))
+    {
+        buffer_address = AXI4DMA_stream_ring_get(&stream_ring);
+        if (0u != buffer_address)
+        {
+            /* Each buffer carries on from the last one. Buffers lost to
+             * overruns leave a gap of a whole number of buffers. */
+            first_value = *(uint64_t *)(uintptr_t)buffer_address;
+            if ((first_value < next_value) ||
+                (0u != ((first_value - next_value) % buffer_words)))
+            {
+                discontinuities++;
+            }
+
+            if (false == does_stream_transferred_data_match((uint64_t *)(uintptr_t)buffer_address,
+                                                            stream_ring.buf_size,
+                                                            first_value))
+            {
+                mismatches++;
+            }
+            next_value = first_value + buffer_words;
+            AXI4DMA_stream_ring_release(&stream_ring);
+        }
+    }
+
+    stream_capture_running = false;
+    STREAM_GEN_START_REG = STOP_STREAM_GEN;
+
+    if (TRANSFER_ERROR == stream_status)
+    {
+        report_transfer_error();
+    }
+    else
+    {
+        sprintf(transfer_message,
+                "> Capture complete: %-i buffers processed, %-i overruns, %-i mismatches, "
+                "%-i discontinuities\r\n\r\n",
+                stream_ring.consumer,
+                stream_ring.overruns,
+                mismatches,
+                discontinuities);
+        MSS_UART_polled_tx_string(uart1, transfer_message);
+    }
+}
+
 uint8_t
 PLIC_f2m_2_IRQHandler(void)
 {
@@ -175,7 +277,19 @@ PLIC_f2m_2_IRQHandler(void)
             switch (descriptor)
             {
                 case STREAM_DESC_33:
-                    stream_status = STREAM_TRANSFER_COMPLETE;
+                    if (true == stream_capture_running)
+                    {
+                        /* Re-arm the ring, the generator keeps streaming */
+                        if (0 != AXI4DMA_stream_ring_isr(&stream_ring, external_descriptor_address))
+                        {
+                            stream_status = TRANSFER_ERROR;
+                            dma_transfer_error_type = UNKNOWN_DESCRIPTOR_TRANSFER_COMPLETE;
+                        }
+                    }
+                    else
+                    {
+                        stream_status = STREAM_TRANSFER_COMPLETE;
+                    }
                     break;
 
                 case INTRN_DESC_0:
@@ -281,22 +395,22 @@ configure_board(void)
 }
 
 bool
-does_stream_transferred_data_match(uint64_t *dest_address)
+does_stream_transferred_data_match(uint64_t *dest_address, uint32_t size, uint64_t first)
 {
     uint64_t expected;
     uint64_t *dst;
 
-    for (expected = 0; expected < (TRANSFER_SIZE_ROUNDED / sizeof(uint64_t)); expected++)
+    for (expected = 0; expected < (size / sizeof(uint64_t)); expected++)
     {
         dst = (dest_address + expected);
-        if ((expected + 1u) != *dst)
+        if ((expected + first) != *dst)
         {
 #ifdef DEBUG_DMA
             uint8_t debug_message[100] = {0};
             sprintf(debug_message,
                     "\r\nError at address: 0x%-9x!\tExpected: %-5iRead: %-5i",
                     (dest_address + expected),
-                    (expected + 1u),
+                    (expected + first),
                     *(dest_address + expected));
 
             MSS_UART_polled_tx_string(uart1, debug_message);
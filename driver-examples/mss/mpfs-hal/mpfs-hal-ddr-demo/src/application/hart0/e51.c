@@ -38,6 +38,7 @@ DDR test options:\r\n\
 b  Display MSS PLL registers\r\n\
 c  Read full range hart 0\r\n\
 d  Read full range hart 1\r\n\
+e  Parallel PDMA memory test, all U54s\r\n\
 \r\n\
 Bootloader options:\r\n\
 6  Load image to DDR using YMODEM\r\n\
@@ -60,6 +61,7 @@ DDR test options:\r\n\
 4  Display clock values\r\n\
 5  Not used\r\n\
 b  Display MSS PLL registers\r\n\
+e  Parallel PDMA memory test, all U54s\r\n\
 \r\n\
 Bootloader options:\r\n\
 6  Load image to DDR using YMODEM\r\n\
@@ -392,6 +394,14 @@ void e51(void)
                     MSS_UART_polled_tx_string(g_uart,
                         (const uint8_t*)"Finished\r\n");
                     break;
+                case 'e':
+                    /*
+                     * U54-1 runs the test with the help of the other U54s and
+                     * displays the result. X aborts the test.
+                     */
+                    ddr_test = 4U;
+                    raise_soft_interrupt(1u);
+                    break;
                 case 'x':
                 	ddr_test = 2U;
                     break;
@@ -31,6 +31,16 @@ volatile uint32_t count_sw_ints_h1 = 0U;
 #define MAX_OFFSET          16U
 #define START_OFFSET        12U
 
+/* U54_2 to U54_4 help U54_1 with the parallel memory test */
+#define MEMTEST_HELPERS     ((1U << 2U) | (1U << 3U) | (1U << 4U))
+
+/* The parallel memory test starts on this boundary above a program in DDR */
+#define MEMTEST_IMAGE_ALIGN 0x100000U
+
+static DDR_MEMTEST_RESULT memtest_result;
+
+static void run_ddr_memtest(void);
+
 /* Main function for the HART1(U54_1 processor).
  * Application code running on HART1 is placed here
  *
@@ -113,10 +123,83 @@ void u54_1(void)
             ddr_read_full_range ();
             ddr_test = 0U;
         }
+        if(ddr_test == 4U)
+        {
+            run_ddr_memtest();
+            ddr_test = 0U;
+        }
     }
     /* never return */
 }
 
+/**
+ * Runs the parallel memory test over the DDR range on U54_1 to U54_4, each
+ * using its own PDMA channel, and prints the rate and the first errors. When
+ * this program is linked to DDR, the memory up to the end of its image, heap
+ * and stacks is left out of the test.
+ */
+static void run_ddr_memtest(void)
+{
+    DDR_MEMTEST_PARAMS params;
+    uint64_t mem_size = LIBERO_SETTING_CFG_AXI_END_ADDRESS_AXI2_1 +\
+            (LIBERO_SETTING_CFG_AXI_END_ADDRESS_AXI2_0 + 1U);
+    uint64_t image_end = (uint64_t)&__app_hart_common_end;
+    uint64_t skip = 0U;
+    uint64_t ms;
+    uint64_t mb_per_s;
+    uint32_t error_index;
+
+    /* The cached 32-bit DDR region starts at the base of DDR */
+    if ((image_end > BASE_ADDRESS_CACHED_32_DDR) &&\
+        (image_end <= BASE_ADDRESS_NON_CACHED_32_DDR))
+    {
+        skip = (image_end - BASE_ADDRESS_CACHED_32_DDR +\
+                MEMTEST_IMAGE_ALIGN - 1U) & ~((uint64_t)MEMTEST_IMAGE_ALIGN - 1U);
+    }
+
+    params.base = BASE_ADDRESS_NON_CACHED_64_DDR + skip;
+    params.size = mem_size - skip;
+    params.seed = readmcycle();
+    params.pattern_mask = DDR_MEMTEST_ALL_PATTERNS;
+    params.hart_mask = MEMTEST_HELPERS;
+
+    sprintf(info_string, "Parallel memory test from 0x%010llx, "
+            "press x to abort\r\n", (unsigned long long)params.base);
+    MSS_UART_polled_tx(g_uart, (const uint8_t*)info_string,\
+            (uint32_t)strlen(info_string));
+
+    setup_ddr_segments(DEFAULT_SEG_SETUP);
+    (void)ddr_memtest_run(&params, &memtest_result);
+    setup_ddr_segments(LIBERO_SEG_SETUP);
+
+    ms = memtest_result.cycles / (LIBERO_SETTING_MSS_COREPLEX_CPU_CLK / 1000U);
+    mb_per_s = (ms != 0U) ? ((memtest_result.bytes / ms) / 1000U) : 0U;
+
+    sprintf(info_string, "harts 0x%x, %llu MB tested in %llu ms, "
+            "%llu.%03llu GB/s, %u errors%s\r\n",
+            memtest_result.hart_mask,
+            (unsigned long long)(memtest_result.bytes / (1024U * 1024U)),
+            (unsigned long long)ms,
+            (unsigned long long)(mb_per_s / 1000U),
+            (unsigned long long)(mb_per_s % 1000U),
+            memtest_result.errors,
+            (memtest_result.aborted != 0U) ? ", aborted" : "");
+    MSS_UART_polled_tx(g_uart, (const uint8_t*)info_string,\
+            (uint32_t)strlen(info_string));
+
+    for (error_index = 0U; (error_index < memtest_result.errors) &&\
+            (error_index < DDR_MEMTEST_MAX_ERRORS); error_index++)
+    {
+        sprintf(info_string, "  address 0x%010llx expected 0x%016llx "
+                "found 0x%016llx\r\n",
+                (unsigned long long)memtest_result.error[error_index].address,
+                (unsigned long long)memtest_result.error[error_index].expected,
+                (unsigned long long)memtest_result.error[error_index].found);
+        MSS_UART_polled_tx(g_uart, (const uint8_t*)info_string,\
+                (uint32_t)strlen(info_string));
+    }
+}
+
 /* HART1 Software interrupt handler */
 void Software_h1_IRQHandler(void)
 {
@@ -55,6 +55,7 @@ void u54_2(void)
         {
             jump_to_application(hls, M_MODE, (uint64_t)0x80000000);
         }
+        ddr_memtest_service();
     }
     /* never return */
 }
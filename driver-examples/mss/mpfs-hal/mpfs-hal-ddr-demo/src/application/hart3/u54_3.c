@@ -54,6 +54,7 @@ void u54_3(void)
         {
             jump_to_application(hls, M_MODE, (uint64_t)0x80000000);
         }
+        ddr_memtest_service();
     }
     /* never return */
 }
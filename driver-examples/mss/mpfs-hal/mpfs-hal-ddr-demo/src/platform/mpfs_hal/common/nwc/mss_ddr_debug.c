@@ -1034,3 +1034,414 @@ uint32_t test_ddr(uint32_t no_of_iterations, volatile PATTERN_TEST_PARAMS *patte
     }
     return error;
 }
+
+/*******************************************************************************
+ * Parallel memory test
+ */
+#define MEMTEST_HARTS               4U
+#define MEMTEST_WORDS_PER_BLOCK     (DDR_MEMTEST_BLOCK_SIZE / sizeof(uint64_t))
+#define MEMTEST_TEST_PATTERN_WORDS  (sizeof(ddr_test_pattern) / sizeof(uint32_t))
+
+/* Shared by the hart running the test and the harts helping it */
+typedef struct MEMTEST_STATE_
+{
+    DDR_MEMTEST_PARAMS params;
+    DDR_MEMTEST_RESULT *result;
+    uint64_t blocks;                /* blocks in the test range */
+    volatile uint32_t session;      /* incremented as each test starts */
+    volatile uint32_t running;      /* set while a test runs */
+    volatile uint32_t joined;       /* harts which answered, bit per hart */
+    volatile uint32_t members;      /* harts taking part, set once joined */
+    volatile uint32_t pass;         /* incremented as each pass starts */
+    volatile uint32_t pattern;      /* pattern of the current pass */
+    volatile uint32_t verify;       /* 0 write pass, 1 read back pass */
+    volatile uint32_t done;         /* helpers finished with the current pass */
+    volatile uint32_t aborted;
+    volatile uint64_t next_block;   /* next block to hand out */
+    volatile uint64_t verified;     /* blocks read back, all passes */
+} MEMTEST_STATE;
+
+static MEMTEST_STATE g_memtest;
+
+/* Two DMA staging buffers and one expected data buffer per U54 */
+static uint64_t g_memtest_buffer[MEMTEST_HARTS][3U][MEMTEST_WORDS_PER_BLOCK]\
+                                                __attribute__((aligned(64)));
+
+/**
+ * splitmix64 finaliser, so any word of the random pattern can be regenerated
+ * from its index by whichever hart reads it back.
+ */
+static uint64_t memtest_random(uint64_t index)
+{
+    uint64_t x = index + g_memtest.params.seed;
+
+    x = (x ^ (x >> 30U)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27U)) * 0x94D049BB133111EBULL;
+    return (x ^ (x >> 31U));
+}
+
+/**
+ * Generates one block of a pattern. Each word is a function of its index in
+ * the test range so that any block can be generated on its own. The patterns
+ * are those of ddr_write(), except PATTERN_RANDOM which hashes the index in
+ * place of calling rand().
+ * @param buffer block buffer
+ * @param first_word index of the first word of the block
+ * @param pattern PATTERN_xxx or DDR_MEMTEST_TEST_PATTERN
+ */
+static void memtest_fill(uint64_t *buffer, uint64_t first_word, uint32_t pattern)
+{
+    const uint32_t *test_pattern = ddr_test_pattern;
+    uint64_t word = first_word;
+    uint32_t i;
+    uint32_t j;
+
+    switch (pattern)
+    {
+        case PATTERN_INCREMENTAL:
+            for (i = 0U; i < MEMTEST_WORDS_PER_BLOCK; i++)
+            {
+                buffer[i] = word + i;
+            }
+            break;
+        case PATTERN_WALKING_ONE:
+            for (i = 0U; i < MEMTEST_WORDS_PER_BLOCK; i++)
+            {
+                buffer[i] = 0x01ULL << ((word + i) & 31U);
+            }
+            break;
+        case PATTERN_WALKING_ZERO:
+            for (i = 0U; i < MEMTEST_WORDS_PER_BLOCK; i++)
+            {
+                buffer[i] = ~(0x01ULL << ((word + i) & 31U));
+            }
+            break;
+        case PATTERN_RANDOM:
+            for (i = 0U; i < MEMTEST_WORDS_PER_BLOCK; i++)
+            {
+                buffer[i] = memtest_random(word + i);
+            }
+            break;
+        case PATTERN_0xCCCCCCCC:
+            for (i = 0U; i < MEMTEST_WORDS_PER_BLOCK; i++)
+            {
+                buffer[i] = 0xCCCCCCCCCCCCCCCCULL;
+            }
+            break;
+        case PATTERN_0x55555555:
+            for (i = 0U; i < MEMTEST_WORDS_PER_BLOCK; i++)
+            {
+                buffer[i] = 0x5555555555555555ULL;
+            }
+            break;
+        case DDR_MEMTEST_TEST_PATTERN:
+            /* two pattern words per DDR word, the pattern length is even */
+            j = (uint32_t)((word * 2U) % MEMTEST_TEST_PATTERN_WORDS);
+            for (i = 0U; i < MEMTEST_WORDS_PER_BLOCK; i++)
+            {
+                buffer[i] = ((uint64_t)test_pattern[j + 1U] << 32U) |\
+                        test_pattern[j];
+                j += 2U;
+                if (j >= MEMTEST_TEST_PATTERN_WORDS)
+                {
+                    j = 0U;
+                }
+            }
+            break;
+        case PATTERN_ZEROS:
+        default:
+            for (i = 0U; i < MEMTEST_WORDS_PER_BLOCK; i++)
+            {
+                buffer[i] = 0U;
+            }
+            break;
+    }
+}
+
+/**
+ * Compares a block read back with the expected data and records the errors.
+ * @param found block read back
+ * @param expected block as written
+ * @param block block number
+ */
+static void memtest_check(const uint64_t *found, const uint64_t *expected,\
+                                                                uint64_t block)
+{
+    DDR_MEMTEST_RESULT *result = g_memtest.result;
+    uint32_t error_index;
+    uint32_t i;
+
+    if (memcmp(found, expected, DDR_MEMTEST_BLOCK_SIZE) == 0)
+    {
+        return;
+    }
+
+    for (i = 0U; i < MEMTEST_WORDS_PER_BLOCK; i++)
+    {
+        if (found[i] != expected[i])
+        {
+            error_index = __sync_fetch_and_add(&result->errors, 1U);
+            if (error_index < DDR_MEMTEST_MAX_ERRORS)
+            {
+                result->error[error_index].address = g_memtest.params.base +\
+                        (block * DDR_MEMTEST_BLOCK_SIZE) +\
+                        (i * sizeof(uint64_t));
+                result->error[error_index].expected = expected[i];
+                result->error[error_index].found = found[i];
+            }
+        }
+    }
+}
+
+/**
+ * Hands out the next block of the current pass
+ * @return block number, or the number of blocks when the pass is complete
+ */
+static uint64_t memtest_next_block(void)
+{
+    uint64_t block;
+
+    if (ddr_test == 2U)
+    {
+        g_memtest.aborted = 1U;
+    }
+    if (g_memtest.aborted != 0U)
+    {
+        return (g_memtest.blocks);
+    }
+
+    block = __sync_fetch_and_add(&g_memtest.next_block, 1U);
+    if (block > g_memtest.blocks)
+    {
+        block = g_memtest.blocks;
+    }
+    return (block);
+}
+
+/**
+ * Runs the calling hart's share of the current pass. The CPU generates the
+ * next block while the hart's PDMA channel moves the previous one.
+ * @param hart_id calling hart, 1 to 4
+ */
+static void memtest_pass(uint32_t hart_id)
+{
+    uint64_t (*buffer)[MEMTEST_WORDS_PER_BLOCK] =\
+                                                g_memtest_buffer[hart_id - 1U];
+    uint64_t *expected = buffer[2U];
+    uint64_t channel = PDMA_CHANNEL0_BASE_ADDRESS +\
+                                        (0x1000ULL * (uint64_t)(hart_id - 1U));
+    uint32_t pattern = g_memtest.pattern;
+    uint64_t verified = 0U;
+    uint32_t slot = 0U;
+    uint32_t in_flight = 0U;
+    uint64_t block = 0U;
+    uint64_t next;
+
+    if (g_memtest.verify == 0U)
+    {
+        while ((next = memtest_next_block()) < g_memtest.blocks)
+        {
+            /* the buffer was last read by the transfer before the previous */
+            memtest_fill(buffer[slot], next * MEMTEST_WORDS_PER_BLOCK, pattern);
+            if (in_flight != 0U)
+            {
+                pdma_transfer_complete(channel);
+            }
+            mb();
+            pdma_transfer(g_memtest.params.base +\
+                    (next * DDR_MEMTEST_BLOCK_SIZE), (uint64_t)buffer[slot],\
+                    DDR_MEMTEST_BLOCK_SIZE, channel);
+            in_flight = 1U;
+            slot ^= 1U;
+        }
+        if (in_flight != 0U)
+        {
+            pdma_transfer_complete(channel);
+        }
+        return;
+    }
+
+    do
+    {
+        next = memtest_next_block();
+        if (in_flight != 0U)
+        {
+            pdma_transfer_complete(channel);
+            mb();
+        }
+        if (next < g_memtest.blocks)
+        {
+            pdma_transfer((uint64_t)buffer[slot], g_memtest.params.base +\
+                    (next * DDR_MEMTEST_BLOCK_SIZE), DDR_MEMTEST_BLOCK_SIZE,\
+                    channel);
+        }
+        if (in_flight != 0U)
+        {
+            memtest_fill(expected, block * MEMTEST_WORDS_PER_BLOCK, pattern);
+            memtest_check(buffer[slot ^ 1U], expected, block);
+            verified++;
+        }
+        in_flight = (next < g_memtest.blocks) ? 1U : 0U;
+        block = next;
+        slot ^= 1U;
+    } while (in_flight != 0U);
+
+    __sync_fetch_and_add(&g_memtest.verified, verified);
+}
+
+/**
+ * Runs a pass on the calling hart and waits for the helpers to finish theirs
+ * @param pattern PATTERN_xxx or DDR_MEMTEST_TEST_PATTERN
+ * @param verify 0 to write the pattern, 1 to read it back
+ * @param hart_id calling hart
+ * @param helpers number of helpers taking part
+ */
+static void memtest_run_pass(uint32_t pattern, uint32_t verify,\
+                                            uint32_t hart_id, uint32_t helpers)
+{
+    g_memtest.pattern = pattern;
+    g_memtest.verify = verify;
+    g_memtest.next_block = 0U;
+    g_memtest.done = 0U;
+    mb();
+    g_memtest.pass++;
+
+    memtest_pass(hart_id);
+
+    while (g_memtest.done != helpers)
+    {
+        ;
+    }
+    mb();
+}
+
+/**
+ * Writes and reads back each selected pattern over the test range, shared
+ * between the calling hart and the helpers which answer.
+ * @param params test range, patterns and helpers
+ * @param result test result
+ * @return number of errors
+ */
+uint32_t ddr_memtest_run(const DDR_MEMTEST_PARAMS *params,\
+                                                    DDR_MEMTEST_RESULT *result)
+{
+    uint32_t hart_id = (uint32_t)read_csr(mhartid);
+    uint32_t helper_mask = params->hart_mask & 0x1EU & ~(0x01U << hart_id);
+    uint32_t helpers = 0U;
+    uint32_t helper;
+    uint32_t poll;
+    uint32_t pattern_shift;
+    uint32_t pattern;
+    uint64_t start_mcycle;
+
+    memset(result, 0, sizeof(DDR_MEMTEST_RESULT));
+
+    g_memtest.params = *params;
+    g_memtest.result = result;
+    g_memtest.blocks = params->size / DDR_MEMTEST_BLOCK_SIZE;
+    g_memtest.joined = 0U;
+    g_memtest.members = 0U;
+    g_memtest.pass = 0U;
+    g_memtest.aborted = 0U;
+    g_memtest.verified = 0U;
+    g_memtest.session++;
+    mb();
+    g_memtest.running = 1U;
+
+    for (helper = 1U; helper <= MEMTEST_HARTS; helper++)
+    {
+        if ((helper_mask & (0x01U << helper)) != 0U)
+        {
+            raise_soft_interrupt(helper);
+        }
+    }
+
+    for (poll = 0U; poll < DDR_MEMTEST_JOIN_POLLS; poll++)
+    {
+        if ((g_memtest.joined & helper_mask) == helper_mask)
+        {
+            break;
+        }
+    }
+
+    /* harts which answer after this are turned away */
+    g_memtest.members = (g_memtest.joined & helper_mask) | (0x01U << hart_id);
+    mb();
+    for (helper = 1U; helper <= MEMTEST_HARTS; helper++)
+    {
+        if ((g_memtest.members & helper_mask & (0x01U << helper)) != 0U)
+        {
+            helpers++;
+        }
+    }
+
+    start_mcycle = readmcycle();
+
+    for (pattern_shift = 0U; pattern_shift <= MAX_NO_PATTERNS; pattern_shift++)
+    {
+        pattern = 0x01U << pattern_shift;
+        if ((params->pattern_mask & pattern) == 0U)
+        {
+            continue;
+        }
+        memtest_run_pass(pattern, 0U, hart_id, helpers);
+        memtest_run_pass(pattern, 1U, hart_id, helpers);
+        if (g_memtest.aborted != 0U)
+        {
+            break;
+        }
+    }
+
+    result->cycles = readmcycle() - start_mcycle;
+
+    g_memtest.running = 0U;
+    mb();
+
+    result->bytes = g_memtest.verified * DDR_MEMTEST_BLOCK_SIZE;
+    result->hart_mask = g_memtest.members;
+    result->aborted = g_memtest.aborted;
+
+    return (result->errors);
+}
+
+/**
+ * Takes part in a test started on another hart, if asked to
+ */
+void ddr_memtest_service(void)
+{
+    uint32_t hart_id = (uint32_t)read_csr(mhartid);
+    uint32_t hart_bit = 0x01U << hart_id;
+    uint32_t session;
+    uint32_t pass = 0U;
+
+    if ((g_memtest.running == 0U) ||\
+        ((g_memtest.params.hart_mask & hart_bit) == 0U) ||\
+        ((g_memtest.joined & hart_bit) != 0U))
+    {
+        return;
+    }
+
+    session = g_memtest.session;
+    (void)__sync_fetch_and_or(&g_memtest.joined, hart_bit);
+
+    while (g_memtest.members == 0U)
+    {
+        ;
+    }
+    mb();
+    if ((g_memtest.members & hart_bit) == 0U)
+    {
+        return;
+    }
+
+    while ((g_memtest.running != 0U) && (g_memtest.session == session))
+    {
+        if (g_memtest.pass != pass)
+        {
+            mb();
+            pass = g_memtest.pass;
+            memtest_pass(hart_id);
+            (void)__sync_fetch_and_add(&g_memtest.done, 1U);
+        }
+    }
+}
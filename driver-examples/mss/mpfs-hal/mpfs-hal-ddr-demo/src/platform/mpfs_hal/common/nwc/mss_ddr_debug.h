@@ -261,6 +261,100 @@ execute_ddr_pattern
 uint64_t start_addr
 );
 
+/*
+ * Parallel memory test. The test range is split into blocks which are handed
+ * out to the harts taking part. Each hart generates the pattern on the CPU and
+ * moves the blocks to and from DDR with its own PDMA channel, so the DDR is
+ * kept busy by up to four channels at once.
+ */
+#ifndef DDR_MEMTEST_BLOCK_SIZE
+#define DDR_MEMTEST_BLOCK_SIZE      0x1000U
+#endif
+
+#ifndef DDR_MEMTEST_MAX_ERRORS
+#define DDR_MEMTEST_MAX_ERRORS      16U
+#endif
+
+/* Polls of the harts asked to help before the test starts without them */
+#ifndef DDR_MEMTEST_JOIN_POLLS
+#define DDR_MEMTEST_JOIN_POLLS      1000000U
+#endif
+
+/* ddr_test_pattern[] from mss_ddr_test_pattern.c, repeated over the range */
+#define DDR_MEMTEST_TEST_PATTERN    (0x01U << MAX_NO_PATTERNS)
+#define DDR_MEMTEST_ALL_PATTERNS    ((DDR_MEMTEST_TEST_PATTERN << 1U) - 1U)
+
+typedef struct DDR_MEMTEST_PARAMS_
+{
+    uint64_t base;          /* first address, DDR_MEMTEST_BLOCK_SIZE aligned */
+    uint64_t size;          /* bytes, rounded down to DDR_MEMTEST_BLOCK_SIZE */
+    uint64_t seed;          /* seed of PATTERN_RANDOM */
+    uint32_t pattern_mask;  /* PATTERN_xxx and DDR_MEMTEST_TEST_PATTERN bits */
+    uint32_t hart_mask;     /* bit n set for U54_n to help the calling hart */
+} DDR_MEMTEST_PARAMS;
+
+typedef struct DDR_MEMTEST_ERROR_
+{
+    uint64_t address;
+    uint64_t expected;
+    uint64_t found;
+} DDR_MEMTEST_ERROR;
+
+typedef struct DDR_MEMTEST_RESULT_
+{
+    uint64_t bytes;         /* bytes written and read back, all patterns */
+    uint64_t cycles;        /* clock cycles of the calling hart */
+    uint32_t hart_mask;     /* harts which took part */
+    uint32_t errors;        /* words which did not read back as written */
+    uint32_t aborted;       /* set if ddr_test was set to 2 during the test */
+    DDR_MEMTEST_ERROR error[DDR_MEMTEST_MAX_ERRORS]; /* first errors found */
+} DDR_MEMTEST_RESULT;
+
+/***************************************************************************//**
+  The ddr_memtest_run() function writes each selected pattern to the test range
+  and reads it back, sharing the work with the harts in hart_mask. Each hart
+  uses PDMA channel (hart id - 1), so only U54s may take part. Harts asked to
+  help are woken with a software interrupt and must call ddr_memtest_service()
+  from their idle loop. A hart which does not respond within
+  DDR_MEMTEST_JOIN_POLLS is left out.
+
+  @return
+    This function returns the number of errors found.
+
+  Example:
+  @code
+
+    params.base = BASE_ADDRESS_NON_CACHED_64_DDR;
+    params.size = 0x40000000U;
+    params.seed = 1U;
+    params.pattern_mask = DDR_MEMTEST_ALL_PATTERNS;
+    params.hart_mask = (1U << 2U) | (1U << 3U) | (1U << 4U);
+
+    if (ddr_memtest_run(&params, &result) != 0U)
+    {
+        .. print result.error[]
+    }
+
+  @endcode
+ */
+uint32_t
+ddr_memtest_run
+(
+const DDR_MEMTEST_PARAMS *params,
+DDR_MEMTEST_RESULT *result
+);
+
+/***************************************************************************//**
+  The ddr_memtest_service() function lets the calling hart help with a test
+  started by ddr_memtest_run() on another hart. It returns straight away if no
+  test needs the hart, otherwise when the test ends.
+ */
+void
+ddr_memtest_service
+(
+void
+);
+
 #ifdef __cplusplus
 }
 #endif
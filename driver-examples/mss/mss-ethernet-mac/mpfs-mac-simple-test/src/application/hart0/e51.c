@@ -609,8 +609,10 @@ mac_rx_callback(
                 if (MSS_MAC_SUCCESS != tx_status)
                 {
                     g_tx_retry++;
-                    if (((mss_mac_instance_t *)this_mac)->mac_base->INT_STATUS &
-                        GEM_TRANSMIT_COMPLETE)
+                    /* Not safe to force the release once the ring is streaming */
+                    if ((0U == ((mss_mac_instance_t *)this_mac)->queue[0].tx_ring_mode) &&
+                        (((mss_mac_instance_t *)this_mac)->mac_base->INT_STATUS &
+                         GEM_TRANSMIT_COMPLETE))
                     {
 #if 0 /* This is doing it by the book... */
                     if(0 != ((mss_mac_instance_t *)this_mac)->tx_complete_handler)
@@ -655,8 +657,7 @@ low_level_init(void)
     uint32_t count;
 
 #if defined(MSS_MAC_USE_DDR)
-    g_mac_rx_buffer = g_mss_mac_ddr_ptr;
-    g_mss_mac_ddr_ptr += MSS_MAC_RX_RING_SIZE * MSS_MAC_MAX_RX_BUF_SIZE;
+    g_mac_rx_buffer = MSS_MAC_alloc_dma_mem(MSS_MAC_RX_RING_SIZE * MSS_MAC_MAX_RX_BUF_SIZE);
 #endif
     /*-------------------------- Initialize the MAC --------------------------*/
     /*
@@ -3905,7 +3906,10 @@ mac_task(void *pvParameters)
 
                 tx_loc = (uint8_t *)0x08000000UL;
                 /* Forced recovery from missed tx int for testing purposes */
-                g_test_mac->queue[0].nb_available_tx_desc = (uint32_t)MSS_MAC_TX_RING_SIZE;
+                if (0U == g_test_mac->queue[0].tx_ring_mode)
+                {
+                    g_test_mac->queue[0].nb_available_tx_desc = (uint32_t)MSS_MAC_TX_RING_SIZE;
+                }
                 if (rx_buff[0] == 'w')
                 {
                     PRINT_STRING("Memory packet dump start - bad len\n\r");
@@ -4017,27 +4021,25 @@ mac_task(void *pvParameters)
             }
             else if ((rx_buff[0] == 'Y') || (rx_buff[0] == 'y'))
             {
-                int32_t tx_status;
-                uint8_t temp_pkt[1518];
+                /*
+                 * Two packet buffers are used alternately, each for a batch of
+                 * MSS_MAC_TX_RING_SIZE - 1 packets. As no more than that many
+                 * packets can be in flight, by the time one batch has been
+                 * queued the GEM has finished with the other buffer and we can
+                 * load it with the next packet while the ring keeps running.
+                 */
+                static uint8_t tx_pkts[2][1518];
+                static mss_mac_tx_pkt_info_t packet_array[MSS_MAC_TX_RING_SIZE - 1];
+                uint32_t sel = 0;
+                uint32_t sent;
                 int loops = 0;
-                int count;
                 int inner = 0;
-                int inner2 = 0;
-                volatile uint32_t dummy;
                 uint64_t start_time = g_tick_counter;
                 uint32_t packet_size;
                 uint64_t timeout_value = 600000;
-
-#if defined(MSS_MAC_SPEED_TEST)
-                static mss_mac_tx_desc_t tx_desc_tab[MSS_MAC_TX_RING_SIZE];
-#else
-                static mss_mac_tx_pkt_info_t packet_array[MSS_MAC_TX_RING_SIZE];
-#endif
                 int inner_count;
 
                 tx_loc = (uint8_t *)0x08000000UL;
-                /* Forced recovery from missed tx int for testing purposes */
-                g_test_mac->queue[0].nb_available_tx_desc = (uint32_t)MSS_MAC_TX_RING_SIZE;
                 {
                     if (rx_buff[0] == 'Y')
                     {
@@ -4063,35 +4065,13 @@ mac_task(void *pvParameters)
                     }
                 }
 
-                /* Do this once... */
                 for (inner_count = 0; inner_count != (MSS_MAC_TX_RING_SIZE - 1); inner_count++)
                 {
-#if defined(MSS_MAC_SPEED_TEST)
-                    tx_desc_tab[inner_count].addr_low = (uint32_t)((uint64_t)temp_pkt);
-
-                    /* Mark as last buffer for frame */
-                    tx_desc_tab[inner_count].status =
-                        (packet_size & GEM_TX_DMA_BUFF_LEN) | GEM_TX_DMA_LAST;
-#if defined(MSS_MAC_64_BIT_ADDRESS_MODE)
-                    tx_desc_tab[inner_count].addr_high = (uint32_t)((uint64_t)temp_pkt >> 32);
-                    tx_desc_tab[inner_count].unused = 0U;
-#endif
-                    tx_desc_tab[inner_count + 1].status |= GEM_TX_DMA_WRAP | GEM_TX_DMA_USED;
-#else
-                    packet_array[inner_count].tx_buffer = temp_pkt;
                     packet_array[inner_count].length = packet_size | g_crc;
                     packet_array[inner_count].queue_no = 0;
                     packet_array[inner_count].p_user_data = (void *)0;
-
-#endif
                 }
 
-#if !defined(MSS_MAC_SPEED_TEST)
-                packet_array[inner_count].tx_buffer = (void *)0;
-                packet_array[inner_count].length = 0;
-                packet_array[inner_count].queue_no = 0;
-                packet_array[inner_count].p_user_data = (void *)0;
-#endif
                 do
                 {
                     if (tx_loc > (uint8_t *)(0x081E0000UL - 60UL))
@@ -4107,38 +4087,25 @@ mac_task(void *pvParameters)
                             tx_loc = (uint8_t *)0x08000000UL;
                         }
                     }
-                    while (0 != (g_test_mac->mac_base->TRANSMIT_STATUS & GEM_TRANSMIT_GO))
-                    {
-                        dummy++; /* Empty loop will cause debug issues... */
-                    }
 
-                    memcpy(temp_pkt, tx_loc, packet_size);
-                    temp_pkt[12] = 0x08; /* Kill any length errors */
-                    temp_pkt[13] = 0x06;
+                    memcpy(tx_pkts[sel], tx_loc, packet_size);
+                    tx_pkts[sel][12] = 0x08; /* Kill any length errors */
+                    tx_pkts[sel][13] = 0x06;
 
-                    inner2 = 0;
-                    do
+                    for (inner_count = 0; inner_count != (MSS_MAC_TX_RING_SIZE - 1); inner_count++)
                     {
-#if defined(MSS_MAC_SPEED_TEST)
-                        tx_status = MSS_MAC_send_pkts_fast(g_test_mac,
-                                                           tx_desc_tab,
-                                                           (packet_size & 0xFFFF) *
-                                                               (MSS_MAC_TX_RING_SIZE - 1));
-#else
-                        tx_status = MSS_MAC_send_pkts(g_test_mac, 1, packet_array);
-#endif
-
-                        inner2++;
-                        if (inner2 > 2000) /* Force exit if excessive waiting */
-                        {
-                            tx_status = 2;
-                        }
-                    } while (tx_status == 0);
+                        packet_array[inner_count].tx_buffer = tx_pkts[sel];
+                    }
 
-                    if (tx_status != 1)
+                    /* Keep the ring topped up until the whole batch is queued */
+                    sent = 0;
+                    while ((sent != (MSS_MAC_TX_RING_SIZE - 1)) &&
+                           ((g_tick_counter - start_time) <= timeout_value))
                     {
-                        PRINT_STRING("Persistent transmission error - exiting test\n\r");
-                        break;
+                        sent += MSS_MAC_send_pkts_stream(g_test_mac,
+                                                         0,
+                                                         &packet_array[sent],
+                                                         (MSS_MAC_TX_RING_SIZE - 1) - sent);
                     }
 
                     if ((g_tick_counter - start_time) > timeout_value)
@@ -4147,6 +4114,7 @@ mac_task(void *pvParameters)
                         break;
                     }
 
+                    sel ^= 1;
                     tx_loc += 16;
                     loops++;
 
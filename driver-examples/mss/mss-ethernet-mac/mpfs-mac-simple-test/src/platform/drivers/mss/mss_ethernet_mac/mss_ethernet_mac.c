@@ -69,6 +69,8 @@ extern IOSCB_IO_CALIB_STRUCT *IOSCB_IO_CALIB_DDR;
 
 #define INVALID_INDEX                  (0xFFFFFFFFU)
 
+#define MAC_PLIC_HART_COUNT            (5U) /* E51 and 4 x U54 */
+
 #define PHY_ADDRESS_MIN                (0U)
 #define PHY_ADDRESS_MAX                (31U)
 
@@ -84,6 +86,12 @@ extern IOSCB_IO_CALIB_STRUCT *IOSCB_IO_CALIB_DDR;
 #if defined(TARGET_ALOE)
 #define MSS_MAC0_BASE (0x10090000U);
 #elif defined(TARGET_G5_SOC)
+/*
+ * The register block addresses can be supplied by the build instead, for
+ * example to point the driver at a software model of the GEM register and
+ * DMA descriptor interface. All eight must be provided together.
+ */
+#if !defined(MSS_MAC0_BASE)
 #define MSS_MAC0_BASE        (0x20110000U)
 #define MSS_EMAC0_BASE       (0x20111000U)
 #define MSS_MAC1_BASE        (0x20112000U)
@@ -93,6 +101,7 @@ extern IOSCB_IO_CALIB_STRUCT *IOSCB_IO_CALIB_DDR;
 #define MSS_EMAC0_BASE_HI    (0x28111000U)
 #define MSS_MAC1_BASE_HI     (0x28112000U)
 #define MSS_EMAC1_BASE_HI    (0x28113000U)
+#endif
 
 #define MSS_MAC_GEM0_ABP_BIT (0x00010000U)
 #define MSS_MAC_GEM1_ABP_BIT (0x00020000U)
@@ -125,19 +134,42 @@ mss_mac_instance_t g_emac1;
 #endif
 
 #if defined(MSS_MAC_USE_DDR)
+#if !defined(MSS_MAC_MEM_BASE)
 #if MSS_MAC_USE_DDR == MSS_MAC_MEM_DDR
-uint8_t *g_mss_mac_ddr_ptr = (uint8_t *)0xC0000000LLU;
+#define MSS_MAC_MEM_BASE (0xC0000000LLU)
 #elif MSS_MAC_USE_DDR == MSS_MAC_MEM_FIC0
-uint8_t *g_mss_mac_ddr_ptr = (uint8_t *)0x60000000LLU;
+#define MSS_MAC_MEM_BASE (0x60000000LLU)
 #elif MSS_MAC_USE_DDR == MSS_MAC_MEM_FIC1
-uint8_t *g_mss_mac_ddr_ptr = (uint8_t *)0xE0000000LLU;
+#define MSS_MAC_MEM_BASE (0xE0000000LLU)
 #elif MSS_MAC_USE_DDR == MSS_MAC_MEM_CRYPTO
-uint8_t *g_mss_mac_ddr_ptr = (uint8_t *)0x22002000LLU;
+#define MSS_MAC_MEM_BASE (0x22002000LLU)
+#elif MSS_MAC_USE_DDR == MSS_MAC_MEM_SCRATCHPAD
+#define MSS_MAC_MEM_BASE (0x0A000000LLU)
+#elif MSS_MAC_USE_DDR == MSS_MAC_MEM_CACHED_DDR
+#define MSS_MAC_MEM_BASE (0x88000000LLU)
 #else
 #error "bad memory region defined"
 #endif
 #endif
 
+uint8_t *g_mss_mac_ddr_ptr = (uint8_t *)MSS_MAC_MEM_BASE;
+
+/*
+ * Descriptors are smaller than a cache line and the GEM writes back the status
+ * of each one independently, so flushing a line the CPU has written could
+ * overwrite a neighbouring descriptor the GEM has just updated. When using
+ * cached DDR the descriptor rings are therefore accessed through the
+ * non-cached alias of the same memory and only the packet buffers are cached.
+ */
+#if MSS_MAC_USE_DDR == MSS_MAC_MEM_CACHED_DDR
+#if !defined(MSS_MAC_NON_CACHED_OFFSET)
+#define MSS_MAC_NON_CACHED_OFFSET (0x40000000LLU)
+#endif
+#else
+#define MSS_MAC_NON_CACHED_OFFSET (0LLU)
+#endif
+#endif
+
 #if defined(TARGET_ALOE)
 mss_mac_instance_t g_mac0;
 #endif
@@ -152,8 +184,15 @@ static void rx_desc_ring_init(mss_mac_instance_t *this_mac);
 static void assign_station_addr(mss_mac_instance_t *this_mac,
                                 const uint8_t mac_addr[MSS_MAC_MAC_LEN]);
 static void generic_mac_irq_handler(mss_mac_instance_t *this_mac, uint64_t queue_no);
-static void rxpkt_handler(mss_mac_instance_t *this_mac, uint64_t queue_no);
+static uint32_t rxpkt_handler(mss_mac_instance_t *this_mac, uint64_t queue_no, uint32_t budget);
+static void rx_poll_schedule(mss_mac_instance_t *this_mac, uint64_t queue_no);
+static uint32_t flow_find_free(uint32_t used, uint32_t limit);
+static volatile uint32_t *plic_hart_enables(uint32_t hart_id);
+static void mac_q_plic_enable(const mss_mac_instance_t *this_mac, uint32_t queue_no);
+static void mac_q_plic_disable(const mss_mac_instance_t *this_mac, uint32_t queue_no);
 static void txpkt_handler(mss_mac_instance_t *this_mac, uint64_t queue_no);
+static void tx_ring_start(mss_mac_instance_t *this_mac, uint32_t queue_no);
+static void tx_ring_reclaim(mss_mac_instance_t *this_mac, uint32_t queue_no);
 static void update_mac_cfg(const mss_mac_instance_t *this_mac);
 static uint8_t probe_phy(const mss_mac_instance_t *this_mac);
 static void instances_init(mss_mac_instance_t *this_mac, mss_mac_cfg_t *cfg);
@@ -286,6 +325,7 @@ MSS_MAC_init(mss_mac_instance_t *this_mac, mss_mac_cfg_t *cfg)
         this_mac->phy_init = cfg->phy_init;
         this_mac->phy_set_link_speed = cfg->phy_set_link_speed;
         this_mac->append_CRC = cfg->append_CRC;
+        this_mac->rx_checksum_offload = cfg->rx_checksum_offload;
 #if defined(MSS_MAC_PHY_HW_RESET) || defined(MSS_MAC_PHY_HW_SRESET)
         this_mac->phy_soft_reset_gpio = cfg->phy_soft_reset_gpio;
         this_mac->phy_soft_reset_pin = cfg->phy_soft_reset_pin;
@@ -346,10 +386,18 @@ MSS_MAC_init(mss_mac_instance_t *this_mac, mss_mac_cfg_t *cfg)
 
         this_mac->rx_discard = 0U; /* Ensure normal RX operation */
 
+        this_mac->flow_type_1_used = 0U;
+        this_mac->flow_type_2_used = 0U;
+        this_mac->flow_ethertype_used = 0U;
+        this_mac->flow_compare_used = 0U;
+
         for (queue_no = 0; queue_no < MSS_MAC_QUEUE_COUNT; queue_no++)
         {
             /* Initialize Tx descriptors related variables. */
             this_mac->queue[queue_no].nb_available_tx_desc = MSS_MAC_TX_RING_SIZE;
+            this_mac->queue[queue_no].current_tx_desc = 0U;
+            this_mac->queue[queue_no].next_free_tx_desc_index = 0U;
+            this_mac->queue[queue_no].tx_ring_mode = 0U;
 
             /* Initialize Rx descriptors related variables. */
             this_mac->queue[queue_no].nb_available_rx_desc = MSS_MAC_RX_RING_SIZE;
@@ -359,6 +407,10 @@ MSS_MAC_init(mss_mac_instance_t *this_mac, mss_mac_cfg_t *cfg)
             /* initialize default interrupt handlers */
             this_mac->queue[queue_no].pckt_tx_callback = (mss_mac_transmit_callback_t)NULL_POINTER;
             this_mac->queue[queue_no].pckt_rx_callback = (mss_mac_receive_callback_t)NULL_POINTER;
+            this_mac->queue[queue_no].rx_poll_callback = (mss_mac_rx_poll_callback_t)NULL_POINTER;
+            this_mac->queue[queue_no].rx_poll_budget = MSS_MAC_RX_RING_SIZE;
+            this_mac->queue[queue_no].rx_poll_scheduled = 0U;
+            this_mac->queue[queue_no].irq_hart = MSS_MAC_IRQ_HART_LOCAL;
 
             /* Added these to MAC structure to make them MAC and queue specific... */
 
@@ -369,6 +421,9 @@ MSS_MAC_init(mss_mac_instance_t *this_mac, mss_mac_cfg_t *cfg)
             this_mac->queue[queue_no].rx_restart = 0U;
             this_mac->queue[queue_no].tx_restart = 0U;
             this_mac->queue[queue_no].tx_reenable = 0U;
+            this_mac->queue[queue_no].rx_polls = 0U;
+            this_mac->queue[queue_no].rx_poll_exhausted = 0U;
+            this_mac->queue[queue_no].rx_poll_rearms = 0U;
         }
 #if 0        
         /* Initialize PHY interface */
@@ -481,6 +536,46 @@ MSS_MAC_init(mss_mac_instance_t *this_mac, mss_mac_cfg_t *cfg)
     this_mac->mac_available = MSS_MAC_AVAILABLE;
 }
 
+#if defined(MSS_MAC_USE_DDR)
+/******************************************************************************
+ * See mss_ethernet_mac.h for details of how to use this function.
+ */
+uint8_t *
+MSS_MAC_alloc_dma_mem(uint32_t size)
+{
+    uint8_t *p_mem;
+
+    p_mem = (uint8_t *)(((uint64_t)g_mss_mac_ddr_ptr + (MSS_MAC_CACHE_LINE_SIZE - 1U)) &
+                        ~((uint64_t)MSS_MAC_CACHE_LINE_SIZE - 1U));
+    g_mss_mac_ddr_ptr = p_mem + size;
+
+    return (p_mem);
+}
+#endif
+
+#if defined(MSS_MAC_USE_DDR) && (MSS_MAC_USE_DDR == MSS_MAC_MEM_CACHED_DDR)
+/******************************************************************************
+ * See mss_ethernet_mac.h for details of how to use this function.
+ */
+void
+MSS_MAC_l2_flush(const volatile void *p_addr, uint32_t length)
+{
+    uint64_t line;
+    uint64_t end;
+
+    line = (uint64_t)p_addr & ~((uint64_t)MSS_MAC_CACHE_LINE_SIZE - 1U);
+    end = (uint64_t)p_addr + length;
+
+    mb(); /* Make sure our stores have reached the L2 before flushing */
+    while (line < end)
+    {
+        CACHE_CTRL->FLUSH64 = line;
+        line += MSS_MAC_CACHE_LINE_SIZE;
+    }
+    mb();
+}
+#endif
+
 /******************************************************************************
  * See mss_ethernet_mac.h for details of how to use this function.
  */
@@ -860,6 +955,9 @@ MSS_MAC_cfg_struct_def_init(mss_mac_cfg_t *cfg)
          */
         cfg->tsu_clock_select = 0U;
         cfg->amba_burst_length = MSS_MAC_AMBA_BURST_16;
+        cfg->rx_buffer_offset = 0U;
+        cfg->tx_checksum_offload = MSS_MAC_DISABLE;
+        cfg->rx_checksum_offload = MSS_MAC_DISABLE;
 
         cfg->phy_extended_read = NULL_mmd_read_extended_regs;
         cfg->phy_extended_write = NULL_mmd_write_extended_regs;
@@ -1094,6 +1192,9 @@ config_mac_hw(mss_mac_instance_t *this_mac, const mss_mac_cfg_t *cfg)
     ASSERT(IS_STATE(cfg->loopback));
     ASSERT(IS_STATE(cfg->rx_flow_ctrl));
     ASSERT(IS_STATE(cfg->tx_flow_ctrl));
+    ASSERT(cfg->rx_buffer_offset <= MSS_MAC_RX_BUFFER_OFFSET_MAX);
+    ASSERT(IS_STATE(cfg->tx_checksum_offload));
+    ASSERT(IS_STATE(cfg->rx_checksum_offload));
 
 #if defined(TARGET_ALOE)
     config_mac_pll_and_reset();
@@ -1167,6 +1268,14 @@ config_mac_hw(mss_mac_instance_t *this_mac, const mss_mac_cfg_t *cfg)
         temp_net_config |= GEM_LENGTH_FIELD_ERROR_FRAME_DISCARD;
     }
 
+    temp_net_config |= (cfg->rx_buffer_offset << GEM_RECEIVE_BUFFER_OFFSET_SHIFT) &
+                       GEM_RECEIVE_BUFFER_OFFSET;
+
+    if (MSS_MAC_ENABLE == cfg->rx_checksum_offload)
+    {
+        temp_net_config |= GEM_RECEIVE_CHECKSUM_OFFLOAD_ENABLE;
+    }
+
     if (MSS_MAC_IPG_DEFVAL !=
         cfg->ipg_multiplier) /* If we have a non zero value here then enable IPG stretching */
     {
@@ -1221,6 +1330,11 @@ config_mac_hw(mss_mac_instance_t *this_mac, const mss_mac_cfg_t *cfg)
     temp_dma_config |= GEM_TX_BD_EXTENDED_MODE_EN | GEM_RX_BD_EXTENDED_MODE_EN;
 #endif
 
+    if (MSS_MAC_ENABLE == cfg->tx_checksum_offload)
+    {
+        temp_dma_config |= GEM_TX_PBUF_TCP_EN; /* Relies on full store and forward mode above */
+    }
+
 #if defined(MSS_MAC_64_BIT_ADDRESS_MODE)
     temp_dma_config |= GEM_DMA_ADDR_BUS_WIDTH_1;
 #endif
@@ -1578,7 +1692,7 @@ MSS_MAC_receive_pkt(mss_mac_instance_t *this_mac,
             }
             else
             {
-                PLIC_DisableIRQ(this_mac->mac_q_int[queue_no]); /* Single interrupt from GEM? */
+                mac_q_plic_disable(this_mac, queue_no); /* Single interrupt from GEM? */
             }
         }
 
@@ -1608,6 +1722,9 @@ MSS_MAC_receive_pkt(mss_mac_instance_t *this_mac,
             --this_mac->queue[queue_no].nb_available_rx_desc;
             next_rx_desc_index = this_mac->queue[queue_no].next_free_rx_desc_index;
 
+            /* No dirty lines may be written back over the buffer once DMA starts */
+            MSS_MAC_CACHE_INVALIDATE(rx_pkt_buffer, MSS_MAC_MAX_RX_BUF_SIZE);
+
             if ((MSS_MAC_RX_RING_SIZE - 1U) == next_rx_desc_index)
             {
                 this_mac->queue[queue_no].rx_desc_tab[next_rx_desc_index].addr_low =
@@ -1695,13 +1812,15 @@ MSS_MAC_receive_pkt(mss_mac_instance_t *this_mac,
             /* Wrap around in case next descriptor is pointing to last in the ring */
             ++this_mac->queue[queue_no].next_free_rx_desc_index;
             this_mac->queue[queue_no].next_free_rx_desc_index %= MSS_MAC_RX_RING_SIZE;
+
+            status = MSS_MAC_SUCCESS;
         }
 
         /*
          * Only call Ethernet Interrupt Enable function if the user says so.
          * See note above for disable...
          */
-        if ((MSS_MAC_INT_ARM == enable) && (0U == this_mac->queue[queue_no].in_isr))
+        if ((MSS_MAC_INT_DISABLE != enable) && (0U == this_mac->queue[queue_no].in_isr))
         {
             if (0U != this_mac->use_local_ints)
             {
@@ -1709,7 +1828,7 @@ MSS_MAC_receive_pkt(mss_mac_instance_t *this_mac,
             }
             else
             {
-                PLIC_EnableIRQ(this_mac->mac_q_int[queue_no]); /* Single interrupt from GEM? */
+                mac_q_plic_enable(this_mac, queue_no); /* Single interrupt from GEM? */
             }
         }
     }
@@ -1717,6 +1836,170 @@ MSS_MAC_receive_pkt(mss_mac_instance_t *this_mac,
     return status;
 }
 
+/******************************************************************************
+ * See mss_ethernet_mac.h for details of how to use this function.
+ */
+uint32_t
+MSS_MAC_receive_pkts(mss_mac_instance_t *this_mac,
+                     uint32_t queue_no,
+                     uint8_t *const rx_pkt_buffers[],
+                     void *const p_user_data[],
+                     uint32_t count,
+                     mss_mac_rx_int_ctrl_t enable)
+{
+    mss_mac_queue_t *p_queue;
+    volatile uint32_t *network_control;
+    uint32_t temp_cr;
+    uint32_t rx_desc_index;
+    uint32_t to_post;
+    uint32_t posted = 0U;
+
+    if (MSS_MAC_AVAILABLE == this_mac->mac_available)
+    {
+        p_queue = &this_mac->queue[queue_no];
+        if (0U != this_mac->is_emac)
+        {
+            network_control = &this_mac->emac_base->NETWORK_CONTROL;
+        }
+        else
+        {
+            network_control = &this_mac->mac_base->NETWORK_CONTROL;
+        }
+
+        if (0U == p_queue->in_isr)
+        {
+            if (0U != this_mac->use_local_ints)
+            {
+                __disable_local_irq(this_mac->mac_q_int[queue_no]);
+            }
+            else
+            {
+                mac_q_plic_disable(this_mac, queue_no);
+            }
+        }
+
+        to_post = count;
+        if (to_post > p_queue->nb_available_rx_desc)
+        {
+            to_post = p_queue->nb_available_rx_desc;
+        }
+
+        temp_cr = *network_control;
+        if ((0U != to_post) && (MSS_MAC_INT_ENABLE != enable) &&
+            (0U != (temp_cr & GEM_ENABLE_RECEIVE)))
+        {
+            /* As for MSS_MAC_receive_pkt(), keep the DMA engine idle while setting up */
+            temp_cr &= ~GEM_ENABLE_RECEIVE;
+            *network_control = temp_cr;
+        }
+
+        /*
+         * Fill in the descriptors in one sweep. The buffer address word goes
+         * last as writing it also clears the used bit and hands the descriptor
+         * to the GEM.
+         */
+        rx_desc_index = p_queue->next_free_rx_desc_index;
+        for (posted = 0U; posted < to_post; posted++)
+        {
+            ASSERT(NULL_POINTER != rx_pkt_buffers[posted]);
+            ASSERT(IS_WORD_ALIGNED(rx_pkt_buffers[posted]));
+
+            if (NULL_POINTER != p_user_data)
+            {
+                p_queue->rx_caller_info[rx_desc_index] = p_user_data[posted];
+            }
+            else
+            {
+                p_queue->rx_caller_info[rx_desc_index] = NULL_POINTER;
+            }
+            MSS_MAC_CACHE_INVALIDATE(rx_pkt_buffers[posted], MSS_MAC_MAX_RX_BUF_SIZE);
+#if defined(MSS_MAC_64_BIT_ADDRESS_MODE)
+            p_queue->rx_desc_tab[rx_desc_index].addr_high =
+                (uint32_t)((uint64_t)rx_pkt_buffers[posted] >> 32);
+#endif
+            if ((MSS_MAC_RX_RING_SIZE - 1U) == rx_desc_index)
+            {
+                p_queue->rx_desc_tab[rx_desc_index].addr_low =
+                    (uint32_t)((uint64_t)rx_pkt_buffers[posted] | GEM_RX_DMA_WRAP);
+                rx_desc_index = 0U;
+            }
+            else
+            {
+                p_queue->rx_desc_tab[rx_desc_index].addr_low =
+                    (uint32_t)((uint64_t)rx_pkt_buffers[posted]);
+                rx_desc_index++;
+            }
+        }
+
+        p_queue->next_free_rx_desc_index = rx_desc_index;
+        p_queue->nb_available_rx_desc -= posted;
+
+        if (0U != posted)
+        {
+            if (MSS_MAC_INT_ARM == enable)
+            {
+                /* Receiver is stopped at this point so the queue pointer can be loaded */
+                mb();
+                *(p_queue->receive_q_ptr) = (uint32_t)((uint64_t)p_queue->rx_desc_tab);
+#if defined(MSS_MAC_64_BIT_ADDRESS_MODE)
+                if (0U != this_mac->is_emac)
+                {
+                    this_mac->emac_base->UPPER_RX_Q_BASE_ADDR =
+                        (uint32_t)((uint64_t)p_queue->rx_desc_tab >> 32);
+                }
+                else
+                {
+                    this_mac->mac_base->UPPER_RX_Q_BASE_ADDR =
+                        (uint32_t)((uint64_t)p_queue->rx_desc_tab >> 32);
+                }
+#endif
+                *network_control = temp_cr | GEM_ENABLE_RECEIVE;
+            }
+            else if ((MSS_MAC_INT_ENABLE == enable) && (0U == (temp_cr & GEM_ENABLE_RECEIVE)))
+            {
+                /* RX disabled so restart it... */
+                mb();
+                *network_control = temp_cr | GEM_ENABLE_RECEIVE;
+            }
+            else
+            {
+                /* Receiver left as is */
+            }
+        }
+
+        if ((MSS_MAC_INT_DISABLE != enable) && (0U == p_queue->in_isr))
+        {
+            if (0U != this_mac->use_local_ints)
+            {
+                __enable_local_irq(this_mac->mac_q_int[queue_no]);
+            }
+            else
+            {
+                mac_q_plic_enable(this_mac, queue_no);
+            }
+        }
+    }
+
+    return posted;
+}
+
+/******************************************************************************
+ * See mss_ethernet_mac.h for details of how to use this function.
+ */
+mss_mac_rx_csum_t
+MSS_MAC_get_rx_csum_status(const mss_mac_instance_t *this_mac, const mss_mac_rx_desc_t *cdesc)
+{
+    mss_mac_rx_csum_t csum_status = MSS_MAC_RX_CSUM_NOT_CHECKED;
+
+    if (MSS_MAC_ENABLE == this_mac->rx_checksum_offload)
+    {
+        csum_status = (mss_mac_rx_csum_t)((cdesc->status & GEM_RX_DMA_CSUM_STATUS) >>
+                                          GEM_RX_DMA_CSUM_STATUS_SHIFT);
+    }
+
+    return (csum_status);
+}
+
 #if defined(MSS_MAC_UNH_TEST)
 /******************************************************************************
  * We take a lot of short cuts here as we "know" we are called from ISR and
@@ -1778,7 +2061,17 @@ MSS_MAC_send_pkt(mss_mac_instance_t *this_mac,
     volatile uint32_t *p_nw_control;
     volatile uint32_t *p_tx_status;
 
-    if (MSS_MAC_AVAILABLE == this_mac->mac_available)
+    if ((MSS_MAC_AVAILABLE == this_mac->mac_available) &&
+        (0U != this_mac->queue[queue_no].tx_ring_mode))
+    {
+        /* Queue has been switched to ring mode so just add it to the ring */
+        mss_mac_tx_frag_t frag;
+
+        frag.tx_buffer = tx_buffer;
+        frag.length = length;
+        status = MSS_MAC_send_pkt_sg(this_mac, queue_no, &frag, 1U, p_user_data);
+    }
+    else if (MSS_MAC_AVAILABLE == this_mac->mac_available)
     {
         /* Is config option for disabling CRC set? */
         if (MSS_MAC_CRC_DISABLE == this_mac->append_CRC)
@@ -1804,7 +2097,7 @@ MSS_MAC_send_pkt(mss_mac_instance_t *this_mac,
             }
             else
             {
-                PLIC_DisableIRQ(this_mac->mac_q_int[queue_no]); /* Single interrupt from GEM? */
+                mac_q_plic_disable(this_mac, queue_no); /* Single interrupt from GEM? */
             }
         }
 
@@ -1851,6 +2144,7 @@ MSS_MAC_send_pkt(mss_mac_instance_t *this_mac,
             /* Set up tx descriptor for this packet */
             this_mac->queue[queue_no].nb_available_tx_desc--;
             this_mac->queue[queue_no].current_tx_desc = 0;
+            MSS_MAC_CACHE_FLUSH(tx_buffer, tx_length & GEM_TX_DMA_BUFF_LEN);
             this_mac->queue[queue_no].tx_desc_tab[0].addr_low = (uint32_t)((uint64_t)tx_buffer);
 
             /* Mark as last buffer for frame */
@@ -1971,7 +2265,7 @@ MSS_MAC_send_pkt(mss_mac_instance_t *this_mac,
             }
             else
             {
-                PLIC_EnableIRQ(this_mac->mac_q_int[queue_no]); /* Single interrupt from GEM? */
+                mac_q_plic_enable(this_mac, queue_no); /* Single interrupt from GEM? */
             }
         }
     }
@@ -2058,8 +2352,7 @@ MSS_MAC_send_pkts(mss_mac_instance_t *this_mac,
                     }
                     else
                     {
-                        PLIC_DisableIRQ(
-                            this_mac->mac_q_int[counter]); /* Single interrupt from GEM? */
+                        mac_q_plic_disable(this_mac, counter); /* Single interrupt from GEM? */
                     }
                 }
 
@@ -2078,13 +2371,19 @@ MSS_MAC_send_pkts(mss_mac_instance_t *this_mac,
 
         if (tx_done)
         {
-            /* Queues are fully available for transmit so clear retry counts */
+            /*
+             * Queues are fully available for transmit so clear retry counts.
+             * Any queue left in ring mode by MSS_MAC_send_pkt_sg() or
+             * MSS_MAC_send_pkts_stream() is idle and reverts to the simple
+             * scheme used here.
+             */
             for (counter = 0; counter != queues; counter++)
             {
                 /* Make sure queue is currently disabled */
                 *this_mac->queue[counter].transmit_q_ptr =
                     (uint32_t)((uint64_t)this_mac->queue[counter].tx_desc_tab) | 1UL;
                 this_mac->queue[counter].tries = 0UL;
+                this_mac->queue[counter].tx_ring_mode = 0U;
             }
 
             /* Make sure transmit is enabled */
@@ -2140,6 +2439,7 @@ MSS_MAC_send_pkts(mss_mac_instance_t *this_mac,
 
                     p_queue->nb_available_tx_desc--;
                     p_queue->current_tx_desc = 0;
+                    MSS_MAC_CACHE_FLUSH(tx_rover->tx_buffer, tx_length & GEM_TX_DMA_BUFF_LEN);
                     p_desc->addr_low = (uint32_t)((uint64_t)tx_rover->tx_buffer);
 
                     /* Mark as last buffer for frame */
@@ -2354,8 +2654,7 @@ MSS_MAC_send_pkts(mss_mac_instance_t *this_mac,
                     }
                     else
                     {
-                        PLIC_EnableIRQ(
-                            this_mac->mac_q_int[counter]); /* Single interrupt from GEM? */
+                        mac_q_plic_enable(this_mac, counter); /* Single interrupt from GEM? */
                     }
                 }
 
@@ -2366,102 +2665,462 @@ MSS_MAC_send_pkts(mss_mac_instance_t *this_mac,
     return status;
 }
 
-#if defined(MSS_MAC_SPEED_TEST)
-/* Very stripped down queue 0 packet blaster - assumes full tx queue0 is being
- * used on pMAC and does little or no checking. Don't call from GEM interrupts!
- * Don't use with local interrupts or eMAC either...
+/*******************************************************************************
+ * See mss_ethernet_mac.h for details of how to use this function.
  */
-
-void
-copy8b(uint64_t *dest, uint64_t *source, uint32_t count)
-{
-    while (count--)
-        *dest++ = *source++;
-}
-
 int32_t
-MSS_MAC_send_pkts_fast(mss_mac_instance_t *this_mac,
-                       mss_mac_tx_desc_t *descriptors,
-                       uint32_t tx_count)
+MSS_MAC_send_pkt_sg(mss_mac_instance_t *this_mac,
+                    uint32_t queue_no,
+                    mss_mac_tx_frag_t const *p_frags,
+                    uint32_t frag_count,
+                    void *p_user_data)
 {
     /*
-     * Multi packet, multi queue transmit operation which depends on the
-     * following assumptions:
-     *
-     * 1. queue_mask indicates the queues which may be involved so that we can
-     *    properly handle ISR vs normal calling.
-     *    Set the mask to 0x0000000F to indicate all queues if there is any
-     *    uncertainty.
-     *    Set the mask to 0xFFFFFFF0 to indicate we are being called from a GEM
-     *    ISR.
-     * 2. We wait for any outstanding transmits on other queues to complete
-     *    because we need to ALWAYS write to the queue 0 pointer to trigger
-     *    internal restart of the DMA process.
-     * 3. We accept at most MSS_MAC_TX_RING_SIZE-1 packets as the final packet
-     *    in the chain is a dummy one to get the TX DMA engine to stop. Any
-     *    packets beyond that are silently dropped.
+     * Ring mode transmit operation. Unlike MSS_MAC_send_pkt() we do not wait
+     * for the queue to drain before adding another packet:
      *
-     * We do transmission by using multiple buffer descriptors. The initial
-     * descriptors are for the packet(s) to transmit and the last is a dummy one
-     * with the USED bit set. This halts transmission once the first packet is
-     * transmitted. We always reset the TX DMA to point to the first packet when
-     * we send packets so we don't have to juggle buffer positions or worry
-     * about wrap.
+     * 1. Each fragment of the packet gets its own descriptor and only the
+     *    descriptor for the final fragment is marked as LAST.
+     * 2. One descriptor after the most recently queued packet is always left
+     *    with the USED bit set so the DMA engine halts there once it has
+     *    caught up. This limits the ring to MSS_MAC_TX_RING_SIZE - 1
+     *    descriptors in flight.
+     * 3. The descriptors are written back to front and the USED bit of the
+     *    first one is only cleared once the rest of the packet is in place,
+     *    then the transmitter is kicked in case it had stopped.
+     * 4. Completed packets are reclaimed in a batch by the transmit interrupt
+     *    handler which calls the transmit callback once per packet.
      */
-    volatile int delay = 0;
+    int32_t status = MSS_MAC_ERR_NOT_DONE;
+    mss_mac_queue_t *p_queue;
     volatile uint32_t *p_nw_control;
-    volatile uint32_t *p_tx_status;
+    uint32_t first;
+    uint32_t index;
+    uint32_t frag;
+    uint32_t frag_length;
+    uint32_t desc_status;
+    uint32_t first_status = 0U;
+    uint32_t tx_length = 0U;
+    uint32_t no_crc = 0U;
 
-    p_nw_control = &this_mac->mac_base->NETWORK_CONTROL;
-    p_tx_status = &this_mac->mac_base->TRANSMIT_STATUS;
+    ASSERT(NULL_POINTER != p_frags);
+    ASSERT(0U != frag_count);
+    ASSERT(frag_count < MSS_MAC_TX_RING_SIZE);
 
-    /* Wait for queue to empty */
-    while (this_mac->queue[0].nb_available_tx_desc != (uint32_t)MSS_MAC_TX_RING_SIZE)
+    if ((MSS_MAC_AVAILABLE == this_mac->mac_available) && (NULL_POINTER != p_frags) &&
+        (0U != frag_count))
     {
-        /* Make sure transmit stays enabled */
-        if (0 == (*p_nw_control & GEM_ENABLE_TRANSMIT))
+        p_queue = &this_mac->queue[queue_no];
+
+        if (0U != this_mac->is_emac)
         {
-            *p_nw_control = *p_nw_control | GEM_ENABLE_TRANSMIT;
+            p_nw_control = &this_mac->emac_base->NETWORK_CONTROL;
+        }
+        else
+        {
+            p_nw_control = &this_mac->mac_base->NETWORK_CONTROL;
         }
-    }
-
-    PLIC_DisableIRQ(this_mac->mac_q_int[0]); /* Single interrupt from GEM? */
-
-    /*
-     * Wait for pending transmits to complete as you cannot alter
-     * tx queue pointers while transmit is active...
-     */
-    while (0 != (*p_tx_status & GEM_TRANSMIT_GO))
-    {
-        delay++; /* Empty loop will cause debug issues... */
-    }
 
-    *this_mac->queue[0].transmit_q_ptr = (uint32_t)((uint64_t)this_mac->queue[0].tx_desc_tab) | 1UL;
-    this_mac->queue[0].tries = 0UL;
+        /* Is config option for disabling CRC set? */
+        if (MSS_MAC_CRC_DISABLE == this_mac->append_CRC)
+        {
+            no_crc = 1U;
+        }
 
-    /* All is quiet now so let's construct the TX queue(s) */
+        /* Or has the user requested just this packet? */
+        if (0U != (p_frags[0].length & 0x80000000U))
+        {
+            no_crc = 1U;
+        }
 
-    copy8b((uint64_t *)this_mac->queue[0].tx_desc_tab,
-           (uint64_t *)descriptors,
-           sizeof(this_mac->queue[0].tx_desc_tab) / 8);
+        /* Make this function atomic w.r.to EMAC interrupt */
+        /* PLIC_DisableIRQ() et al should not be called from the associated interrupt... */
+        if (0U == p_queue->in_isr)
+        {
+            if (0U != this_mac->use_local_ints)
+            {
+                __disable_local_irq(this_mac->mac_q_int[queue_no]);
+            }
+            else
+            {
+                mac_q_plic_disable(this_mac, queue_no); /* Single interrupt from GEM? */
+            }
+        }
 
-    this_mac->queue[0].egress += tx_count;
+        /*
+         * Switch the queue over to ring mode the first time through. We can
+         * only do this once any MSS_MAC_send_pkt() style transmit has finished.
+         */
+        if ((0U == p_queue->tx_ring_mode) &&
+            (p_queue->nb_available_tx_desc == (uint32_t)MSS_MAC_TX_RING_SIZE))
+        {
+            tx_ring_start(this_mac, queue_no);
+        }
 
-    this_mac->queue[0].nb_available_tx_desc = 1;
-    this_mac->queue[0].current_tx_desc = 0;
-    *this_mac->queue[0].transmit_q_ptr = (uint32_t)((uint64_t)&this_mac->queue[0].tx_desc_tab[0]);
-    *p_nw_control = *p_nw_control | GEM_TRANSMIT_START;
+        /* Need one descriptor per fragment plus the one we stop on */
+        if ((0U != p_queue->tx_ring_mode) && (p_queue->nb_available_tx_desc > frag_count))
+        {
+            first = p_queue->next_free_tx_desc_index;
 
-    PLIC_EnableIRQ(this_mac->mac_q_int[0]); /* Single interrupt from GEM? */
+            /* New stop descriptor goes after the end of this packet */
+            index = (first + frag_count) % MSS_MAC_TX_RING_SIZE;
+            p_queue->tx_desc_tab[index].status = GEM_TX_DMA_USED;
+            if ((MSS_MAC_TX_RING_SIZE - 1U) == index)
+            {
+                p_queue->tx_desc_tab[index].status |= GEM_TX_DMA_WRAP;
+            }
 
-    return (MSS_MAC_ERR_OK);
-}
+            frag = frag_count;
+            while (0U != frag)
+            {
+                frag--;
+                index = (first + frag) % MSS_MAC_TX_RING_SIZE;
+                frag_length = p_frags[frag].length & 0x7FFFFFFFU;
 
-#endif /* defined(MSS_MAC_SPEED_TEST) */
+                ASSERT(NULL_POINTER != p_frags[frag].tx_buffer);
+                ASSERT(0U != frag_length);
 
-/******************************************************************************
- *
- */
+                MSS_MAC_CACHE_FLUSH(p_frags[frag].tx_buffer, frag_length);
+                p_queue->tx_desc_tab[index].addr_low =
+                    (uint32_t)((uint64_t)p_frags[frag].tx_buffer);
+#if defined(MSS_MAC_64_BIT_ADDRESS_MODE)
+                p_queue->tx_desc_tab[index].addr_high =
+                    (uint32_t)((uint64_t)p_frags[frag].tx_buffer >> 32);
+                p_queue->tx_desc_tab[index].unused = 0U;
+#endif
+                desc_status = frag_length & GEM_TX_DMA_BUFF_LEN;
+                if ((frag_count - 1U) == frag)
+                {
+                    /* Mark as last buffer for frame */
+                    desc_status |= GEM_TX_DMA_LAST;
+                    if (0U != no_crc)
+                    {
+                        desc_status |= GEM_TX_DMA_NO_CRC;
+                    }
+                }
+
+                if ((MSS_MAC_TX_RING_SIZE - 1U) == index)
+                {
+                    desc_status |= GEM_TX_DMA_WRAP;
+                }
+
+                if (0U == frag)
+                {
+                    first_status = desc_status; /* Hold back until packet is complete */
+                }
+                else
+                {
+                    p_queue->tx_desc_tab[index].status = desc_status;
+                    p_queue->tx_caller_info[index] = NULL_POINTER;
+                }
+
+                tx_length += frag_length;
+            }
+
+            p_queue->tx_caller_info[first] = p_user_data;
+            p_queue->nb_available_tx_desc -= frag_count;
+            p_queue->next_free_tx_desc_index = (first + frag_count) % MSS_MAC_TX_RING_SIZE;
+            p_queue->egress += tx_length;
+
+            /* Hand the packet over to the GEM and make sure it is running */
+            mb();
+            p_queue->tx_desc_tab[first].status = first_status;
+            mb();
+            *p_nw_control = *p_nw_control | GEM_TRANSMIT_START;
+
+            status = MSS_MAC_ERR_OK;
+        }
+
+        /* Ethernet Interrupt Enable function. */
+        /* PLIC_DisableIRQ() et al should not be called from the associated interrupt... */
+        if (0U == p_queue->in_isr)
+        {
+            if (0U != this_mac->use_local_ints)
+            {
+                __enable_local_irq(this_mac->mac_q_int[queue_no]);
+            }
+            else
+            {
+                mac_q_plic_enable(this_mac, queue_no); /* Single interrupt from GEM? */
+            }
+        }
+    }
+
+    return status;
+}
+
+/*******************************************************************************
+ * See mss_ethernet_mac.h for details of how to use this function.
+ */
+uint32_t
+MSS_MAC_send_pkts_stream(mss_mac_instance_t *this_mac,
+                         uint32_t queue_no,
+                         mss_mac_tx_pkt_info_t const *p_packets,
+                         uint32_t count)
+{
+    /*
+     * Streaming transmit operation built on the same ring as
+     * MSS_MAC_send_pkt_sg(). The DMA engine is never stopped or rewound, we
+     * simply keep adding packets ahead of it:
+     *
+     * 1. Completed packets are reclaimed here as well as in the transmit
+     *    interrupt so a caller that keeps the ring full makes progress even
+     *    when the interrupt is slow to be serviced.
+     * 2. As many of the packets as there is room for are queued, one
+     *    descriptor each, behind a single new stop descriptor.
+     * 3. The USED bit of the first descriptor of the batch is cleared last so
+     *    the GEM sees the whole batch at once, then the transmitter is kicked
+     *    in case it had caught up and stopped.
+     */
+    uint32_t queued = 0U;
+    mss_mac_queue_t *p_queue;
+    volatile uint32_t *p_nw_control;
+    uint32_t first;
+    uint32_t index;
+    uint32_t pkt;
+    uint32_t pkt_length;
+    uint32_t desc_status;
+    uint32_t first_status = 0U;
+    uint64_t tx_length = 0U;
+    uint32_t no_crc = 0U;
+
+    ASSERT(NULL_POINTER != p_packets);
+
+    if ((MSS_MAC_AVAILABLE == this_mac->mac_available) && (NULL_POINTER != p_packets) &&
+        (0U != count))
+    {
+        p_queue = &this_mac->queue[queue_no];
+
+        if (0U != this_mac->is_emac)
+        {
+            p_nw_control = &this_mac->emac_base->NETWORK_CONTROL;
+        }
+        else
+        {
+            p_nw_control = &this_mac->mac_base->NETWORK_CONTROL;
+        }
+
+        /* Is config option for disabling CRC set? */
+        if (MSS_MAC_CRC_DISABLE == this_mac->append_CRC)
+        {
+            no_crc = 1U;
+        }
+
+        /* Make this function atomic w.r.to EMAC interrupt */
+        /* PLIC_DisableIRQ() et al should not be called from the associated interrupt... */
+        if (0U == p_queue->in_isr)
+        {
+            if (0U != this_mac->use_local_ints)
+            {
+                __disable_local_irq(this_mac->mac_q_int[queue_no]);
+            }
+            else
+            {
+                mac_q_plic_disable(this_mac, queue_no); /* Single interrupt from GEM? */
+            }
+        }
+
+        if ((0U == p_queue->tx_ring_mode) &&
+            (p_queue->nb_available_tx_desc == (uint32_t)MSS_MAC_TX_RING_SIZE))
+        {
+            tx_ring_start(this_mac, queue_no);
+        }
+
+        if (0U != p_queue->tx_ring_mode)
+        {
+            tx_ring_reclaim(this_mac, queue_no);
+
+            /* Always keep one descriptor back to stop on */
+            queued = p_queue->nb_available_tx_desc - 1U;
+            if (count < queued)
+            {
+                queued = count;
+            }
+        }
+
+        if (0U != queued)
+        {
+            first = p_queue->next_free_tx_desc_index;
+
+            /* New stop descriptor goes after the end of this batch */
+            index = (first + queued) % MSS_MAC_TX_RING_SIZE;
+            p_queue->tx_desc_tab[index].status = GEM_TX_DMA_USED;
+            if ((MSS_MAC_TX_RING_SIZE - 1U) == index)
+            {
+                p_queue->tx_desc_tab[index].status |= GEM_TX_DMA_WRAP;
+            }
+
+            index = first;
+            for (pkt = 0U; pkt < queued; ++pkt)
+            {
+                pkt_length = p_packets[pkt].length & 0x7FFFFFFFU;
+
+                ASSERT(NULL_POINTER != p_packets[pkt].tx_buffer);
+                ASSERT(0U != pkt_length);
+
+                MSS_MAC_CACHE_FLUSH(p_packets[pkt].tx_buffer, pkt_length);
+                p_queue->tx_desc_tab[index].addr_low =
+                    (uint32_t)((uint64_t)p_packets[pkt].tx_buffer);
+#if defined(MSS_MAC_64_BIT_ADDRESS_MODE)
+                p_queue->tx_desc_tab[index].addr_high =
+                    (uint32_t)((uint64_t)p_packets[pkt].tx_buffer >> 32);
+                p_queue->tx_desc_tab[index].unused = 0U;
+#endif
+                /* Mark as last buffer for frame */
+                desc_status = (pkt_length & GEM_TX_DMA_BUFF_LEN) | GEM_TX_DMA_LAST;
+                if ((0U != no_crc) || (0U != (p_packets[pkt].length & 0x80000000U)))
+                {
+                    desc_status |= GEM_TX_DMA_NO_CRC;
+                }
+
+                if ((MSS_MAC_TX_RING_SIZE - 1U) == index)
+                {
+                    desc_status |= GEM_TX_DMA_WRAP;
+                }
+
+                if (first == index)
+                {
+                    first_status = desc_status; /* Hold back until batch is complete */
+                }
+                else
+                {
+                    p_queue->tx_desc_tab[index].status = desc_status;
+                }
+
+                p_queue->tx_caller_info[index] = p_packets[pkt].p_user_data;
+                tx_length += pkt_length;
+                index = (index + 1U) % MSS_MAC_TX_RING_SIZE;
+            }
+
+            p_queue->nb_available_tx_desc -= queued;
+            p_queue->next_free_tx_desc_index = index;
+            p_queue->egress += tx_length;
+
+            /* Hand the batch over to the GEM and make sure it is running */
+            mb();
+            p_queue->tx_desc_tab[first].status = first_status;
+            mb();
+            *p_nw_control = *p_nw_control | GEM_TRANSMIT_START;
+        }
+
+        /* Ethernet Interrupt Enable function. */
+        /* PLIC_DisableIRQ() et al should not be called from the associated interrupt... */
+        if (0U == p_queue->in_isr)
+        {
+            if (0U != this_mac->use_local_ints)
+            {
+                __enable_local_irq(this_mac->mac_q_int[queue_no]);
+            }
+            else
+            {
+                mac_q_plic_enable(this_mac, queue_no); /* Single interrupt from GEM? */
+            }
+        }
+    }
+
+    return queued;
+}
+
+#if defined(MSS_MAC_SPEED_TEST)
+/* Very stripped down queue 0 packet blaster - assumes full tx queue0 is being
+ * used on pMAC and does little or no checking. Don't call from GEM interrupts!
+ * Don't use with local interrupts or eMAC either...
+ *
+ * Every call waits for the queue to drain and rewinds the DMA engine so there
+ * is a gap between batches. Use MSS_MAC_send_pkts_stream() for sustained
+ * transmission.
+ */
+
+void
+copy8b(uint64_t *dest, uint64_t *source, uint32_t count)
+{
+    while (count--)
+        *dest++ = *source++;
+}
+
+int32_t
+MSS_MAC_send_pkts_fast(mss_mac_instance_t *this_mac,
+                       mss_mac_tx_desc_t *descriptors,
+                       uint32_t tx_count)
+{
+    /*
+     * Multi packet, multi queue transmit operation which depends on the
+     * following assumptions:
+     *
+     * 1. queue_mask indicates the queues which may be involved so that we can
+     *    properly handle ISR vs normal calling.
+     *    Set the mask to 0x0000000F to indicate all queues if there is any
+     *    uncertainty.
+     *    Set the mask to 0xFFFFFFF0 to indicate we are being called from a GEM
+     *    ISR.
+     * 2. We wait for any outstanding transmits on other queues to complete
+     *    because we need to ALWAYS write to the queue 0 pointer to trigger
+     *    internal restart of the DMA process.
+     * 3. We accept at most MSS_MAC_TX_RING_SIZE-1 packets as the final packet
+     *    in the chain is a dummy one to get the TX DMA engine to stop. Any
+     *    packets beyond that are silently dropped.
+     *
+     * We do transmission by using multiple buffer descriptors. The initial
+     * descriptors are for the packet(s) to transmit and the last is a dummy one
+     * with the USED bit set. This halts transmission once the first packet is
+     * transmitted. We always reset the TX DMA to point to the first packet when
+     * we send packets so we don't have to juggle buffer positions or worry
+     * about wrap.
+     */
+    volatile int delay = 0;
+    volatile uint32_t *p_nw_control;
+    volatile uint32_t *p_tx_status;
+
+    p_nw_control = &this_mac->mac_base->NETWORK_CONTROL;
+    p_tx_status = &this_mac->mac_base->TRANSMIT_STATUS;
+
+    /* Wait for queue to empty */
+    while (this_mac->queue[0].nb_available_tx_desc != (uint32_t)MSS_MAC_TX_RING_SIZE)
+    {
+        /* Make sure transmit stays enabled */
+        if (0 == (*p_nw_control & GEM_ENABLE_TRANSMIT))
+        {
+            *p_nw_control = *p_nw_control | GEM_ENABLE_TRANSMIT;
+        }
+    }
+
+    mac_q_plic_disable(this_mac, 0U); /* Single interrupt from GEM? */
+
+    /*
+     * Wait for pending transmits to complete as you cannot alter
+     * tx queue pointers while transmit is active...
+     */
+    while (0 != (*p_tx_status & GEM_TRANSMIT_GO))
+    {
+        delay++; /* Empty loop will cause debug issues... */
+    }
+
+    *this_mac->queue[0].transmit_q_ptr = (uint32_t)((uint64_t)this_mac->queue[0].tx_desc_tab) | 1UL;
+    this_mac->queue[0].tries = 0UL;
+
+    /* All is quiet now so let's construct the TX queue(s) */
+
+    copy8b((uint64_t *)this_mac->queue[0].tx_desc_tab,
+           (uint64_t *)descriptors,
+           (MSS_MAC_TX_RING_SIZE * sizeof(mss_mac_tx_desc_t)) / 8);
+
+    this_mac->queue[0].egress += tx_count;
+
+    this_mac->queue[0].nb_available_tx_desc = 1;
+    this_mac->queue[0].current_tx_desc = 0;
+    *this_mac->queue[0].transmit_q_ptr = (uint32_t)((uint64_t)&this_mac->queue[0].tx_desc_tab[0]);
+    *p_nw_control = *p_nw_control | GEM_TRANSMIT_START;
+
+    mac_q_plic_enable(this_mac, 0U); /* Single interrupt from GEM? */
+
+    return (MSS_MAC_ERR_OK);
+}
+
+#endif /* defined(MSS_MAC_SPEED_TEST) */
+
+/******************************************************************************
+ *
+ */
 #if defined(USING_LWIP)
 extern BaseType_t g_mac_context_switch;
 #endif
@@ -3200,7 +3859,14 @@ generic_mac_irq_handler(mss_mac_instance_t *this_mac, uint64_t queue_no)
 #else
         *int_status = (uint32_t)2U;
 #endif
-        rxpkt_handler(this_mac, queue_no);
+        if (NULL_POINTER != p_queue->rx_poll_callback)
+        {
+            rx_poll_schedule(this_mac, queue_no);
+        }
+        else
+        {
+            (void)rxpkt_handler(this_mac, queue_no, MSS_MAC_RX_RING_SIZE);
+        }
         p_queue->overflow_counter = 0U; /* Reset counter as we have received something */
 #endif
     }
@@ -3242,7 +3908,14 @@ generic_mac_irq_handler(mss_mac_instance_t *this_mac, uint64_t queue_no)
 #if !defined(GEM_FLAGS_CLR_ON_RD)
             *int_status = GEM_RX_USED_BIT_READ;
 #endif
-            rxpkt_handler(this_mac, queue_no);
+            if (NULL_POINTER != p_queue->rx_poll_callback)
+            {
+                rx_poll_schedule(this_mac, queue_no);
+            }
+            else
+            {
+                (void)rxpkt_handler(this_mac, queue_no, MSS_MAC_RX_RING_SIZE);
+            }
             p_queue->rx_overflow++;
             p_queue->overflow_counter++;
         }
@@ -3345,7 +4018,10 @@ generic_mac_irq_handler(mss_mac_instance_t *this_mac, uint64_t queue_no)
                 *tx_status = GEM_STAT_AMBA_ERROR;
                 *rx_status = GEM_AMBA_ERROR;
                 p_queue->tx_amba_errors++;
-                p_queue->nb_available_tx_desc = MSS_MAC_TX_RING_SIZE;
+                if (0U == p_queue->tx_ring_mode)
+                {
+                    p_queue->nb_available_tx_desc = MSS_MAC_TX_RING_SIZE;
+                }
             }
             else
             {
@@ -3389,6 +4065,130 @@ MSS_MAC_set_rx_callback(mss_mac_instance_t *this_mac,
     }
 }
 
+/******************************************************************************
+ * See mss_ethernet_mac.h for details of how to use this function.
+ */
+void
+MSS_MAC_set_rx_poll_mode(mss_mac_instance_t *this_mac,
+                         uint32_t queue_no,
+                         mss_mac_rx_poll_callback_t poll_callback,
+                         uint32_t budget)
+{
+    mss_mac_queue_t *p_queue;
+
+    if (MSS_MAC_AVAILABLE == this_mac->mac_available)
+    {
+        p_queue = &this_mac->queue[queue_no];
+
+        if (0U != this_mac->use_local_ints)
+        {
+            __disable_local_irq(this_mac->mac_q_int[queue_no]);
+        }
+        else
+        {
+            mac_q_plic_disable(this_mac, queue_no);
+        }
+
+        p_queue->rx_poll_budget = (0U == budget) ? MSS_MAC_RX_RING_SIZE : budget;
+        p_queue->rx_poll_callback = poll_callback;
+
+        /*
+         * Leaving poll mode with a poll outstanding would leave the receive
+         * interrupts masked so restore them here.
+         */
+        if ((NULL_POINTER == poll_callback) && (0U != p_queue->rx_poll_scheduled))
+        {
+            p_queue->rx_poll_scheduled = 0U;
+            *p_queue->int_enable = GEM_RECEIVE_COMPLETE | GEM_RX_USED_BIT_READ;
+        }
+
+        if (0U != this_mac->use_local_ints)
+        {
+            __enable_local_irq(this_mac->mac_q_int[queue_no]);
+        }
+        else
+        {
+            mac_q_plic_enable(this_mac, queue_no);
+        }
+    }
+}
+
+/******************************************************************************
+ * See mss_ethernet_mac.h for details of how to use this function.
+ */
+uint32_t
+MSS_MAC_rx_poll(mss_mac_instance_t *this_mac, uint32_t queue_no)
+{
+    mss_mac_queue_t *p_queue;
+    mss_mac_rx_desc_t *cdesc;
+    uint32_t processed = 0U;
+
+    if (MSS_MAC_AVAILABLE == this_mac->mac_available)
+    {
+        p_queue = &this_mac->queue[queue_no];
+
+        /*
+         * Run the receive handler under the same conditions as the ISR so the
+         * receive callback can return buffers with MSS_MAC_receive_pkt() as
+         * usual.
+         */
+        if (0U != this_mac->use_local_ints)
+        {
+            __disable_local_irq(this_mac->mac_q_int[queue_no]);
+        }
+        else
+        {
+            mac_q_plic_disable(this_mac, queue_no);
+        }
+
+        p_queue->in_isr = 1U;
+        p_queue->rx_polls++;
+
+        processed = rxpkt_handler(this_mac, queue_no, p_queue->rx_poll_budget);
+
+        if (processed >= p_queue->rx_poll_budget)
+        {
+            p_queue->rx_poll_exhausted++; /* Leave interrupts masked, caller polls again */
+        }
+        else if (0U != p_queue->rx_poll_scheduled)
+        {
+            /*
+             * Ring is empty so go back to interrupt mode. Any status latched
+             * while polling is stale so clear it first, then re-check the ring
+             * to catch a packet which landed before the interrupts were back.
+             */
+            *p_queue->int_status = GEM_RECEIVE_COMPLETE | GEM_RX_USED_BIT_READ;
+            p_queue->rx_poll_scheduled = 0U;
+            p_queue->rx_poll_rearms++;
+            *p_queue->int_enable = GEM_RECEIVE_COMPLETE | GEM_RX_USED_BIT_READ;
+
+            cdesc = &p_queue->rx_desc_tab[p_queue->first_rx_desc_index];
+            if ((0U != (cdesc->addr_low & GEM_RX_DMA_USED)) &&
+                (p_queue->nb_available_rx_desc < MSS_MAC_RX_RING_SIZE))
+            {
+                rx_poll_schedule(this_mac, queue_no);
+            }
+        }
+        else
+        {
+            /* Not in poll mode or interrupts already enabled */
+        }
+
+        p_queue->in_isr = 0U;
+
+        if (0U != this_mac->use_local_ints)
+        {
+            __enable_local_irq(this_mac->mac_q_int[queue_no]);
+        }
+        else
+        {
+            mac_q_plic_enable(this_mac, queue_no);
+        }
+    }
+
+    return processed;
+}
+
 /******************************************************************************
  * See mss_ethernet_mac.h for details of how to use this function.
  */
@@ -4678,6 +5478,232 @@ MSS_MAC_get_type_2_filter(const mss_mac_instance_t *this_mac,
     }
 }
 
+/******************************************************************************
+ * See mss_ethernet_mac.h for details of how to use this function.
+ */
+
+uint8_t
+MSS_MAC_add_flow_rule(mss_mac_instance_t *this_mac, const mss_mac_flow_rule_t *rule)
+{
+    uint8_t status = MSS_MAC_FAILED;
+    uint32_t t2_limit;
+    uint32_t compare_limit;
+    uint32_t filter_no;
+    uint32_t index_a;
+    uint32_t index_b = INVALID_INDEX;
+    mss_mac_type_1_filter_t t1_filter;
+    mss_mac_type_2_filter_t t2_filter;
+    mss_mac_type_2_compare_t compare;
+
+    if ((MSS_MAC_AVAILABLE == this_mac->mac_available) &&
+        (rule->queue_no < MSS_MAC_QUEUE_COUNT) &&
+        ((0U == this_mac->is_emac) || (0U == rule->queue_no))) /* eMAC only has one queue */
+    {
+        if (0U != this_mac->is_emac) /* eMAC limits are different to pMAC ones */
+        {
+            t2_limit = MSS_MAC_EMAC_TYPE_2_SCREENERS;
+            compare_limit = MSS_MAC_EMAC_TYPE_2_COMPARERS;
+        }
+        else
+        {
+            t2_limit = MSS_MAC_TYPE_2_SCREENERS;
+            compare_limit = MSS_MAC_TYPE_2_COMPARERS;
+        }
+
+        (void)memset(&t2_filter, 0, sizeof(mss_mac_type_2_filter_t));
+        t2_filter.queue_no = rule->queue_no;
+
+        switch (rule->type)
+        {
+            case MSS_MAC_FLOW_UDP_PORT:
+                filter_no = flow_find_free(this_mac->flow_type_1_used, MSS_MAC_TYPE_1_SCREENERS);
+                if (INVALID_INDEX != filter_no)
+                {
+                    (void)memset(&t1_filter, 0, sizeof(mss_mac_type_1_filter_t));
+                    t1_filter.udp_port = rule->value;
+                    t1_filter.udp_port_enable = 1U;
+                    t1_filter.queue_no = rule->queue_no;
+                    MSS_MAC_set_type_1_filter(this_mac, filter_no, &t1_filter);
+                    this_mac->flow_type_1_used |= 1UL << filter_no;
+                    status = MSS_MAC_SUCCESS;
+                }
+                break;
+
+            case MSS_MAC_FLOW_TCP_PORT:
+                /*
+                 * Type 1 Filters only handle UDP so use a pair of comparers,
+                 * one for the IP protocol and one for the destination port.
+                 * The comparers take the first byte at the offset as the least
+                 * significant, hence the byte swapping here.
+                 */
+                filter_no = flow_find_free(this_mac->flow_type_2_used, t2_limit);
+                index_a = flow_find_free(this_mac->flow_compare_used, compare_limit);
+                if (INVALID_INDEX != index_a)
+                {
+                    index_b = flow_find_free(this_mac->flow_compare_used | (1UL << index_a),
+                                             compare_limit);
+                }
+
+                if ((INVALID_INDEX != filter_no) && (INVALID_INDEX != index_b))
+                {
+                    (void)memset(&compare, 0, sizeof(mss_mac_type_2_compare_t));
+                    compare.data = 0x0600U; /* TTL, protocol == 6 */
+                    compare.mask = 0xFF00U;
+                    compare.compare_offset = MSS_MAC_T2_OFFSET_IP;
+                    compare.offset_value = 8U;
+                    MSS_MAC_set_type_2_compare(this_mac, index_a, &compare);
+
+                    compare.data = (uint32_t)(((uint32_t)rule->value >> 8) |
+                                              (((uint32_t)rule->value & 0xFFU) << 8));
+                    compare.mask = 0xFFFFU;
+                    compare.compare_offset = MSS_MAC_T2_OFFSET_TCP_UDP;
+                    compare.offset_value = 2U; /* Destination port */
+                    MSS_MAC_set_type_2_compare(this_mac, index_b, &compare);
+
+                    t2_filter.compare_a_enable = 1U;
+                    t2_filter.compare_a_index = (uint8_t)index_a;
+                    t2_filter.compare_b_enable = 1U;
+                    t2_filter.compare_b_index = (uint8_t)index_b;
+                    MSS_MAC_set_type_2_filter(this_mac, filter_no, &t2_filter);
+
+                    this_mac->flow_compare_used |= (1UL << index_a) | (1UL << index_b);
+                    this_mac->flow_type_2_used |= 1UL << filter_no;
+                    status = MSS_MAC_SUCCESS;
+                }
+                break;
+
+            case MSS_MAC_FLOW_ETHERTYPE:
+                filter_no = flow_find_free(this_mac->flow_type_2_used, t2_limit);
+                index_a = flow_find_free(this_mac->flow_ethertype_used, MSS_MAC_TYPE_2_ETHERTYPES);
+                if ((0U == this_mac->is_emac) && /* Ethertype filter not supported on eMAC */
+                    (INVALID_INDEX != filter_no) && (INVALID_INDEX != index_a))
+                {
+                    MSS_MAC_set_type_2_ethertype(this_mac, index_a, rule->value);
+
+                    t2_filter.ethertype_enable = 1U;
+                    t2_filter.ethertype_index = (uint8_t)index_a;
+                    MSS_MAC_set_type_2_filter(this_mac, filter_no, &t2_filter);
+
+                    this_mac->flow_ethertype_used |= 1UL << index_a;
+                    this_mac->flow_type_2_used |= 1UL << filter_no;
+                    status = MSS_MAC_SUCCESS;
+                }
+                break;
+
+            case MSS_MAC_FLOW_VLAN_PRIORITY:
+                filter_no = flow_find_free(this_mac->flow_type_2_used, t2_limit);
+                if ((INVALID_INDEX != filter_no) && (rule->value < 8U))
+                {
+                    t2_filter.vlan_priority_enable = 1U;
+                    t2_filter.vlan_priority = (uint8_t)rule->value;
+                    MSS_MAC_set_type_2_filter(this_mac, filter_no, &t2_filter);
+
+                    this_mac->flow_type_2_used |= 1UL << filter_no;
+                    status = MSS_MAC_SUCCESS;
+                }
+                break;
+
+            default:
+                /* Unknown rule type */
+                break;
+        }
+    }
+
+    return (status);
+}
+
+/******************************************************************************
+ * See mss_ethernet_mac.h for details of how to use this function.
+ */
+
+void
+MSS_MAC_clear_flow_rules(mss_mac_instance_t *this_mac)
+{
+    uint32_t index;
+    mss_mac_type_1_filter_t t1_filter;
+    mss_mac_type_2_filter_t t2_filter;
+    mss_mac_type_2_compare_t compare;
+
+    if (MSS_MAC_AVAILABLE == this_mac->mac_available)
+    {
+        (void)memset(&t1_filter, 0, sizeof(mss_mac_type_1_filter_t));
+        (void)memset(&t2_filter, 0, sizeof(mss_mac_type_2_filter_t));
+        (void)memset(&compare, 0, sizeof(mss_mac_type_2_compare_t));
+
+        /* Filters first so nothing is left pointing at a cleared comparer */
+        for (index = 0U; index < 32U; index++)
+        {
+            if (0U != (this_mac->flow_type_1_used & (1UL << index)))
+            {
+                MSS_MAC_set_type_1_filter(this_mac, index, &t1_filter);
+            }
+
+            if (0U != (this_mac->flow_type_2_used & (1UL << index)))
+            {
+                MSS_MAC_set_type_2_filter(this_mac, index, &t2_filter);
+            }
+        }
+
+        for (index = 0U; index < 32U; index++)
+        {
+            if (0U != (this_mac->flow_ethertype_used & (1UL << index)))
+            {
+                MSS_MAC_set_type_2_ethertype(this_mac, index, 0U);
+            }
+
+            if (0U != (this_mac->flow_compare_used & (1UL << index)))
+            {
+                MSS_MAC_set_type_2_compare(this_mac, index, &compare);
+            }
+        }
+
+        this_mac->flow_type_1_used = 0U;
+        this_mac->flow_type_2_used = 0U;
+        this_mac->flow_ethertype_used = 0U;
+        this_mac->flow_compare_used = 0U;
+    }
+}
+
+/******************************************************************************
+ * See mss_ethernet_mac.h for details of how to use this function.
+ */
+
+void
+MSS_MAC_set_queue_irq_hart(mss_mac_instance_t *this_mac, uint32_t queue_no, uint32_t hart_id)
+{
+    volatile uint32_t *p_enables;
+    uint32_t irq_bit;
+    uint32_t irq_reg;
+    uint32_t hart;
+    uint32_t was_enabled = 0U;
+
+    if ((MSS_MAC_AVAILABLE == this_mac->mac_available) && (0U == this_mac->use_local_ints) &&
+        (queue_no < MSS_MAC_QUEUE_COUNT) &&
+        ((MSS_MAC_IRQ_HART_LOCAL == hart_id) || (hart_id < MAC_PLIC_HART_COUNT)))
+    {
+        irq_reg = (uint32_t)this_mac->mac_q_int[queue_no] / 32U;
+        irq_bit = 1UL << ((uint32_t)this_mac->mac_q_int[queue_no] % 32U);
+
+        /* Take the interrupt away from every hart, noting if it was live */
+        for (hart = 0U; hart < MAC_PLIC_HART_COUNT; hart++)
+        {
+            p_enables = plic_hart_enables(hart);
+            if (0U != (p_enables[irq_reg] & irq_bit))
+            {
+                was_enabled = 1U;
+                p_enables[irq_reg] &= ~irq_bit;
+            }
+        }
+
+        this_mac->queue[queue_no].irq_hart = hart_id;
+
+        if (0U != was_enabled)
+        {
+            mac_q_plic_enable(this_mac, queue_no);
+        }
+    }
+}
+
 /******************************************************************************
  * See mss_ethernet_mac.h for details of how to use this function.
  */
@@ -5138,15 +6164,25 @@ MSS_MAC_get_pause_frame_copy_to_mem(const mss_mac_instance_t *this_mac)
  * descriptor that received the packet and caused the interrupt.
  * This informs the received packet size to the application and
  * relinquishes the packet buffer from the associated DMA descriptor.
+ *
+ * At most budget packets are processed and the number actually processed is
+ * returned.
  */
-static void
-rxpkt_handler(mss_mac_instance_t *this_mac, uint64_t queue_no)
+static uint32_t
+rxpkt_handler(mss_mac_instance_t *this_mac, uint64_t queue_no, uint32_t budget)
 {
     mss_mac_queue_t *this_queue = &this_mac->queue[queue_no];
     mss_mac_rx_desc_t *cdesc = &this_queue->rx_desc_tab[this_queue->first_rx_desc_index];
-    uint64_t burst = MSS_MAC_RX_RING_SIZE;
+    uint32_t burst = budget;
 
-    if (0U != (cdesc->addr_low & GEM_RX_DMA_USED)) /* Check in case we already got it... */
+    /*
+     * Only descriptors which have a buffer assigned are candidates. If the
+     * application is holding on to buffers, the descriptors it has not yet
+     * refilled still have the used bit set from the last frame they received.
+     */
+    if ((0U != (cdesc->addr_low & GEM_RX_DMA_USED)) &&
+        (this_queue->nb_available_rx_desc < MSS_MAC_RX_RING_SIZE) &&
+        (0U != burst)) /* Check in case we already got it... */
     {
         /* Execution comes here because at-least one packet is received. */
         do
@@ -5183,6 +6219,8 @@ rxpkt_handler(mss_mac_instance_t *this_mac, uint64_t queue_no)
                 pckt_length = cdesc->status & (GEM_RX_DMA_BUFF_LEN | GEM_RX_DMA_JUMBO_BIT_13);
                 this_queue->ingress += pckt_length;
 
+                /* Drop any lines speculatively fetched while the DMA was writing */
+                MSS_MAC_CACHE_INVALIDATE(p_rx_packet, pckt_length);
                 this_queue->pckt_rx_callback(
                     this_mac,
                     queue_no,
@@ -5216,6 +6254,7 @@ rxpkt_handler(mss_mac_instance_t *this_mac, uint64_t queue_no)
             cdesc = &this_queue->rx_desc_tab[this_queue->first_rx_desc_index];
             burst--;
         } while (0 != (cdesc->addr_low & GEM_RX_DMA_USED) &&
+                 (this_queue->nb_available_rx_desc < MSS_MAC_RX_RING_SIZE) &&
                  (0 != burst)); /* loop while there are packets available */
     }
 
@@ -5223,6 +6262,127 @@ rxpkt_handler(mss_mac_instance_t *this_mac, uint64_t queue_no)
     {
         this_mac->mac_base->NETWORK_CONTROL |= GEM_ENABLE_RECEIVE;
     }
+
+    return (budget - burst);
+}
+
+/******************************************************************************
+ * Receive poll mode equivalent of calling rxpkt_handler() from the ISR. Masks
+ * the receive interrupts for the queue and asks the application to schedule a
+ * call to MSS_MAC_rx_poll().
+ */
+static void
+rx_poll_schedule(mss_mac_instance_t *this_mac, uint64_t queue_no)
+{
+    mss_mac_queue_t *this_queue = &this_mac->queue[queue_no];
+
+    *this_queue->int_disable = GEM_RECEIVE_COMPLETE | GEM_RX_USED_BIT_READ;
+    if (0U == this_queue->rx_poll_scheduled)
+    {
+        this_queue->rx_poll_scheduled = 1U;
+        this_queue->rx_poll_callback(this_mac, (uint32_t)queue_no);
+    }
+}
+
+/******************************************************************************
+ * Returns the lowest numbered resource not marked in the used bit mask or
+ * INVALID_INDEX if all limit of them are in use.
+ */
+static uint32_t
+flow_find_free(uint32_t used, uint32_t limit)
+{
+    uint32_t index;
+    uint32_t found = INVALID_INDEX;
+
+    for (index = 0U; (index < limit) && (index < 32U) && (INVALID_INDEX == found); index++)
+    {
+        if (0U == (used & (1UL << index)))
+        {
+            found = index;
+        }
+    }
+
+    return (found);
+}
+
+/******************************************************************************
+ * Returns the machine mode PLIC interrupt enable registers for a hart or NULL
+ * if the hart is not valid.
+ */
+static volatile uint32_t *
+plic_hart_enables(uint32_t hart_id)
+{
+    volatile uint32_t *p_enables;
+
+    switch (hart_id)
+    {
+        case 0U:
+            p_enables = PLIC->HART0_MMODE_ENA;
+            break;
+
+        case 1U:
+            p_enables = PLIC->HART1_MMODE_ENA;
+            break;
+
+        case 2U:
+            p_enables = PLIC->HART2_MMODE_ENA;
+            break;
+
+        case 3U:
+            p_enables = PLIC->HART3_MMODE_ENA;
+            break;
+
+        case 4U:
+            p_enables = PLIC->HART4_MMODE_ENA;
+            break;
+
+        default:
+            p_enables = (volatile uint32_t *)NULL_POINTER;
+            break;
+    }
+
+    return (p_enables);
+}
+
+/******************************************************************************
+ * Enable the PLIC interrupt for a queue, on the hart it has been routed to with
+ * MSS_MAC_set_queue_irq_hart() or otherwise on the calling hart.
+ */
+static void
+mac_q_plic_enable(const mss_mac_instance_t *this_mac, uint32_t queue_no)
+{
+    volatile uint32_t *p_enables;
+    uint32_t irq = (uint32_t)this_mac->mac_q_int[queue_no];
+
+    p_enables = plic_hart_enables(this_mac->queue[queue_no].irq_hart);
+    if (NULL_POINTER == p_enables)
+    {
+        PLIC_EnableIRQ(this_mac->mac_q_int[queue_no]);
+    }
+    else
+    {
+        p_enables[irq / 32U] |= 1UL << (irq % 32U);
+    }
+}
+
+/******************************************************************************
+ * Disable the PLIC interrupt for a queue, see mac_q_plic_enable().
+ */
+static void
+mac_q_plic_disable(const mss_mac_instance_t *this_mac, uint32_t queue_no)
+{
+    volatile uint32_t *p_enables;
+    uint32_t irq = (uint32_t)this_mac->mac_q_int[queue_no];
+
+    p_enables = plic_hart_enables(this_mac->queue[queue_no].irq_hart);
+    if (NULL_POINTER == p_enables)
+    {
+        PLIC_DisableIRQ(this_mac->mac_q_int[queue_no]);
+    }
+    else
+    {
+        p_enables[irq / 32U] &= ~(1UL << (irq % 32U));
+    }
 }
 
 /******************************************************************************
@@ -5234,52 +6394,196 @@ rxpkt_handler(mss_mac_instance_t *this_mac, uint64_t queue_no)
 static void
 txpkt_handler(mss_mac_instance_t *this_mac, uint64_t queue_no)
 {
+    if (0U != this_mac->queue[queue_no].tx_ring_mode)
+    {
+        tx_ring_reclaim(this_mac, (uint32_t)queue_no);
+    }
+    else
+    {
 #if defined(MSS_MAC_SIMPLE_TX_QUEUE)
-    mss_mac_queue_t *this_queue = &this_mac->queue[queue_no];
-    mss_mac_tx_desc_t *p_current_desc;
-    uint32_t finished;
+        mss_mac_queue_t *this_queue = &this_mac->queue[queue_no];
+        mss_mac_tx_desc_t *p_current_desc;
+        uint32_t finished;
 
-    /*
-     * Simple multi packet TX queue where only the one packet buffer is used
-     * per frame but we do have 1 extra descriptor to stop DMA engine running
-     * over itself...
-     */
+        /*
+         * Simple multi packet TX queue where only the one packet buffer is used
+         * per frame but we do have 1 extra descriptor to stop DMA engine running
+         * over itself...
+         */
 
-    p_current_desc = &this_queue->tx_desc_tab[this_queue->current_tx_desc];
-    finished = 0;
-    while (!finished)
-    {
-        if (this_queue->nb_available_tx_desc == MSS_MAC_TX_RING_SIZE)
-        {
-            *this_queue->transmit_q_ptr =
-                (uint32_t)((uint64_t)this_queue->tx_desc_tab) | 1UL; /* Disable the TX queue */
-            finished = 1;
-        }
-        else
+        p_current_desc = &this_queue->tx_desc_tab[this_queue->current_tx_desc];
+        finished = 0;
+        while (!finished)
         {
-            if (p_current_desc->status & GEM_TX_DMA_USED)
+            if (this_queue->nb_available_tx_desc == MSS_MAC_TX_RING_SIZE)
             {
-                if (NULL_POINTER != this_queue->pckt_tx_callback)
-                {
-                    this_queue->pckt_tx_callback(
-                        this_mac,
-                        queue_no,
-                        p_current_desc,
-                        this_queue->tx_caller_info[this_queue->current_tx_desc]);
-                }
-                this_queue->nb_available_tx_desc++;
-                p_current_desc++;
-                this_queue->current_tx_desc++;
+                *this_queue->transmit_q_ptr =
+                    (uint32_t)((uint64_t)this_queue->tx_desc_tab) | 1UL; /* Disable the TX queue */
+                finished = 1;
             }
             else
             {
-                finished = 1;
+                if (p_current_desc->status & GEM_TX_DMA_USED)
+                {
+                    if (NULL_POINTER != this_queue->pckt_tx_callback)
+                    {
+                        this_queue->pckt_tx_callback(
+                            this_mac,
+                            queue_no,
+                            p_current_desc,
+                            this_queue->tx_caller_info[this_queue->current_tx_desc]);
+                    }
+                    this_queue->nb_available_tx_desc++;
+                    p_current_desc++;
+                    this_queue->current_tx_desc++;
+                }
+                else
+                {
+                    finished = 1;
+                }
             }
         }
-    }
 #else
 #error "Multi packet TX not implemented!"
 #endif
+    }
+}
+
+/******************************************************************************
+ * Switches a queue over to the ring mode transmit scheme used by
+ * MSS_MAC_send_pkt_sg(). Must be called with the queue interrupt disabled and
+ * no transmit outstanding on the queue.
+ */
+static void
+tx_ring_start(mss_mac_instance_t *this_mac, uint32_t queue_no)
+{
+    mss_mac_queue_t *p_queue = &this_mac->queue[queue_no];
+    volatile uint32_t *p_nw_control;
+    volatile uint32_t *p_tx_status;
+    volatile int delay = 0;
+    uint32_t inc;
+
+    if (0U != this_mac->is_emac)
+    {
+        p_nw_control = &this_mac->emac_base->NETWORK_CONTROL;
+        p_tx_status = &this_mac->emac_base->TRANSMIT_STATUS;
+    }
+    else
+    {
+        p_nw_control = &this_mac->mac_base->NETWORK_CONTROL;
+        p_tx_status = &this_mac->mac_base->TRANSMIT_STATUS;
+    }
+
+    /* Make sure transmit is enabled */
+    if (0 == (*p_nw_control & GEM_ENABLE_TRANSMIT))
+    {
+        *p_nw_control = *p_nw_control | GEM_ENABLE_TRANSMIT;
+    }
+
+    /*
+     * Wait for pending transmits to complete as you cannot alter
+     * tx queue pointers while transmit is active...
+     */
+    while (0 != (*p_tx_status & GEM_TRANSMIT_GO))
+    {
+        delay++; /* Empty loop will cause debug issues... */
+    }
+
+    for (inc = 0U; inc < MSS_MAC_TX_RING_SIZE; ++inc)
+    {
+        p_queue->tx_desc_tab[inc].status = GEM_TX_DMA_USED;
+        p_queue->tx_caller_info[inc] = NULL_POINTER;
+    }
+
+    p_queue->tx_desc_tab[MSS_MAC_TX_RING_SIZE - 1U].status |= GEM_TX_DMA_WRAP;
+
+    p_queue->nb_available_tx_desc = MSS_MAC_TX_RING_SIZE;
+    p_queue->current_tx_desc = 0U;
+    p_queue->next_free_tx_desc_index = 0U;
+    p_queue->tries = 0UL;
+    p_queue->tx_ring_mode = 1U;
+
+    *p_queue->transmit_q_ptr = (uint32_t)((uint64_t)p_queue->tx_desc_tab);
+    /*
+     * If not queue 0 then we need to write disabled value to queue 0 to get
+     * the DMA engine reloaded, as long as queue 0 is not busy itself...
+     */
+    if ((0U != queue_no) && (0U == this_mac->queue[0].tx_ring_mode) &&
+        (this_mac->queue[0].nb_available_tx_desc == (uint32_t)MSS_MAC_TX_RING_SIZE))
+    {
+        *this_mac->queue[0].transmit_q_ptr =
+            (uint32_t)((uint64_t)this_mac->queue[0].tx_desc_tab) | 1U;
+    }
+}
+
+/******************************************************************************
+ * Ring mode transmit completion handler. Releases every packet the GEM has
+ * finished with since the last call and calls the transmit callback for each
+ * one.
+ *
+ * The GEM only sets the USED bit in the first descriptor of a packet so we
+ * walk forward to the descriptor marked LAST to find the end of each packet.
+ */
+static void
+tx_ring_reclaim(mss_mac_instance_t *this_mac, uint32_t queue_no)
+{
+    mss_mac_queue_t *p_queue = &this_mac->queue[queue_no];
+    mss_mac_tx_desc_t *p_first_desc;
+    volatile uint32_t *p_nw_control;
+    volatile uint32_t *p_tx_status;
+    uint32_t first;
+    uint32_t index;
+    uint32_t count;
+    uint32_t in_flight;
+    uint32_t last;
+
+    if (0U != this_mac->is_emac)
+    {
+        p_nw_control = &this_mac->emac_base->NETWORK_CONTROL;
+        p_tx_status = &this_mac->emac_base->TRANSMIT_STATUS;
+    }
+    else
+    {
+        p_nw_control = &this_mac->mac_base->NETWORK_CONTROL;
+        p_tx_status = &this_mac->mac_base->TRANSMIT_STATUS;
+    }
+
+    while ((p_queue->nb_available_tx_desc < (uint32_t)MSS_MAC_TX_RING_SIZE) &&
+           (0U != (p_queue->tx_desc_tab[p_queue->current_tx_desc].status & GEM_TX_DMA_USED)))
+    {
+        first = p_queue->current_tx_desc;
+        p_first_desc = &p_queue->tx_desc_tab[first];
+        in_flight = MSS_MAC_TX_RING_SIZE - p_queue->nb_available_tx_desc;
+        index = first;
+        count = 0U;
+        do
+        {
+            last = p_queue->tx_desc_tab[index].status & GEM_TX_DMA_LAST;
+            index = (index + 1U) % MSS_MAC_TX_RING_SIZE;
+            count++;
+        } while ((0U == last) && (count < in_flight));
+
+        if (NULL_POINTER != p_queue->pckt_tx_callback)
+        {
+            p_queue->pckt_tx_callback(this_mac, queue_no, p_first_desc,
+                                      p_queue->tx_caller_info[first]);
+        }
+
+        p_queue->tx_caller_info[first] = NULL_POINTER;
+        p_queue->nb_available_tx_desc += count;
+        p_queue->current_tx_desc = index;
+    }
+
+    /*
+     * A packet may have been added just as the DMA engine read the old stop
+     * descriptor, in which case it halted with work still queued.
+     */
+    if ((p_queue->nb_available_tx_desc < (uint32_t)MSS_MAC_TX_RING_SIZE) &&
+        (0U == (*p_tx_status & GEM_TRANSMIT_GO)))
+    {
+        p_queue->tx_restart++;
+        *p_nw_control = *p_nw_control | GEM_TRANSMIT_START;
+    }
 }
 
 /******************************************************************************
@@ -5294,8 +6598,8 @@ tx_desc_ring_init(mss_mac_instance_t *this_mac)
     for (queue_no = 0; queue_no < MSS_MAC_QUEUE_COUNT; queue_no++)
     {
 #if defined(MSS_MAC_USE_DDR)
-        this_mac->queue[queue_no].tx_desc_tab = g_mss_mac_ddr_ptr;
-        g_mss_mac_ddr_ptr += MSS_MAC_TX_RING_SIZE * sizeof(mss_mac_tx_desc_t);
+        this_mac->queue[queue_no].tx_desc_tab = (mss_mac_tx_desc_t *)(MSS_MAC_alloc_dma_mem(
+            MSS_MAC_TX_RING_SIZE * sizeof(mss_mac_tx_desc_t)) + MSS_MAC_NON_CACHED_OFFSET);
 #endif
         for (inc = 0; inc < MSS_MAC_TX_RING_SIZE; ++inc)
         {
@@ -5323,8 +6627,8 @@ rx_desc_ring_init(mss_mac_instance_t *this_mac)
     for (queue_no = 0; queue_no < MSS_MAC_QUEUE_COUNT; queue_no++)
     {
 #if defined(MSS_MAC_USE_DDR)
-        this_mac->queue[queue_no].rx_desc_tab = g_mss_mac_ddr_ptr;
-        g_mss_mac_ddr_ptr += MSS_MAC_RX_RING_SIZE * sizeof(mss_mac_rx_desc_t);
+        this_mac->queue[queue_no].rx_desc_tab = (mss_mac_rx_desc_t *)(MSS_MAC_alloc_dma_mem(
+            MSS_MAC_RX_RING_SIZE * sizeof(mss_mac_rx_desc_t)) + MSS_MAC_NON_CACHED_OFFSET);
 #endif
 
         for (inc = 0U; inc < MSS_MAC_RX_RING_SIZE; ++inc)
@@ -143,6 +143,16 @@
     configuration process:
         - _MSS_MAC_cfg_struct_def_init()_
         - _MSS_MAC_init()_
+        - _MSS_MAC_alloc_dma_mem()_
+
+    By default the descriptor rings are part of the driver instance data. When
+    _MSS_MAC_USE_DDR_ is defined in _mss_ethernet_mac_sw_cfg.h_ they are
+    allocated instead from the memory region it selects, which may be non-cached
+    DDR, one of the FIC regions, the L2 scratchpad or cached DDR. The
+    application can allocate its packet buffers from the same region with
+    _MSS_MAC_alloc_dma_mem()_. All allocations are aligned to
+    _MSS_MAC_CACHE_LINE_SIZE_. With cached DDR the driver flushes transmit
+    buffers and invalidates receive buffers around each DMA transfer.
         
     @subsection tx_ops Transmit Operations
     The MSS Ethernet MAC driver transmit operations are interrupt driven. The
@@ -164,6 +174,8 @@
     The following functions are used as part of the transmit operations:
         - _MSS_MAC_send_pkt()_
         - _MSS_MAC_send_pkts()_
+        - _MSS_MAC_send_pkt_sg()_
+        - _MSS_MAC_send_pkts_stream()_
         - _MSS_MAC_set_tx_callback()_
         
     @subsection rx_ops Receive Operations
@@ -178,10 +190,24 @@
     for packet processing. This buffer will not be reused by the MSS Ethernet
     MAC driver unless it is re-allocated to the driver by a call to
     _MSS_MAC_receive_pkt()_.
+
+    Under sustained high packet rates, servicing every received packet from the
+    interrupt handler can starve the rest of the system. A queue can instead be
+    placed in receive poll mode with the _MSS_MAC_set_rx_poll_mode()_ function.
+    In this mode the first receive interrupt masks the queue's receive
+    interrupts and calls a user supplied function to schedule a poll. The
+    application then calls _MSS_MAC_rx_poll()_ from task or background context,
+    which delivers at most a fixed budget of packets to the receive call-back
+    per call. Receive interrupts are only re-enabled once a poll finds the
+    receive ring empty.
     
     The following functions are used as part of the receive operations:
         - _MSS_MAC_receive_pkt()_
+        - _MSS_MAC_receive_pkts()_
+        - _MSS_MAC_get_rx_csum_status()_
         - _MSS_MAC_set_rx_callback()_
+        - _MSS_MAC_set_rx_poll_mode()_
+        - _MSS_MAC_rx_poll()_
         
     @subsection stats Reading Status and Statistics
     The MSS Ethernet MAC driver provides the following functions to retrieve the
@@ -223,6 +249,9 @@
         - _MSS_MAC_get_type_2_ethertype()_
         - _MSS_MAC_set_type_2_compare()_
         - _MSS_MAC_get_type_2_compare()_
+        - _MSS_MAC_add_flow_rule()_
+        - _MSS_MAC_clear_flow_rules()_
+        - _MSS_MAC_set_queue_irq_hart()_
         - _MSS_MAC_set_mmsl_mode()_
         - _MSS_MAC_get_mmsl_mode()_
         - _MSS_MAC_start_preemption_verify()_
@@ -312,8 +341,10 @@ extern "C" {
  *
  */
 #if defined(MSS_MAC_USE_DDR)
-#if MSS_MAC_USE_DDR == MSS_MAC_MEM_DDR
+#if (MSS_MAC_USE_DDR == MSS_MAC_MEM_DDR) || (MSS_MAC_USE_DDR == MSS_MAC_MEM_CACHED_DDR)
 #define MSS_MAC_MAX_PACKET_SIZE                 MSS_MAC_JUMBO_MAX /* Smaller for Crypto and FIC tests */
+#elif MSS_MAC_USE_DDR == MSS_MAC_MEM_SCRATCHPAD
+#define MSS_MAC_MAX_PACKET_SIZE                 (1536U) /* Scratchpad is too small for jumbo buffers */
 #else
 #define MSS_MAC_MAX_PACKET_SIZE                 (80U)
 #endif
@@ -488,6 +519,23 @@ extern mss_mac_instance_t g_mac0;
 extern uint8_t *g_mss_mac_ddr_ptr;
 #endif
 
+/* Cache maintenance hooks, no-ops unless the rings are in cached DDR */
+#if defined(MSS_MAC_USE_DDR) && (MSS_MAC_USE_DDR == MSS_MAC_MEM_CACHED_DDR)
+#if !defined(MSS_MAC_CACHE_FLUSH)
+#define MSS_MAC_CACHE_FLUSH(addr, length)       MSS_MAC_l2_flush((addr), (length))
+#endif
+#if !defined(MSS_MAC_CACHE_INVALIDATE)
+#define MSS_MAC_CACHE_INVALIDATE(addr, length)  MSS_MAC_l2_flush((addr), (length))
+#endif
+#else
+#if !defined(MSS_MAC_CACHE_FLUSH)
+#define MSS_MAC_CACHE_FLUSH(addr, length)
+#endif
+#if !defined(MSS_MAC_CACHE_INVALIDATE)
+#define MSS_MAC_CACHE_INVALIDATE(addr, length)
+#endif
+#endif
+
 /***************************************************************************//**
  * Specific Address Filter support definitions.
  *
@@ -514,6 +562,13 @@ extern uint8_t *g_mss_mac_ddr_ptr;
 #define MSS_MAC_T2_OFFSET_IP         (2U)
 #define MSS_MAC_T2_OFFSET_TCP_UDP    (3U)
 
+/***************************************************************************//**
+ * Value for the _hart_id_ parameter of _MSS_MAC_set_queue_irq_hart()_ which
+ * restores the default behaviour of enabling the queue interrupt on whichever
+ * hart calls the driver.
+ */
+#define MSS_MAC_IRQ_HART_LOCAL       (0xFFFFFFFFUL)
+
 
 /**************************************************************************/
 /* Public Function declarations                                           */
@@ -630,6 +685,72 @@ MSS_MAC_init
     mss_mac_cfg_t * cfg
 );
 
+#if defined(MSS_MAC_USE_DDR)
+/***************************************************************************//**
+  The _MSS_MAC_alloc_dma_mem()_ function allocates memory for use by the GEM DMA
+  from the region selected by _MSS_MAC_USE_DDR_. The driver allocates its
+  descriptor rings from the same region when _MSS_MAC_init()_ is called. The
+  memory is never freed.
+
+  The allocation is aligned to _MSS_MAC_CACHE_LINE_SIZE_ so that packet buffers
+  never share a cache line with the descriptor rings or with each other.
+
+  This function is only available when _MSS_MAC_USE_DDR_ is defined.
+
+  @param size
+    The number of bytes to allocate.
+
+  @return
+    This function returns a pointer to the start of the allocated memory.
+
+  Example:
+  @code
+    uint8_t *rx_buffers;
+
+    MSS_MAC_init(&g_mac0, &cfg);
+    rx_buffers = MSS_MAC_alloc_dma_mem(MSS_MAC_RX_RING_SIZE *
+                                       MSS_MAC_MAX_RX_BUF_SIZE);
+  @endcode
+ */
+uint8_t *
+MSS_MAC_alloc_dma_mem
+(
+    uint32_t size
+);
+#endif
+
+#if defined(MSS_MAC_USE_DDR) && (MSS_MAC_USE_DDR == MSS_MAC_MEM_CACHED_DDR)
+/***************************************************************************//**
+  The _MSS_MAC_l2_flush()_ function writes back and invalidates the L2 cache
+  lines covering a buffer. The L2 cache is inclusive so the L1 data caches are
+  also cleaned. It is the default implementation of both _MSS_MAC_CACHE_FLUSH()_
+  and _MSS_MAC_CACHE_INVALIDATE()_ when _MSS_MAC_USE_DDR_ is set to
+  _MSS_MAC_MEM_CACHED_DDR_.
+
+  The driver calls these hooks itself for each transmit and receive buffer, so
+  an application only needs them for buffers it shares with the GEM DMA in
+  other ways.
+
+  This function is only available when _MSS_MAC_USE_DDR_ is set to
+  _MSS_MAC_MEM_CACHED_DDR_.
+
+  @param p_addr
+    The address of the start of the buffer. This does not need to be aligned.
+
+  @param length
+    The length of the buffer in bytes.
+
+  @return
+    This function does not return a value.
+ */
+void
+MSS_MAC_l2_flush
+(
+    const volatile void *p_addr,
+    uint32_t length
+);
+#endif
+
 /***************************************************************************//**
   The _MSS_MAC_update_hw_address()_ function updates the MAC address for the
   Ethernet MAC. In addition to the MAC identifier, the
@@ -791,6 +912,109 @@ void MSS_MAC_set_rx_callback
     mss_mac_receive_callback_t rx_callback
 );
 
+/***************************************************************************//**
+  The _MSS_MAC_set_rx_poll_mode()_ function selects between interrupt driven
+  and polled packet reception for a queue.
+
+  When a poll callback is registered, the queue interrupt handler no longer
+  processes received packets itself. Instead, on the first receive interrupt,
+  it masks the receive complete and receive used bit read interrupts for the
+  queue and calls the poll callback. The application must then arrange for
+  _MSS_MAC_rx_poll()_ to be called until the receive ring has been drained.
+
+  @param this_mac
+    This parameter is a pointer to one of the global _mss_mac_instance_t_
+    structures which identifies the MAC that the function is to operate on.
+    There are between 1 and 4 such structures identifying pMAC0, eMAC0, pMAC1
+    and eMAC1.
+
+  @param queue_no
+    This parameter identifies the queue to configure. For single queue devices
+    this should be set to 0 for compatibility purposes.
+
+  @param poll_callback
+    This parameter is a pointer to the function that will be called from the
+    interrupt handler to schedule a poll. Passing NULL returns the queue to
+    interrupt driven reception.
+
+  @param budget
+    This parameter is the maximum number of packets delivered to the receive
+    call-back by one call to _MSS_MAC_rx_poll()_. A value of 0 selects
+    _MSS_MAC_RX_RING_SIZE_.
+
+  @return
+    This function does not return a value.
+
+  Example:
+  @code
+    static TaskHandle_t rx_task_handle;
+
+    void rx_poll_sched(void *this_mac, uint32_t queue_no)
+    {
+        vTaskNotifyGiveFromISR(rx_task_handle, NULL);
+    }
+
+    void rx_task(void *pvParameters)
+    {
+        for(;;)
+        {
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+            while(16U == MSS_MAC_rx_poll(&g_mac0, 0))
+            {
+                taskYIELD();
+            }
+        }
+    }
+
+    void init(void)
+    {
+        MSS_MAC_set_rx_callback(&g_mac0, 0, rx_callback);
+        MSS_MAC_set_rx_poll_mode(&g_mac0, 0, rx_poll_sched, 16U);
+    }
+  @endcode
+ */
+void MSS_MAC_set_rx_poll_mode
+(
+    mss_mac_instance_t *this_mac,
+    uint32_t queue_no,
+    mss_mac_rx_poll_callback_t poll_callback,
+    uint32_t budget
+);
+
+/***************************************************************************//**
+  The _MSS_MAC_rx_poll()_ function processes packets received on a queue
+  operating in receive poll mode.
+
+  Up to the budget set with _MSS_MAC_set_rx_poll_mode()_ of received packets
+  are passed to the receive call-back, in the same way as from the interrupt
+  handler. If fewer packets than the budget were found, the receive ring is
+  empty and the receive interrupts for the queue are re-enabled. If a packet
+  arrives while the interrupts are being re-enabled, they are masked again and
+  the poll callback is called once more.
+
+  The per queue _rx_polls_, _rx_poll_exhausted_ and _rx_poll_rearms_ counters
+  in the _mss_mac_queue_t_ structure record the number of calls to this
+  function, the number of calls which used the whole budget and the number of
+  times interrupts were re-enabled.
+
+  @param this_mac
+    This parameter is a pointer to one of the global _mss_mac_instance_t_
+    structures which identifies the MAC that the function is to operate on.
+
+  @param queue_no
+    This parameter identifies the queue to poll.
+
+  @return
+    This function returns the number of packets processed. If this is equal to
+    the budget there may be more packets waiting and the function should be
+    called again.
+ */
+uint32_t MSS_MAC_rx_poll
+(
+    mss_mac_instance_t *this_mac,
+    uint32_t queue_no
+);
+
 /***************************************************************************//**
   The _MSS_MAC_change_speed()_ function sets the speed and duplex mode for the
   link and if autonegotiation is selected as the speed mode, also sets the speed
@@ -1040,9 +1264,176 @@ MSS_MAC_send_pkts
     mss_mac_tx_pkt_info_t *p_packets
 );
 
+/***************************************************************************//**
+  The _MSS_MAC_send_pkt_sg()_ function adds a packet made up of one or more
+  separate buffers to the transmit ring of a queue. Each buffer is assigned its
+  own transmit descriptor and only the descriptor for the last buffer is marked
+  as the end of the packet.
+
+  Unlike _MSS_MAC_send_pkt()_, this function does not wait for earlier packets
+  to be sent before adding another. The first call switches the queue over to
+  ring mode, once any outstanding _MSS_MAC_send_pkt()_ style transmit on the
+  queue has completed. From then on, _MSS_MAC_send_pkt()_ calls for the same
+  queue are treated as single buffer calls to this function. _MSS_MAC_send_pkts()_
+  must not be used on a queue which is in ring mode.
+
+  One descriptor is always kept back to halt the DMA engine at the end of the
+  queued packets, so at most _MSS_MAC_TX_RING_SIZE_ - 1 descriptors can be in
+  flight on a queue at any time.
+
+  This function is non-blocking. It will return immediately without waiting for
+  the packet to be sent. The transmit completion handler registered by a call to
+  _MSS_MAC_set_tx_callback()_ is called once for each packet, with the
+  _p_user_data_ pointer passed to this function, when the GEM has finished with
+  all its buffers. Completed packets are released in batches from the transmit
+  complete interrupt, so the handler must only do what is safe in an interrupt
+  handler. Buffers which have to be released through an allocator that is not
+  interrupt safe, such as lwIP pbufs, should be passed to a task to free.
+
+  @param this_mac
+    This parameter is a pointer to one of the global _mss_mac_instance_t_
+    structures which identifies the MAC that the function is to operate on.
+    There are between 1 and 4 such structures identifying pMAC0, eMAC0, pMAC1
+    and eMAC1.
+
+  @param queue_no
+    This parameter identifies the queue to which this transmit operation
+    applies. For single queue devices this should be set to 0 for compatibility
+    purposes.
+
+  @param p_frags
+    This parameter is a pointer to an array of _mss_mac_tx_frag_t_ structures
+    describing the buffers that make up the packet, in order. The array only
+    needs to remain valid for the duration of the call but the buffers
+    themselves must not be modified until the transmit completion handler is
+    called for the packet. If bit 31 of the length of the first fragment is
+    set, the packet is sent without a CRC appended.
+
+  @param frag_count
+    This parameter is the number of entries in the _p_frags_ array. It must be
+    less than _MSS_MAC_TX_RING_SIZE_.
+
+  @param p_user_data
+    This parameter is intended to help the application manage memory. It is
+    passed back to the transmit completion handler for the packet.
+
+  @return
+    This function returns the following values:
+
+     - ___MSS_MAC_ERR_OK___ on successfully queuing the packet.
+     - ___MSS_MAC_ERR_NOT_DONE___ if there are not enough free descriptors, or
+          if the queue is still finishing a transmit started by
+          _MSS_MAC_send_pkt()_. The call can be retried once the transmit
+          completion handler has been called.
+
+  Example:
+  This example demonstrates the use of the _MSS_MAC_send_pkt_sg()_ function to
+  send a packet whose header and payload are held in separate buffers.
+
+  @code
+
+    int32_t send_split_packet(void)
+    {
+        mss_mac_tx_frag_t frags[2];
+
+        frags[0].tx_buffer = tx_header;
+        frags[0].length    = sizeof(tx_header);
+        frags[1].tx_buffer = tx_payload;
+        frags[1].length    = sizeof(tx_payload);
+
+        return(MSS_MAC_send_pkt_sg(g_test_mac, 0, frags, 2, (void *)0));
+    }
+
+  @endcode
+ */
+int32_t
+MSS_MAC_send_pkt_sg
+(
+    mss_mac_instance_t      *this_mac,
+    uint32_t                 queue_no,
+    mss_mac_tx_frag_t const *p_frags,
+    uint32_t                 frag_count,
+    void                    *p_user_data
+);
+
+/***************************************************************************//**
+  The _MSS_MAC_send_pkts_stream()_ function queues a batch of single buffer
+  packets for transmission on a queue operated as a continuous ring. It is
+  intended for sustained, line rate transmission from any queue of the pMAC or
+  the eMAC.
+
+  The queue is switched to the same ring mode used by _MSS_MAC_send_pkt_sg()_
+  and the two functions can be mixed freely on a queue. The transmit DMA is
+  never stopped or rewound. As long as the caller keeps adding packets ahead
+  of the GEM it transmits back to back without gaps. Descriptors are reclaimed
+  incrementally, both from the transmit complete interrupt and at the start of
+  each call to this function, and the transmit completion handler is called
+  once for each packet.
+
+  Up to _MSS_MAC_TX_RING_SIZE_ - 1 packets can be in flight on a queue. If
+  there is not room for all the packets, as many as will fit are queued, in
+  order, and the number queued is returned. The caller simply offers the rest
+  again on the next call.
+
+  @param this_mac
+    This parameter is a pointer to one of the global _mss_mac_instance_t_
+    structures which identifies the MAC that the function is to operate on.
+    There are between 1 and 4 such structures identifying pMAC0, eMAC0, pMAC1
+    and eMAC1.
+
+  @param queue_no
+    This parameter identifies the queue to which this transmit operation
+    applies. The _queue_no_ field of each packet is ignored.
+
+  @param p_packets
+    This parameter is a pointer to an array of _count_ _mss_mac_tx_pkt_info_t_
+    structures describing the packets to send. Unlike _MSS_MAC_send_pkts()_,
+    no terminating entry is needed. The packet buffers must not be modified
+    until the transmit completion handler is called for each packet. If bit 31
+    of the length of a packet is set, that packet is sent without a CRC
+    appended.
+
+  @param count
+    This parameter is the number of packets in the _p_packets_ array.
+
+  @return
+    This function returns the number of packets queued, starting with the
+    first in the array. This is 0 if the ring is full, or if the queue is
+    still finishing a transmit started by _MSS_MAC_send_pkt()_.
+
+  Example:
+  This example demonstrates the use of the _MSS_MAC_send_pkts_stream()_
+  function to keep a queue transmitting continuously.
+
+  @code
+
+    void blast(mss_mac_tx_pkt_info_t const *packets, uint32_t count)
+    {
+        uint32_t sent = 0U;
+
+        while(sent < count)
+        {
+            sent += MSS_MAC_send_pkts_stream(g_test_mac, 0, &packets[sent],
+                                             count - sent);
+        }
+    }
+
+  @endcode
+ */
+uint32_t
+MSS_MAC_send_pkts_stream
+(
+    mss_mac_instance_t          *this_mac,
+    uint32_t                     queue_no,
+    mss_mac_tx_pkt_info_t const *p_packets,
+    uint32_t                     count
+);
+
 #if defined(MSS_MAC_SPEED_TEST)
 /***************************************************************************//**
  * Non standard function for network saturation speed tests. Not for normal use.
+ * Superseded by _MSS_MAC_send_pkts_stream()_ which does not stop the transmit
+ * DMA between batches.
  */
 int32_t
 MSS_MAC_send_pkts_fast
@@ -1173,6 +1564,138 @@ MSS_MAC_receive_pkt
     mss_mac_rx_int_ctrl_t enable
 );
 
+/***************************************************************************//**
+  The _MSS_MAC_receive_pkts()_ function assigns a set of buffers to the
+  Ethernet MAC's receive descriptors in one operation. It is equivalent to a
+  series of calls to _MSS_MAC_receive_pkt()_ but the interrupt is only disabled
+  and re-enabled once, the descriptors are written in a single pass and the
+  network control register is only updated when needed. This makes it suitable
+  for priming the receive ring at start up and for refilling it after a burst
+  of packets has been processed.
+
+  Buffers are assigned in array order. If there are fewer free receive
+  descriptors than buffers, only as many buffers as there are free descriptors
+  are assigned.
+
+  @param this_mac
+    This parameter is a pointer to one of the global _mss_mac_instance_t_
+    structures which identifies the MAC that the function is to operate on.
+    There are between 1 and 4 such structures identifying pMAC0, eMAC0, pMAC1
+    and eMAC1.
+
+  @param queue_no
+    This parameter identifies the queue to which this receive operation
+    applies. For single queue devices this should be set to 0 for compatibility
+    purposes.
+
+  @param rx_pkt_buffers
+    This parameter is an array of _count_ pointers to memory buffers, each large
+    enough to contain the largest possible packet.
+
+  @param p_user_data
+    This parameter is an array of _count_ user data pointers which are passed
+    back to the receive callback function along with the matching buffer. It
+    may be NULL, in which case NULL is passed back for every buffer.
+
+  @param count
+    This parameter is the number of buffers to assign.
+
+  @param enable
+    This parameter controls the enabling of the Ethernet MAC interrupt and has
+    the same meaning as for _MSS_MAC_receive_pkt()_. Use _MSS_MAC_INT_ARM_ to
+    set up the receive ring for the first time, in which case the receiver is
+    stopped while the queue pointer is reloaded. Otherwise the network control
+    register is written at most once.
+
+  @return
+    This function returns the number of buffers assigned to receive
+    descriptors.
+
+  Example:
+  @code
+    uint8_t rx_buffers[MSS_MAC_RX_RING_SIZE][MSS_MAC_MAX_RX_BUF_SIZE];
+
+    void init(void)
+    {
+        uint8_t *p_buffers[MSS_MAC_RX_RING_SIZE];
+        uint32_t count;
+
+        for(count = 0U; count < MSS_MAC_RX_RING_SIZE; count++)
+        {
+            p_buffers[count] = rx_buffers[count];
+        }
+
+        MSS_MAC_set_rx_callback(&g_mac_0, 0, rx_callback);
+        MSS_MAC_receive_pkts(&g_mac_0, 0, p_buffers, NULL,
+                             MSS_MAC_RX_RING_SIZE, MSS_MAC_INT_ARM);
+    }
+  @endcode
+ */
+uint32_t
+MSS_MAC_receive_pkts
+(
+    mss_mac_instance_t *this_mac,
+    uint32_t queue_no,
+    uint8_t * const rx_pkt_buffers[],
+    void * const p_user_data[],
+    uint32_t count,
+    mss_mac_rx_int_ctrl_t enable
+);
+
+/***************************************************************************//**
+  The _MSS_MAC_get_rx_csum_status()_ function returns the result of the
+  receive checksum offload checks for a received packet. It is intended to be
+  called from the receive callback function with the descriptor pointer
+  passed to it, so that the application or network stack can skip checking
+  those checksums again in software.
+
+  @param this_mac
+    This parameter is a pointer to one of the global _mss_mac_instance_t_
+    structures which identifies the MAC that the function is to operate on.
+
+  @param cdesc
+    This parameter is the descriptor pointer passed to the receive callback
+    function.
+
+  @return
+    This function returns one of the _mss_mac_rx_csum_t_ values. If receive
+    checksum offload is not enabled it always returns
+    _MSS_MAC_RX_CSUM_NOT_CHECKED_.
+
+  Example:
+  @code
+    void rx_callback
+    (
+        void *this_mac,
+        uint32_t queue_no,
+        uint8_t * p_rx_packet,
+        uint32_t pckt_length,
+        mss_mac_rx_desc_t *cdesc,
+        void * caller_info
+    )
+    {
+        if(MSS_MAC_RX_CSUM_IP_TCP_OK ==
+           MSS_MAC_get_rx_csum_status((mss_mac_instance_t *)this_mac, cdesc))
+        {
+            process_tcp_packet_no_csum(p_rx_packet, pckt_length);
+        }
+        else
+        {
+            process_rx_packet(p_rx_packet, pckt_length);
+        }
+
+        MSS_MAC_receive_pkt((mss_mac_instance_t *)this_mac, queue_no,
+                            p_rx_packet, caller_info, MSS_MAC_INT_ENABLE);
+    }
+  @endcode
+ */
+mss_mac_rx_csum_t
+MSS_MAC_get_rx_csum_status
+(
+    const mss_mac_instance_t *this_mac,
+    const mss_mac_rx_desc_t *cdesc
+);
+
 
 #if defined MSS_MAC_UNH_TEST
   /***************************************************************************//**
@@ -2794,6 +3317,121 @@ MSS_MAC_get_type_2_filter
     mss_mac_type_2_filter_t *filter
  );
 
+/***************************************************************************//**
+  The _MSS_MAC_add_flow_rule()_ function steers a class of received packets to
+  a specific queue. It is a convenience layer over the Type 1 and Type 2
+  Screening Filter functions which allocates the filters, comparers and
+  Ethertype registers each rule needs from those not already used by this
+  function. Rules are checked by the GEM in filter order so the first rule
+  added takes priority where rules overlap.
+
+  Used together with _MSS_MAC_set_queue_irq_hart()_ this allows receive
+  processing for different flows to be spread across the U54 harts.
+
+  Note that this function keeps track only of the resources it has allocated
+  itself. Filters set up directly with _MSS_MAC_set_type_1_filter()_ and
+  _MSS_MAC_set_type_2_filter()_ may be overwritten.
+
+  @param this_mac
+    This parameter is a pointer to one of the global _mss_mac_instance_t_
+    structures which identifies the MAC that the function is to operate on.
+
+  @param rule
+    This parameter is a pointer to a _mss_mac_flow_rule_t_ structure which
+    describes the packets to match and the queue to route them to.
+
+  @return
+    This function returns _MSS_MAC_SUCCESS_ if the rule was installed and
+    _MSS_MAC_FAILED_ if the queue number is invalid, the rule type is not
+    supported by this MAC or there are not enough free filter resources.
+
+  Example:
+  This example sends PTP event messages to queue 1 and VLAN priority 5 traffic
+  to queue 2 and has harts 2 and 3 service those queues.
+
+  @code
+    void init_steering(void)
+    {
+        mss_mac_flow_rule_t rule;
+
+        rule.type = MSS_MAC_FLOW_UDP_PORT;
+        rule.value = 319U;
+        rule.queue_no = 1U;
+        MSS_MAC_add_flow_rule(&g_mac0, &rule);
+
+        rule.type = MSS_MAC_FLOW_VLAN_PRIORITY;
+        rule.value = 5U;
+        rule.queue_no = 2U;
+        MSS_MAC_add_flow_rule(&g_mac0, &rule);
+
+        MSS_MAC_set_queue_irq_hart(&g_mac0, 1U, 2U);
+        MSS_MAC_set_queue_irq_hart(&g_mac0, 2U, 3U);
+    }
+  @endcode
+ */
+uint8_t
+MSS_MAC_add_flow_rule
+(
+    mss_mac_instance_t *this_mac,
+    const mss_mac_flow_rule_t *rule
+);
+
+/***************************************************************************//**
+  The _MSS_MAC_clear_flow_rules()_ function removes all the rules added with
+  _MSS_MAC_add_flow_rule()_ and releases the Screening Filter resources they
+  used. Received packets then go to queue 0 unless other filters are set.
+
+  @param this_mac
+    This parameter is a pointer to one of the global _mss_mac_instance_t_
+    structures which identifies the MAC that the function is to operate on.
+
+  @return
+    This function does not return a value.
+ */
+void
+MSS_MAC_clear_flow_rules
+(
+    mss_mac_instance_t *this_mac
+);
+
+/***************************************************************************//**
+  The _MSS_MAC_set_queue_irq_hart()_ function routes the PLIC interrupt for a
+  queue to a single hart. From then on the driver enables and disables the
+  queue interrupt in that hart's PLIC enable registers, whichever hart the
+  driver is called from, so the interrupt is only ever taken on the chosen
+  hart. If the interrupt is currently enabled it is moved to the new hart
+  straight away.
+
+  The driver masks the queue interrupt to protect its data structures, which
+  cannot stop an interrupt handler already running on another hart. The
+  application should therefore call the driver for a queue only from the hart
+  which services it, once it has been routed.
+
+  This function has no effect for MACs configured to use local interrupts.
+
+  @param this_mac
+    This parameter is a pointer to one of the global _mss_mac_instance_t_
+    structures which identifies the MAC that the function is to operate on.
+
+  @param queue_no
+    This parameter identifies the queue whose interrupt is to be routed.
+
+  @param hart_id
+    This parameter is the hart to route the interrupt to, 0 for the E51 and 1
+    to 4 for the U54s. Use _MSS_MAC_IRQ_HART_LOCAL_ to restore the default
+    behaviour.
+
+  @return
+    This function does not return a value.
+ */
+void
+MSS_MAC_set_queue_irq_hart
+(
+    mss_mac_instance_t *this_mac,
+    uint32_t queue_no,
+    uint32_t hart_id
+);
+
 /***************************************************************************//**
   The _MSS_MAC_set_type_2_ethertype()_ function is used to configure the Type 2
   Ethertype matching blocks in the Ethernet MAC. These are used by Type 2
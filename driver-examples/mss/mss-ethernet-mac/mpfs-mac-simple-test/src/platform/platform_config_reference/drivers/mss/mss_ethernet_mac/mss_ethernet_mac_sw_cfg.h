@@ -240,6 +240,19 @@
 #define MSS_MAC_MEM_FIC1   (2)
 #define MSS_MAC_MEM_CRYPTO (3)
 
+/*
+ * _MSS_MAC_MEM_SCRATCHPAD_ places the descriptor rings and buffers in the L2
+ * scratchpad, which must be configured in the MSS Configurator.
+ * _MSS_MAC_MEM_CACHED_DDR_ places them in cached DDR. The driver then accesses
+ * the descriptor rings through the non-cached DDR alias and maintains the
+ * packet buffers with _MSS_MAC_CACHE_FLUSH()_ and _MSS_MAC_CACHE_INVALIDATE()_,
+ * which can be defined here to replace the default L2 flush based versions.
+ * The start address of any region can be changed by defining
+ * _MSS_MAC_MEM_BASE_.
+ */
+#define MSS_MAC_MEM_SCRATCHPAD  (4)
+#define MSS_MAC_MEM_CACHED_DDR  (5)
+
 /***************************************************************************//**
  * Number of additional queues for PMAC (eMAC only has 1).
  *
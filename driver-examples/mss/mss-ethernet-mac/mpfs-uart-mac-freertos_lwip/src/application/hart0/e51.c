@@ -267,11 +267,6 @@ prvEthernetConfigureInterface(void *param)
     netif_set_default(&g_EMAC_if);
 }
 
-/*==============================================================================
- *
- */
-void ethernetif_tick(void);
-
 mss_mac_speed_t g_net_speed;
 
 void
@@ -301,7 +296,6 @@ prvLinkStatusTask(void *pvParameters)
         linkup = MSS_MAC_get_link_status(&g_mac1, &speed, &fullduplex);
 #endif
         g_net_speed = speed;
-        ethernetif_tick();
     }
 }
 
@@ -129,6 +129,7 @@ to exclude the API function. */
 #define INCLUDE_vTaskDelayUntil			1
 #define INCLUDE_vTaskDelay				1
 #define INCLUDE_eTaskGetState			1
+#define INCLUDE_xTimerPendFunctionCall	1
 
 /* Normal assert() semantics without relying on the provision of an assert.h
 header file. */
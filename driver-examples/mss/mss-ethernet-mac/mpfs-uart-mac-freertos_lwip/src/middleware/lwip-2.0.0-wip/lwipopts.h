@@ -1177,6 +1177,44 @@
 #define PBUF_POOL_BUFSIZE               LWIP_MEM_ALIGN_SIZE(TCP_MSS+40+PBUF_LINK_ENCAPSULATION_HLEN+PBUF_LINK_HLEN)
 #endif
 
+/**
+ * LWIP_SUPPORT_CUSTOM_PBUF==1: Support pbufs which wrap memory owned by the
+ * application. Required by MPFS_ETHERNETIF_ZERO_COPY_RX.
+ */
+#ifndef LWIP_SUPPORT_CUSTOM_PBUF
+#define LWIP_SUPPORT_CUSTOM_PBUF        1
+#endif
+
+/**
+ * MPFS_ETHERNETIF_ZERO_COPY_RX==1: Pass the GEM receive buffers to lwIP as
+ * custom pbufs rather than copying each frame into a PBUF_POOL pbuf. A buffer
+ * is only returned to the receive ring when lwIP frees the pbuf.
+ */
+#ifndef MPFS_ETHERNETIF_ZERO_COPY_RX
+#define MPFS_ETHERNETIF_ZERO_COPY_RX    1
+#endif
+
+/**
+ * MPFS_ETHERNETIF_SG_TX==1: Queue each pbuf of an outgoing frame directly on
+ * its own GEM transmit descriptor and keep several frames in flight, rather
+ * than copying one frame at a time into a single transmit buffer.
+ */
+#ifndef MPFS_ETHERNETIF_SG_TX
+#define MPFS_ETHERNETIF_SG_TX           1
+#endif
+
+/**
+ * MPFS_ETHERNETIF_HW_CHECKSUM==1: Have the GEM generate and check the IP and
+ * TCP checksums. Frames received with a bad checksum are discarded by the
+ * GEM, so the software IP and TCP checks below are turned off by default.
+ * Frames the GEM passes on without checking, such as IP fragments, are
+ * checked by the netif instead. UDP and ICMP checksums are still handled in
+ * software.
+ */
+#ifndef MPFS_ETHERNETIF_HW_CHECKSUM
+#define MPFS_ETHERNETIF_HW_CHECKSUM     1
+#endif
+
 /*
    ------------------------------------------------
    ---------- Network Interfaces options ----------
@@ -1842,21 +1880,21 @@
  * CHECKSUM_GEN_IP==1: Generate checksums in software for outgoing IP packets.
  */
 #ifndef CHECKSUM_GEN_IP
-#define CHECKSUM_GEN_IP                 1
+#define CHECKSUM_GEN_IP                 (!MPFS_ETHERNETIF_HW_CHECKSUM)
 #endif
 
 /**
  * CHECKSUM_GEN_UDP==1: Generate checksums in software for outgoing UDP packets.
  */
 #ifndef CHECKSUM_GEN_UDP
-#define CHECKSUM_GEN_UDP                0 // Fixme: PMCS
+#define CHECKSUM_GEN_UDP                1 /* See CHECKSUM_CHECK_UDP */
 #endif
 
 /**
  * CHECKSUM_GEN_TCP==1: Generate checksums in software for outgoing TCP packets.
  */
 #ifndef CHECKSUM_GEN_TCP
-#define CHECKSUM_GEN_TCP                1
+#define CHECKSUM_GEN_TCP                (!MPFS_ETHERNETIF_HW_CHECKSUM)
 #endif
 
 /**
@@ -1877,21 +1915,24 @@
  * CHECKSUM_CHECK_IP==1: Check checksums in software for incoming IP packets.
  */
 #ifndef CHECKSUM_CHECK_IP
-#define CHECKSUM_CHECK_IP               1
+#define CHECKSUM_CHECK_IP               (!MPFS_ETHERNETIF_HW_CHECKSUM)
 #endif
 
 /**
  * CHECKSUM_CHECK_UDP==1: Check checksums in software for incoming UDP packets.
+ * UDP checksums stay in software with MPFS_ETHERNETIF_HW_CHECKSUM. Large UDP
+ * datagrams are often fragmented, and the GEM can neither check nor generate
+ * the checksum of a fragmented datagram.
  */
 #ifndef CHECKSUM_CHECK_UDP
-#define CHECKSUM_CHECK_UDP              0 // Fixme: PMCS
+#define CHECKSUM_CHECK_UDP              1
 #endif
 
 /**
  * CHECKSUM_CHECK_TCP==1: Check checksums in software for incoming TCP packets.
  */
 #ifndef CHECKSUM_CHECK_TCP
-#define CHECKSUM_CHECK_TCP              1
+#define CHECKSUM_CHECK_TCP              (!MPFS_ETHERNETIF_HW_CHECKSUM)
 #endif
 
 /**
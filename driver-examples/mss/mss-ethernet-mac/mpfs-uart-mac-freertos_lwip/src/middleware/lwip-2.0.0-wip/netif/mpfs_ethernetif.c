@@ -60,6 +60,7 @@
 #include "FreeRTOS.h"
 #include "task.h"
 #include "semphr.h"
+#include "timers.h"
 
 #include "lwip/opt.h"
 #include "lwip/def.h"
@@ -67,8 +68,12 @@
 #include "lwip/pbuf.h"
 #include "lwip/stats.h"
 #include "lwip/snmp.h"
+#include "lwip/sys.h"
 #include "lwip/ethip6.h"
 #include "lwip/etharp.h"
+#include "lwip/tcpip.h"
+#include "lwip/inet_chksum.h"
+#include "lwip/prot/ip.h"
 #include "netif/ppp/pppoe.h"
 
 const uint8_t * sys_cfg_get_mac_address(void);
@@ -79,9 +84,39 @@ const uint8_t * sys_cfg_get_mac_address(void);
 #define BUFFER_USED     1u
 #define BUFFER_EMPTY    0u
 #define RELEASE_BUFFER  BUFFER_EMPTY
+#if MPFS_ETHERNETIF_ZERO_COPY_RX
+#if !LWIP_SUPPORT_CUSTOM_PBUF
+#error "MPFS_ETHERNETIF_ZERO_COPY_RX requires LWIP_SUPPORT_CUSTOM_PBUF"
+#endif
+/*
+ * lwIP keeps hold of the receive buffers until it has finished with each frame
+ * so provide a spare buffer per descriptor to keep the ring populated.
+ */
+#define RX_BUFFER_COUNT (2U * MSS_MAC_RX_RING_SIZE)
+#else
 #define RX_BUFFER_COUNT MSS_MAC_RX_RING_SIZE
+#endif
 #define TX_BUFFER_COUNT 1
 
+#if MPFS_ETHERNETIF_SG_TX && !defined(MSS_MAC_USE_DDR)
+/*
+ * Most pbuf chains from the stack are 1 to 3 pbufs long. Longer chains are
+ * copied into a single pbuf rather than tying up the transmit ring.
+ */
+#define TX_MAX_FRAGS    4U
+
+/*
+ * Frames the MAC has finished sending, waiting for their pbuf to be freed.
+ * pbuf_free() must not be called from the transmit complete interrupt, so the
+ * handler only adds the frame here. The pbufs are freed in the tcpip thread,
+ * by low_level_output() or by the callback the handler has the timer task
+ * post, see tx_done_pend(). Each frame on the queue has been sent since the
+ * last low_level_output() call, so no more than the ring holds can be
+ * waiting.
+ */
+#define TX_DONE_QUEUE_SIZE  (MSS_MAC_TX_RING_SIZE + 1U)
+#endif
+
 uint32_t get_user_eth_speed_choice(void);
 
 /* Buffers for Tx and Rx */
@@ -91,7 +126,43 @@ static uint8_t g_mac_rx_buffer[RX_BUFFER_COUNT][MSS_MAC_MAX_RX_BUF_SIZE] __attri
 static volatile uint8_t g_mac_tx_buffer_used[TX_BUFFER_COUNT];
 static volatile uint8_t g_mac_rx_buffer_data_valid[RX_BUFFER_COUNT];
 
+#if MPFS_ETHERNETIF_ZERO_COPY_RX
+/*
+ * Receive buffer wrapper passed to the MAC driver as the p_user_data for each
+ * descriptor. The pbuf_custom must come first so the pbuf lwIP hands back to
+ * rx_pbuf_free() can be cast to this type.
+ */
+typedef struct
+{
+    struct pbuf_custom pc;
+    mss_mac_instance_t *this_mac;
+    uint32_t queue_no;
+    uint8_t *p_buffer;
+} mpfs_rx_pbuf_t;
+
+static mpfs_rx_pbuf_t g_mac_rx_pbuf[RX_BUFFER_COUNT];
+
+/*
+ * Buffers which are neither on the receive ring nor held by lwIP. The pool is
+ * used both from the MAC interrupt and from the tcpip thread. SYS_ARCH_PROTECT()
+ * is vPortEnterCritical(), which is not safe in an interrupt handler as it
+ * re-enables interrupts on exit, so it is only used in task context and the
+ * interrupt path saves and restores the interrupt enable instead.
+ */
+static mpfs_rx_pbuf_t *g_mac_rx_free_pool[RX_BUFFER_COUNT];
+static volatile uint32_t g_mac_rx_free_count = 0U;
+#endif
+
+#if MPFS_ETHERNETIF_SG_TX && !defined(MSS_MAC_USE_DDR)
+static struct pbuf *g_tx_done_queue[TX_DONE_QUEUE_SIZE];
+static volatile uint32_t g_tx_done_head = 0U;   /* Written by the interrupt */
+static volatile uint32_t g_tx_done_tail = 0U;   /* Written by the tcpip thread */
+static struct tcpip_callback_msg *g_tx_done_msg = NULL;
+static volatile uint8_t g_tx_done_pending = 0U; /* tx_done_pend() is queued */
+#endif
+
 struct netif * g_p_mac_netif = 0;
+static mss_mac_instance_t * g_p_netif_mac = 0;
 
 static uint8_t r_mac_addr[60] = {0};
 static uint8_t r_mac_length = 0;
@@ -116,9 +187,15 @@ static void ethernetif_input
 (
     struct netif *netif,
     uint8_t * p_rx_packet,
-    uint32_t pckt_length
+    uint32_t pckt_length,
+    mss_mac_rx_csum_t csum,
+    void * caller_info
 );
 
+#if MPFS_ETHERNETIF_HW_CHECKSUM
+static uint8_t rx_csum_ok(struct pbuf *p, mss_mac_rx_csum_t csum);
+#endif
+
 static void packet_tx_complete_handler(/* mss_mac_instance_t*/ void *this_mac, uint32_t queue_no, mss_mac_tx_desc_t *cdesc, void * caller_info);
 
 static void low_level_init(struct netif *netif);
@@ -128,9 +205,20 @@ static struct pbuf * low_level_input
 (
     struct netif *netif,
     uint8_t * p_rx_packet,
-    uint32_t pckt_length
+    uint32_t pckt_length,
+    void * caller_info
 );
 
+#if MPFS_ETHERNETIF_SG_TX && !defined(MSS_MAC_USE_DDR)
+static void tx_pbuf_drain(void *ctx);
+static void tx_done_pend(void *param1, uint32_t param2);
+#endif
+
+#if MPFS_ETHERNETIF_ZERO_COPY_RX
+static void rx_pbuf_free(struct pbuf *p);
+static void rx_pbuf_recycle(mpfs_rx_pbuf_t *rx_pbuf, uint8_t from_isr);
+#endif
+
 
 /**=============================================================================
  * Should be called at the beginning of the program to set up the
@@ -194,7 +282,10 @@ static void
 low_level_init(struct netif *netif)
 {
     const uint8_t * own_hw_adr;
-    int32_t count;
+    mss_mac_instance_t *p_mac;
+    uint8_t *rx_buffers[MSS_MAC_RX_RING_SIZE];
+    void *rx_user_data[MSS_MAC_RX_RING_SIZE];
+    uint32_t count;
 
     /* We only have one network Interface */
     /* Initialize the Network interface */
@@ -433,6 +524,21 @@ low_level_init(struct netif *netif)
     g_mac_config.use_local_ints        = MSS_MAC_ENABLE;
 
 #endif
+
+#if MPFS_ETHERNETIF_ZERO_COPY_RX
+    /*
+     * Have the GEM leave room for the lwIP padding word at the start of each
+     * buffer so the buffer can be handed to lwIP as is.
+     */
+    g_mac_config.rx_buffer_offset = ETH_PAD_SIZE;
+#endif
+
+#if MPFS_ETHERNETIF_HW_CHECKSUM
+    /* lwIP leaves the IP, TCP and UDP checksums to the GEM, see lwipopts.h */
+    g_mac_config.tx_checksum_offload = MSS_MAC_ENABLE;
+    g_mac_config.rx_checksum_offload = MSS_MAC_ENABLE;
+#endif
+
     vSemaphoreCreateBinary(xSemaphore);
 
     if( xSemaphore == NULL )
@@ -504,12 +610,17 @@ low_level_init(struct netif *netif)
      * a receive buffer has been filled with an rx packet.
      */
 #if defined(G5_SOC_EMU_USE_GEM0) && ((MSS_MAC_HW_PLATFORM == MSS_MAC_DESIGN_ICICLE_SGMII_GEM0) || (MSS_MAC_HW_PLATFORM == MSS_MAC_DESIGN_ICICLE_STD_GEM0) || (MSS_MAC_HW_PLATFORM == MSS_MAC_DESIGN_ICICLE_STD_GEM0_LOCAL) || (MSS_MAC_HW_PLATFORM == MSS_MAC_DESIGN_BEAGLEV_FIRE_GEM0))
-    MSS_MAC_set_tx_callback(&g_mac0, 0, packet_tx_complete_handler);
-    MSS_MAC_set_rx_callback(&g_mac0, 0, mac_rx_callback);
+    p_mac = &g_mac0;
 #else
-    MSS_MAC_set_tx_callback(&g_mac1, 0, packet_tx_complete_handler);
-    MSS_MAC_set_rx_callback(&g_mac1, 0, mac_rx_callback);
+    p_mac = &g_mac1;
+#endif
+    g_p_netif_mac = p_mac;
+#if MPFS_ETHERNETIF_SG_TX && !defined(MSS_MAC_USE_DDR)
+    g_tx_done_msg = tcpip_callbackmsg_new(tx_pbuf_drain, NULL);
 #endif
+    MSS_MAC_set_tx_callback(p_mac, 0, packet_tx_complete_handler);
+    MSS_MAC_set_rx_callback(p_mac, 0, mac_rx_callback);
+
     /* 
      * Allocate receive buffers.
      *
@@ -519,32 +630,171 @@ low_level_init(struct netif *netif)
      * This function will need to be called each time a packet is received to
      * hand back the receive buffer to the MAC driver.
      */
-    for(count = 0; count < RX_BUFFER_COUNT; ++count)
+    for(count = 0U; count < RX_BUFFER_COUNT; ++count)
     {
-        /*
-         * We allocate the buffers with the Ethernet MAC interrupt disabled
-         * until we get to the last one. For the last one we ensure the Ethernet
-         * MAC interrupt is enabled on return from MSS_MAC_receive_pkt().
-         */
-        if(count != (RX_BUFFER_COUNT - 1))
+#if MPFS_ETHERNETIF_ZERO_COPY_RX
+        g_mac_rx_pbuf[count].pc.custom_free_function = rx_pbuf_free;
+        g_mac_rx_pbuf[count].this_mac = p_mac;
+        g_mac_rx_pbuf[count].queue_no = 0U;
+        g_mac_rx_pbuf[count].p_buffer = g_mac_rx_buffer[count];
+
+        if(count >= MSS_MAC_RX_RING_SIZE)
         {
-#if defined(G5_SOC_EMU_USE_GEM0) && ((MSS_MAC_HW_PLATFORM == MSS_MAC_DESIGN_ICICLE_SGMII_GEM0) || (MSS_MAC_HW_PLATFORM == MSS_MAC_DESIGN_ICICLE_STD_GEM0) || (MSS_MAC_HW_PLATFORM == MSS_MAC_DESIGN_ICICLE_STD_GEM0_LOCAL) || (MSS_MAC_HW_PLATFORM == MSS_MAC_DESIGN_BEAGLEV_FIRE_GEM0))
-            MSS_MAC_receive_pkt(&g_mac0, 0, g_mac_rx_buffer[count], 0, 0);
+            /* Ring is full, the rest are spares */
+            g_mac_rx_free_pool[g_mac_rx_free_count] = &g_mac_rx_pbuf[count];
+            ++g_mac_rx_free_count;
+            continue;
+        }
+
+        rx_user_data[count] = &g_mac_rx_pbuf[count];
 #else
-            MSS_MAC_receive_pkt(&g_mac1, 0, g_mac_rx_buffer[count], 0, 0);
+        rx_user_data[count] = 0;
 #endif
-        }
-        else
+        rx_buffers[count] = g_mac_rx_buffer[count];
+    }
+
+    /*
+     * Hand the whole ring over in one go, this also arms the Ethernet MAC
+     * receive interrupt.
+     */
+    (void)MSS_MAC_receive_pkts(p_mac, 0, rx_buffers, rx_user_data, MSS_MAC_RX_RING_SIZE, MSS_MAC_INT_ARM);
+}
+
+#if MPFS_ETHERNETIF_SG_TX && !defined(MSS_MAC_USE_DDR)
+/**=============================================================================
+ * This function should do the actual transmission of the packet. The packet is
+ * contained in the pbuf that is passed to the function. This pbuf
+ * might be chained.
+ *
+ * Each pbuf in the chain is given its own transmit descriptor so no copy is
+ * made. We take a reference to the pbuf which is dropped again by
+ * tx_pbuf_drain() once the MAC has finished with it. This lets us
+ * keep queuing frames while earlier ones are still being sent, up to the
+ * capacity of the transmit ring.
+ *
+ * @param netif the lwip network interface structure for this ethernetif
+ * @param p the MAC packet to send (e.g. IP packet including MAC addresses and type)
+ * @return ERR_OK if the packet could be sent
+ *         an err_t value if the packet couldn't be sent
+ */
+static err_t
+low_level_output(struct netif *netif, struct pbuf *p)
+{
+    mss_mac_tx_frag_t frags[TX_MAX_FRAGS];
+    struct pbuf *q;
+    struct pbuf *p_tx;
+    uint32_t frag_count = 0U;
+    int32_t tx_status;
+
+    (void)netif;
+
+    /* Free the frames the MAC has finished with since the last call */
+    tx_pbuf_drain(NULL);
+
+#if ETH_PAD_SIZE
+    pbuf_header(p, -ETH_PAD_SIZE); /* drop the padding word */
+#endif
+
+    if(pbuf_clen(p) <= TX_MAX_FRAGS)
+    {
+        p_tx = p;
+        pbuf_ref(p_tx);
+    }
+    else
+    {
+        /* Too fragmented, flatten into a single pbuf */
+        p_tx = pbuf_alloc(PBUF_RAW, p->tot_len, PBUF_RAM);
+        if((NULL == p_tx) || (ERR_OK != pbuf_copy(p_tx, p)))
         {
-#if defined(G5_SOC_EMU_USE_GEM0) && ((MSS_MAC_HW_PLATFORM == MSS_MAC_DESIGN_ICICLE_SGMII_GEM0) || (MSS_MAC_HW_PLATFORM == MSS_MAC_DESIGN_ICICLE_STD_GEM0) || (MSS_MAC_HW_PLATFORM == MSS_MAC_DESIGN_ICICLE_STD_GEM0_LOCAL) || (MSS_MAC_HW_PLATFORM == MSS_MAC_DESIGN_BEAGLEV_FIRE_GEM0))
-            MSS_MAC_receive_pkt(&g_mac0, 0, g_mac_rx_buffer[count], 0, -1);
-#else
-            MSS_MAC_receive_pkt(&g_mac1, 0, g_mac_rx_buffer[count], 0, -1);
+            if(NULL != p_tx)
+            {
+                pbuf_free(p_tx);
+            }
+#if ETH_PAD_SIZE
+            pbuf_header(p, ETH_PAD_SIZE); /* reclaim the padding word */
 #endif
+            LINK_STATS_INC(link.memerr);
+            LINK_STATS_INC(link.drop);
+            MIB2_STATS_NETIF_INC(netif, ifoutdiscards);
+            return ERR_MEM;
+        }
+    }
+
+    for(q = p_tx; q != NULL; q = q->next)
+    {
+        if(0U != q->len)
+        {
+            frags[frag_count].tx_buffer = (uint8_t const *)q->payload;
+            frags[frag_count].length = q->len;
+            ++frag_count;
+        }
+    }
+
+    /*--------------------------------------------------------------------------
+     * Queue the frame. Keep retrying until there is room in the MAC Tx ring,
+     * the semaphore is given each time the MAC releases transmitted frames.
+     */
+    do {
+        tx_status = MSS_MAC_send_pkt_sg(g_p_netif_mac, 0, frags, frag_count, (void *)p_tx);
+        if(MSS_MAC_ERR_OK != tx_status)
+        {
+            (void)xSemaphoreTake(xSemaphore, 1);
+            tx_pbuf_drain(NULL);
         }
+    } while(MSS_MAC_ERR_OK != tx_status);
+
+    MIB2_STATS_NETIF_ADD(netif, ifoutoctets, p->tot_len);
+    if (((u8_t*)p->payload)[0] & 1) {
+      /* broadcast or multicast packet*/
+      MIB2_STATS_NETIF_INC(netif, ifoutnucastpkts);
+    } else {
+      /* unicast packet */
+      MIB2_STATS_NETIF_INC(netif, ifoutucastpkts);
     }
+#if ETH_PAD_SIZE
+    pbuf_header(p, ETH_PAD_SIZE); /* reclaim the padding word */
+#endif
+    LINK_STATS_INC(link.xmit);
+    return ERR_OK;
 }
 
+/**=============================================================================
+ * Frees the pbufs of the frames packet_tx_complete_handler() has queued. Runs
+ * in the tcpip thread.
+ */
+static void
+tx_pbuf_drain(void *ctx)
+{
+    uint32_t tail = g_tx_done_tail;
+
+    (void)ctx;
+    while(tail != g_tx_done_head)
+    {
+        __sync_synchronize(); /* read the entry after the head it is behind */
+        pbuf_free(g_tx_done_queue[tail]);
+        tail = (tail + 1U) % TX_DONE_QUEUE_SIZE;
+        g_tx_done_tail = tail;
+    }
+}
+
+/**=============================================================================
+ * Posts tx_pbuf_drain() to the tcpip thread. tcpip_trycallback() is not safe
+ * in an interrupt handler, so packet_tx_complete_handler() has this run in the
+ * timer task. If the tcpip mailbox is full the frames are freed by the next
+ * low_level_output() or transmit complete interrupt instead.
+ */
+static void
+tx_done_pend(void *param1, uint32_t param2)
+{
+    (void)param1;
+    (void)param2;
+
+    g_tx_done_pending = 0U;
+    __sync_synchronize();
+    (void)tcpip_trycallback(g_tx_done_msg);
+}
+
+#else
 /**=============================================================================
  * This function should do the actual transmission of the packet. The packet is
  * contained in the pbuf that is passed to the function. This pbuf
@@ -636,6 +886,7 @@ low_level_output(struct netif *netif, struct pbuf *p)
     LINK_STATS_INC(link.xmit);
     return ERR_OK;
 }
+#endif /* MPFS_ETHERNETIF_SG_TX */
 
 /**=============================================================================
  *
@@ -649,8 +900,33 @@ static void packet_tx_complete_handler(/* mss_mac_instance_t*/ void *this_mac, u
     static signed portBASE_TYPE xHigherPriorityTaskWoken;
     xHigherPriorityTaskWoken = pdFALSE;
 
-    (void)caller_info;
     (void)this_mac;
+#if MPFS_ETHERNETIF_SG_TX && !defined(MSS_MAC_USE_DDR)
+    /*
+     * Queue the frame for tx_pbuf_drain() to drop the reference
+     * low_level_output() took on it, pbuf_free() is not safe here
+     */
+    if(NULL != caller_info)
+    {
+        uint32_t head = g_tx_done_head;
+
+        g_tx_done_queue[head] = (struct pbuf *)caller_info;
+        __sync_synchronize();
+        g_tx_done_head = (head + 1U) % TX_DONE_QUEUE_SIZE;
+
+        /* One call at a time is enough, the drain frees everything queued */
+        if((NULL != g_tx_done_msg) && (0U == g_tx_done_pending))
+        {
+            if(pdPASS == xTimerPendFunctionCallFromISR(tx_done_pend, NULL, 0U,
+                                                       &xHigherPriorityTaskWoken))
+            {
+                g_tx_done_pending = 1U;
+            }
+        }
+    }
+#else
+    (void)caller_info;
+#endif
 
     // Unblock the task by releasing the semaphore.
     xSemaphoreGiveFromISR( xSemaphore, &xHigherPriorityTaskWoken );
@@ -675,10 +951,11 @@ static void mac_rx_callback
     void * caller_info
 )
 {
-    (void)caller_info;
     if(g_p_mac_netif != 0)
     {
-        ethernetif_input(g_p_mac_netif, p_rx_packet, pckt_length);
+        ethernetif_input(g_p_mac_netif, p_rx_packet, pckt_length,
+                         MSS_MAC_get_rx_csum_status((mss_mac_instance_t *)this_mac, cdesc),
+                         caller_info);
     }
     _rx_counter++;
 }
@@ -691,40 +968,316 @@ static void mac_rx_callback
  * the appropriate input function is called.
  *
  * @param netif the lwip network interface structure for this ethernetif
+ * @param csum the result of the GEM receive checksum checks for the frame
  */
 static void
 ethernetif_input
 (
     struct netif *netif,
     uint8_t * p_rx_packet,
-    uint32_t pckt_length
+    uint32_t pckt_length,
+    mss_mac_rx_csum_t csum,
+    void * caller_info
 )
 {
     struct pbuf *p;
 
     /* move received packet into a new pbuf */
-    p = low_level_input(netif, p_rx_packet, pckt_length);
+    p = low_level_input(netif, p_rx_packet, pckt_length, caller_info);
     /* no packet could be read, silently ignore this */
 
+#if MPFS_ETHERNETIF_HW_CHECKSUM
+    if ((p != NULL) && (0U == rx_csum_ok(p, csum)))
+    {
+        LINK_STATS_INC(link.chkerr);
+        LINK_STATS_INC(link.drop);
+        MIB2_STATS_NETIF_INC(netif, ifinerrors);
+#if MPFS_ETHERNETIF_ZERO_COPY_RX
+        rx_pbuf_recycle((mpfs_rx_pbuf_t *)p, 1U);
+#else
+        pbuf_free(p);
+#endif
+        p = NULL;
+    }
+#else
+    (void)csum;
+#endif
+
     if (p != NULL)
     {
         /* pass all packets to ethernet_input, which decides what packets it supports */
         if (netif->input(p, netif) != ERR_OK)
         {
             LWIP_DEBUGF(NETIF_DEBUG, ("ethernetif_input: IP input error\n"));
+#if MPFS_ETHERNETIF_ZERO_COPY_RX
+            /*
+             * Still in the MAC interrupt, hand the buffer straight back rather
+             * than going through pbuf_free() and rx_pbuf_free()
+             */
+            rx_pbuf_recycle((mpfs_rx_pbuf_t *)p, 1U);
+#else
             pbuf_free(p);
+#endif
         }
     }
 }
 
+#if MPFS_ETHERNETIF_HW_CHECKSUM
 /**=============================================================================
- * 
+ * Returns the TCP checksum of a received segment, including the pseudo header,
+ * without changing the pbuf. The result is 0 if the checksum is correct.
+ *
+ * @param p the received frame
+ * @param offset offset of the TCP header in the frame
+ * @param len length of the TCP segment
+ * @param iph the IPv4 header of the segment
  */
-void ethernetif_tick(void);
-void ethernetif_tick(void)
+static u16_t
+rx_csum_tcp(const struct pbuf *p, u16_t offset, u16_t len, const u8_t *iph)
 {
+    const struct pbuf *q;
+    u8_t pseudo[12];
+    u32_t acc;
+    u16_t sum;
+    u16_t chunk;
+    u16_t done = 0U;
+
+    /* Source and destination address, zero, protocol and TCP length */
+    (void)memcpy(&pseudo[0], &iph[12], 8U);
+    pseudo[8] = 0U;
+    pseudo[9] = IP_PROTO_TCP;
+    pseudo[10] = (u8_t)(len >> 8);
+    pseudo[11] = (u8_t)len;
+
+    acc = (u16_t)~inet_chksum(pseudo, sizeof(pseudo));
+
+    for (q = p; (NULL != q) && (done < len); q = q->next)
+    {
+        if (offset >= q->len)
+        {
+            offset = (u16_t)(offset - q->len);
+            continue;
+        }
+
+        chunk = (u16_t)LWIP_MIN((u16_t)(q->len - offset), (u16_t)(len - done));
+        sum = (u16_t)~inet_chksum((const u8_t *)q->payload + offset, chunk);
+
+        /* A part starting at an odd offset has its bytes the other way round */
+        if (0U != (done & 1U))
+        {
+            sum = SWAP_BYTES_IN_WORD(sum);
+        }
+
+        acc += sum;
+        done = (u16_t)(done + chunk);
+        offset = 0U;
+    }
+
+    acc = FOLD_U32T(acc);
+    acc = FOLD_U32T(acc);
+
+    return (done == len) ? (u16_t)~acc : 0xFFFFU;
 }
 
+/**=============================================================================
+ * lwIP does not check IP or TCP checksums itself when the GEM is checking
+ * them, see lwipopts.h. The GEM only checks frames it can parse though, and
+ * passes the rest on unchecked, for example TCP segments it does not handle.
+ * This checks what the GEM did not, without modifying the frame.
+ *
+ * UDP checksums are always checked by lwIP, as fragmented UDP datagrams can
+ * only be checked once they have been reassembled. IP fragments are passed on
+ * for lwIP to reassemble once their IP header has been checked. The TCP
+ * checksum of a segment which arrived fragmented is not checked, but TCP
+ * senders size their segments to avoid fragmentation.
+ *
+ * @param p the received frame, including the padding word
+ * @param csum the result of the GEM receive checksum checks for the frame
+ * @return 0 if the frame must be dropped
+ */
+static uint8_t
+rx_csum_ok(struct pbuf *p, mss_mac_rx_csum_t csum)
+{
+    uint8_t iph[60];
+    u16_t offset = SIZEOF_ETH_HDR; /* includes ETH_PAD_SIZE */
+    u16_t type;
+    u16_t hlen;
+    u16_t tot_len;
+
+    if ((MSS_MAC_RX_CSUM_IP_TCP_OK == csum) || (MSS_MAC_RX_CSUM_IP_UDP_OK == csum))
+    {
+        return 1U;
+    }
+
+    type = (u16_t)((pbuf_get_at(p, (u16_t)(offset - 2U)) << 8) |
+                   pbuf_get_at(p, (u16_t)(offset - 1U)));
+    if (ETHTYPE_VLAN == type)
+    {
+        offset = (u16_t)(offset + SIZEOF_VLAN_HDR);
+        type = (u16_t)((pbuf_get_at(p, (u16_t)(offset - 2U)) << 8) |
+                       pbuf_get_at(p, (u16_t)(offset - 1U)));
+    }
+
+    /* Anything other than an IPv4 header lwIP can parse is left to lwIP */
+    if ((ETHTYPE_IP != type) ||
+        (pbuf_copy_partial(p, iph, sizeof(iph), offset) < 20U))
+    {
+        return 1U;
+    }
+
+    hlen = (u16_t)((iph[0] & 0x0FU) * 4U);
+    tot_len = (u16_t)((iph[2] << 8) | iph[3]);
+    if ((hlen < 20U) || (tot_len < hlen) || (tot_len > (p->tot_len - offset)))
+    {
+        return 1U;
+    }
+
+    if ((MSS_MAC_RX_CSUM_NOT_CHECKED == csum) && (0U != inet_chksum(iph, hlen)))
+    {
+        return 0U;
+    }
+
+    /* Not TCP, or a fragment (more fragments flag or a fragment offset) */
+    if ((IP_PROTO_TCP != iph[9]) || (0U != (iph[6] & 0x3FU)) || (0U != iph[7]))
+    {
+        return 1U;
+    }
+
+    offset = (u16_t)(offset + hlen);
+
+    return (0U == rx_csum_tcp(p, offset, (u16_t)(tot_len - hlen), iph)) ? 1U : 0U;
+}
+#endif /* MPFS_ETHERNETIF_HW_CHECKSUM */
+
+#if MPFS_ETHERNETIF_ZERO_COPY_RX
+/**=============================================================================
+ * Wraps the receive buffer in its custom pbuf. No copy is made, the buffer is
+ * only returned to the MAC when lwIP frees the pbuf. The descriptor the frame
+ * arrived on is refilled straight away from the pool of spare buffers.
+ *
+ * @param netif the lwip network interface structure for this ethernetif
+ * @param caller_info the mpfs_rx_pbuf_t the frame was received into
+ * @return a pbuf referencing the received packet (including MAC header)
+ *         NULL on error
+ */
+static struct pbuf *
+low_level_input
+(
+    struct netif *netif,
+    uint8_t * p_rx_packet,
+    uint32_t pckt_length,
+    void * caller_info
+)
+{
+    mpfs_rx_pbuf_t *rx_pbuf = (mpfs_rx_pbuf_t *)caller_info;
+    mpfs_rx_pbuf_t *spare = NULL;
+    struct pbuf *p = NULL;
+    uint16_t len;
+    uint64_t saved_psr;
+
+    (void)p_rx_packet;
+
+    /* Called from the MAC interrupt */
+    saved_psr = disable_interrupts();
+    if(g_mac_rx_free_count > 0U)
+    {
+        --g_mac_rx_free_count;
+        spare = g_mac_rx_free_pool[g_mac_rx_free_count];
+        (void)MSS_MAC_receive_pkt(spare->this_mac, spare->queue_no, spare->p_buffer,
+                                  spare, MSS_MAC_INT_ENABLE);
+    }
+    restore_interrupts(saved_psr);
+
+    /* Obtain the size of the packet and put it into the "len"
+       variable. */
+    len = (uint16_t)pckt_length;
+
+    if((len > 0) && (NULL != rx_pbuf))
+    {
+        /* The GEM was told to leave ETH_PAD_SIZE bytes at the buffer start */
+        len += ETH_PAD_SIZE;
+        p = pbuf_alloced_custom(PBUF_RAW, len, PBUF_REF, &rx_pbuf->pc,
+                                rx_pbuf->p_buffer, (u16_t)MSS_MAC_MAX_RX_BUF_SIZE);
+    }
+
+    if(p != NULL)
+    {
+        MIB2_STATS_NETIF_ADD(netif, ifinoctets, p->tot_len);
+        if (((u8_t*)p->payload)[ETH_PAD_SIZE] & 1) {
+          /* broadcast or multicast packet*/
+          MIB2_STATS_NETIF_INC(netif, ifinnucastpkts);
+        } else {
+          /* unicast packet*/
+          MIB2_STATS_NETIF_INC(netif, ifinucastpkts);
+        }
+        LINK_STATS_INC(link.recv);
+    }
+    else
+    {
+        /* Silently drop current packet and give the buffer back */
+        if(NULL != rx_pbuf)
+        {
+            rx_pbuf_recycle(rx_pbuf, 1U);
+        }
+        LINK_STATS_INC(link.memerr);
+        LINK_STATS_INC(link.drop);
+        MIB2_STATS_NETIF_INC(netif, ifindiscards);
+    }
+
+    return p;
+}
+
+/**=============================================================================
+ * Puts a receive buffer back on the receive ring if there is a free descriptor
+ * and otherwise parks it in the spare pool for the next received frame.
+ *
+ * from_isr must be set when called from the MAC interrupt.
+ */
+static void
+rx_pbuf_recycle(mpfs_rx_pbuf_t *rx_pbuf, uint8_t from_isr)
+{
+    uint8_t status;
+    uint64_t saved_psr = 0U;
+    SYS_ARCH_DECL_PROTECT(old_level);
+
+    if(0U != from_isr)
+    {
+        saved_psr = disable_interrupts();
+    }
+    else
+    {
+        SYS_ARCH_PROTECT(old_level);
+    }
+
+    status = MSS_MAC_receive_pkt(rx_pbuf->this_mac, rx_pbuf->queue_no, rx_pbuf->p_buffer,
+                                 rx_pbuf, MSS_MAC_INT_ENABLE);
+    if(MSS_MAC_SUCCESS != status)
+    {
+        g_mac_rx_free_pool[g_mac_rx_free_count] = rx_pbuf;
+        ++g_mac_rx_free_count;
+    }
+
+    if(0U != from_isr)
+    {
+        restore_interrupts(saved_psr);
+    }
+    else
+    {
+        SYS_ARCH_UNPROTECT(old_level);
+    }
+}
+
+/**=============================================================================
+ * Custom pbuf free function, called by lwIP in the tcpip thread when it has
+ * finished with a received frame.
+ */
+static void
+rx_pbuf_free(struct pbuf *p)
+{
+    rx_pbuf_recycle((mpfs_rx_pbuf_t *)p, 0U);
+}
+
+#else
 /**=============================================================================
  * Should allocate a pbuf and transfer the bytes of the incoming
  * packet from the interface into the pbuf.
@@ -738,13 +1291,15 @@ low_level_input
 (
     struct netif *netif,
     uint8_t * p_rx_packet,
-    uint32_t pckt_length
+    uint32_t pckt_length,
+    void * caller_info
 )
 {
     struct pbuf *p, *q;
     uint16_t len;
 
     (void)netif;
+    (void)caller_info;
     p = NULL;
     
     /* Obtain the size of the packet and put it into the "len"
@@ -817,6 +1372,7 @@ low_level_input
     
     return p;
 }
+#endif /* MPFS_ETHERNETIF_ZERO_COPY_RX */
 
 /**************************************************************************//**
  *
@@ -82,6 +82,22 @@ typedef enum __mss_mac_rx_int_ctrl_t
     MSS_MAC_INT_ENABLE  =  1, /*!< Leave interrupts enabled on exit */
 } mss_mac_rx_int_ctrl_t;
 
+/****************************************************************************//**
+ * MAC RX checksum status
+ *
+ * This enumeration indicates which checksums the GEM verified for a received
+ * packet when receive checksum offload is enabled. It is returned by
+ * _MSS_MAC_get_rx_csum_status()_. Packets which fail any of the checks are
+ * discarded by the GEM so they are never seen by the application.
+ */
+typedef enum __mss_mac_rx_csum_t
+{
+    MSS_MAC_RX_CSUM_NOT_CHECKED = 0, /*!< No checksums checked, e.g. not IP or offload disabled */
+    MSS_MAC_RX_CSUM_IP_OK       = 1, /*!< IP header checksum checked and correct, TCP/UDP not checked */
+    MSS_MAC_RX_CSUM_IP_TCP_OK   = 2, /*!< IP header and TCP checksums checked and correct */
+    MSS_MAC_RX_CSUM_IP_UDP_OK   = 3, /*!< IP header and UDP checksums checked and correct */
+} mss_mac_rx_csum_t;
+
 /****************************************************************************//**
  * MAC PHY Reset type
  *
@@ -108,6 +124,13 @@ typedef enum __mss_mac_phy_reset_t
 #define MSS_MAC_AMBA_BURST_16   (16U)
 #define MSS_MAC_AMBA_BURST_MASK (31U)
 
+/***************************************************************************//**
+ * Largest value that can be used for the _rx_buffer_offset_ field in the
+ * _mss_mac_cfg_t structure_.
+ */
+
+#define MSS_MAC_RX_BUFFER_OFFSET_MAX (3U)
+
 
 /***************************************************************************//**
  * Pointer to PHY init function
@@ -599,6 +622,42 @@ typedef void (*mss_mac_phy_extended_write_t)(/* mss_mac_instance_t */ const void
 
     The _MSS_MAC_cfg_struct_def_init()_ function sets this configuration parameter
     to 0x10 for bursts up to 16.
+
+  ___rx_buffer_offset___:
+    Number of bytes, 0 to _MSS_MAC_RX_BUFFER_OFFSET_MAX_, the GEM skips at the
+    start of each receive buffer before writing the received frame. The pointer
+    passed to the receive callback is the start of the buffer and the length
+    does not include the offset. This allows a network stack to place alignment
+    padding ahead of the Ethernet header without copying the frame.
+
+    The _MSS_MAC_cfg_struct_def_init()_ function sets this configuration
+    parameter to 0.
+
+  ___tx_checksum_offload___:
+    This parameter specifies enable or disable of IP, TCP and UDP checksum
+    generation by the GEM for transmitted frames. When enabled, the checksum
+    fields in outgoing frames should be left as 0 and the GEM fills them in as
+    the frame is sent. Frames larger than the transmit packet buffer cannot be
+    offloaded. The allowed values are:
+
+      - _MSS_MAC_ENABLE_
+      - _MSS_MAC_DISABLE_
+
+    The _MSS_MAC_cfg_struct_def_init()_ function sets this configuration
+    parameter to _MSS_MAC_DISABLE_.
+
+  ___rx_checksum_offload___:
+    This parameter specifies enable or disable of IP, TCP and UDP checksum
+    checking by the GEM for received frames. When enabled, frames with bad
+    checksums are discarded by the GEM and the checks performed on each frame
+    that is received can be retrieved from its descriptor with
+    _MSS_MAC_get_rx_csum_status()_. The allowed values are:
+
+      - _MSS_MAC_ENABLE_
+      - _MSS_MAC_DISABLE_
+
+    The _MSS_MAC_cfg_struct_def_init()_ function sets this configuration
+    parameter to _MSS_MAC_DISABLE_.
  */
 
 typedef struct __mss_mac_cfg_t
@@ -650,6 +709,9 @@ typedef struct __mss_mac_cfg_t
     uint32_t mmsl_int_priority;         /*!< MMSL interrupt */
     uint32_t tsu_clock_select;          /*!< 0 for default TSU clock, 1 for fabric tsu clock */
     uint32_t amba_burst_length;         /*!< AXI burst length for DMA data transfers */
+    uint32_t rx_buffer_offset;          /*!< Bytes skipped at the start of each receive buffer */
+    uint32_t tx_checksum_offload;       /*!< Enable / disable transmit IP/TCP/UDP checksum generation */
+    uint32_t rx_checksum_offload;       /*!< Enable / disable receive IP/TCP/UDP checksum checking */
 } mss_mac_cfg_t;
 
 /***************************************************************************//**
@@ -863,6 +925,12 @@ typedef enum __mss_mac_frag_size_t
 #define GEM_RX_DMA_TYPE_ID        (BIT_22 | BIT_23) /*!< @brief Bitfield 
                                                       indicating which ID
                                                       register was matched. */
+#define GEM_RX_DMA_CSUM_STATUS    (BIT_22 | BIT_23) /*!< @brief Replaces
+                                                      GEM_RX_DMA_TYPE_ID when
+                                                      receive checksum offload
+                                                      is enabled. See
+                                                      mss_mac_rx_csum_t. */
+#define GEM_RX_DMA_CSUM_STATUS_SHIFT (22U)
 #define GEM_RX_DMA_VLAN_TAG       BIT_21 /*!< @brief Set if a VLAN tag was
                                            detected in the packet. */
 #define GEM_RX_DMA_PRIORITY_TAG   BIT_20 /*!< @brief Priority tag detected — 
@@ -1017,6 +1085,22 @@ typedef void (*mss_mac_receive_callback_t)(/* mss_mac_instance_t*/ void *this_ma
                                        mss_mac_rx_desc_t *cdesc,
                                        void *p_user_data);
 
+/***************************************************************************//**
+ * Receive poll schedule callback function.
+ *
+ * This is the prototype for the user function which the MSS Ethernet MAC driver
+ * calls, from the queue interrupt handler, when a queue operating in receive
+ * poll mode has frames ready. The receive interrupts for the queue have been
+ * masked by the time this function is called. The users function is
+ * responsible for arranging for _MSS_MAC_rx_poll()_ to be called from task or
+ * background context, for example by signalling a task.
+ *
+ *   - ___this_mac___    - pointer to global structure for the MAC in question.
+ *   - ___queue_no___    - 0 to 3 for pMAC and always 0 for eMAC.
+ */
+typedef void (*mss_mac_rx_poll_callback_t)(/* mss_mac_instance_t*/ void *this_mac,
+                                       uint32_t queue_no);
+
 /***************************************************************************//**
  * TSU timer time value.
  *
@@ -1149,6 +1233,42 @@ struct mss_mac_type_2_compare
     uint8_t  offset_value;      /*!< Offset value */
 };
 
+/***************************************************************************//**
+ * Receive flow steering rule types.
+ *
+ * These values select the packet field a rule added with
+ * _MSS_MAC_add_flow_rule()_ matches on. Each rule consumes Screening Filter
+ * resources as follows:
+ *
+ *   - ___MSS_MAC_FLOW_UDP_PORT___      - one Type 1 Filter.
+ *   - ___MSS_MAC_FLOW_TCP_PORT___      - one Type 2 Filter and two Type 2
+ *                                        Comparers (IPv4 only).
+ *   - ___MSS_MAC_FLOW_ETHERTYPE___     - one Type 2 Filter and one Ethertype
+ *                                        register (pMAC only).
+ *   - ___MSS_MAC_FLOW_VLAN_PRIORITY___ - one Type 2 Filter.
+ */
+typedef enum __mss_mac_flow_type_t
+{
+    MSS_MAC_FLOW_UDP_PORT      = 0, /*!< Match UDP destination port */
+    MSS_MAC_FLOW_TCP_PORT      = 1, /*!< Match TCP destination port */
+    MSS_MAC_FLOW_ETHERTYPE     = 2, /*!< Match Ethertype */
+    MSS_MAC_FLOW_VLAN_PRIORITY = 3, /*!< Match VLAN priority */
+} mss_mac_flow_type_t;
+
+/***************************************************************************//**
+ * Receive flow steering rule structure.
+ *
+ * This structure is used with the _MSS_MAC_add_flow_rule()_ function to route
+ * a class of received packets to a particular queue.
+ */
+typedef struct mss_mac_flow_rule mss_mac_flow_rule_t;
+struct mss_mac_flow_rule
+{
+    mss_mac_flow_type_t type;     /*!< Packet field to match */
+    uint16_t            value;    /*!< Port number, Ethertype or VLAN priority to match */
+    uint8_t             queue_no; /*!< Queue to send matching packets to */
+};
+
 /***************************************************************************//**
  * Media Merge Sublayer configuration structure.
  *
@@ -1223,6 +1343,29 @@ struct mss_mac_tx_pkt_info
 };
 
 
+/***************************************************************************//**
+ * Transmit fragment structure
+ *
+ * This structure is used with the _MSS_MAC_send_pkt_sg()_ function to describe
+ * one of the buffers that make up a packet. Each fragment is assigned its own
+ * transmit descriptor so the packet does not need to be copied into a single
+ * contiguous buffer first.
+ */
+typedef struct mss_mac_tx_frag mss_mac_tx_frag_t;
+
+struct mss_mac_tx_frag
+{
+    uint8_t const *tx_buffer; /*!< Pointer to fragment data */
+    uint32_t       length;    /*!< Length of this fragment */
+};
+
+
+/***************************************************************************//**
+ * Size of the L2 cache line. Descriptor rings and buffers allocated by the
+ * driver are aligned to this so that no line is shared with other data.
+ */
+#define MSS_MAC_CACHE_LINE_SIZE (64U)
+
 /***************************************************************************//**
  * Per queue specific info for device management structure.
  *
@@ -1234,20 +1377,26 @@ typedef struct mss_mac_queue
 #if defined(MSS_MAC_USE_DDR)
     mss_mac_tx_desc_t            *tx_desc_tab;  /*!< Transmit descriptor table */
 #else
-    mss_mac_tx_desc_t            tx_desc_tab[MSS_MAC_TX_RING_SIZE];  /*!< Transmit descriptor table */
+    mss_mac_tx_desc_t            tx_desc_tab[MSS_MAC_TX_RING_SIZE] __attribute__((aligned(MSS_MAC_CACHE_LINE_SIZE)));  /*!< Transmit descriptor table */
 #endif
 
 #if defined(MSS_MAC_USE_DDR)
     mss_mac_rx_desc_t            *rx_desc_tab;  /*!< Receive descriptor table */
 #else
-    mss_mac_rx_desc_t            rx_desc_tab[MSS_MAC_RX_RING_SIZE];  /*!< Receive descriptor table */
+    mss_mac_rx_desc_t            rx_desc_tab[MSS_MAC_RX_RING_SIZE] __attribute__((aligned(MSS_MAC_CACHE_LINE_SIZE)));  /*!< Receive descriptor table */
 #endif
     void                        *tx_caller_info[MSS_MAC_TX_RING_SIZE]; /*!< Pointers to tx user specific data */
     void                        *rx_caller_info[MSS_MAC_RX_RING_SIZE]; /*!< Pointers to rx user specific data */
     mss_mac_transmit_callback_t  pckt_tx_callback; /*!< Pointer to transmit handler call back function */
     mss_mac_receive_callback_t   pckt_rx_callback; /*!< Pointer to receive handler call back function */
+    mss_mac_rx_poll_callback_t   rx_poll_callback; /*!< Pointer to receive poll schedule call back function, NULL for interrupt mode */
+    uint32_t                     rx_poll_budget; /*!< Maximum packets processed per _MSS_MAC_rx_poll()_ call */
+    volatile uint32_t            rx_poll_scheduled; /*!< Set while receive interrupts are masked awaiting _MSS_MAC_rx_poll()_ */
+    uint32_t                     irq_hart; /*!< Hart the queue interrupt is routed to or MSS_MAC_IRQ_HART_LOCAL */
     volatile uint32_t            nb_available_tx_desc; /*!< Number of free TX descriptors available */
     volatile uint32_t            current_tx_desc; /*!< Oldest in the queue... */
+    volatile uint32_t            next_free_tx_desc_index; /*!< Next TX descriptor to allocate in ring mode */
+    uint32_t                     tx_ring_mode; /*!< Set once _MSS_MAC_send_pkt_sg()_ has switched the queue to ring mode */
     volatile uint32_t            nb_available_rx_desc; /*!< Number of free RX descriptors available */
     volatile uint32_t            next_free_rx_desc_index; /*!< Next RX descriptor to allocate */
     volatile uint32_t            first_rx_desc_index; /*!< Descriptor to process next when receive handler called */
@@ -1275,6 +1424,9 @@ typedef struct mss_mac_queue
     volatile uint64_t tx_amba_errors; /*!< Number of receive amba error events on this queue */
     volatile uint64_t tx_restart; /*!< Number of times transmission has been restarted on this queue */
     volatile uint64_t tx_reenable; /*!< Number of times transmission has been reenabled on this queue */
+    volatile uint64_t rx_polls; /*!< Number of _MSS_MAC_rx_poll()_ calls on this queue */
+    volatile uint64_t rx_poll_exhausted; /*!< Number of polls which used their full budget on this queue */
+    volatile uint64_t rx_poll_rearms; /*!< Number of times receive interrupts have been re-enabled after polling on this queue */
 } mss_mac_queue_t;
 
 
@@ -1302,10 +1454,16 @@ typedef struct mss_mac_instance
     uint32_t          rx_discard; /*!< Flag for discarding all received data */
     volatile uint32_t mac_available; /*!< Flag to show init is done and MAC and PHY can be used */
 
+    uint32_t          flow_type_1_used;    /*!< Type 1 Filters allocated by _MSS_MAC_add_flow_rule()_, one bit each */
+    uint32_t          flow_type_2_used;    /*!< Type 2 Filters allocated by _MSS_MAC_add_flow_rule()_, one bit each */
+    uint32_t          flow_ethertype_used; /*!< Ethertype registers allocated by _MSS_MAC_add_flow_rule()_, one bit each */
+    uint32_t          flow_compare_used;   /*!< Type 2 Comparers allocated by _MSS_MAC_add_flow_rule()_, one bit each */
+
     /* These are set from the cfg structure */
 
     uint32_t jumbo_frame_enable;        /*!< Enable / disable jumbo frame support: */
     uint32_t append_CRC;                /*!< Enable / disable GEM CRC calculation */
+    uint32_t rx_checksum_offload;       /*!< Enable / disable receive checksum checking */
     uint32_t interface_type;            /*!< Type of network interface associated with this GEM */
     uint32_t phy_type;                  /*!< PHY device type associated with this GEM */
     uint32_t phy_addr;                  /*!< Address of Ethernet PHY on MII management interface. */
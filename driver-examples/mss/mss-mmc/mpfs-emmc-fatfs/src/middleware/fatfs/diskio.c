@@ -18,6 +18,8 @@ or PHY_DRIV_USB in discio.h file."
 or PHY_DRIV_USB in discio.h file."
 #endif
 
+#include "diskio_cache.h"
+
 #ifdef PHY_DRIV_MMC
 #include "mmc_di_if.h"
 #endif /* PHY_DRIV_MMC */
@@ -25,6 +27,25 @@ or PHY_DRIV_USB in discio.h file."
 /* Disk status */
 volatile DSTATUS Stat = STA_NOINIT;
 
+#ifdef PHY_DRIV_MMC
+static DRESULT mmc_device_read(BYTE *buff, DWORD sector, UINT count)
+{
+    return mmc_di_if_read(sector, buff, count);
+}
+
+static DRESULT mmc_device_write(const BYTE *buff, DWORD sector, UINT count)
+{
+    return mmc_di_if_write(buff, sector, count);
+}
+
+/* Device behind the sector cache */
+static const disk_cache_device_t g_cache_device =
+{
+    mmc_device_read,
+    mmc_device_write
+};
+#endif /* PHY_DRIV_MMC */
+
 /*-----------------------------------------------------------------------*/
 /* Inidialize a Drive                                                    */
 /*-----------------------------------------------------------------------*/
@@ -37,6 +58,12 @@ DSTATUS disk_initialize(BYTE pdrv /* Physical drive number (0..) */
 
     tempStatus = mmc_di_if_init();
 
+    /* Anything written before a repeated initialisation is written back */
+    if ((0u == tempStatus) && (RES_OK != disk_cache_init(&g_cache_device)))
+    {
+        tempStatus = STA_NOINIT;
+    }
+
 #endif
 
 #ifdef PHY_DRIV_USB
@@ -66,7 +93,7 @@ DSTATUS disk_status(BYTE drv /* Physical drive number (0..) */
 DRESULT disk_read(BYTE drv,     /* Physical drive number (0..) */
                   BYTE *buff,   /* Data buffer to store read data */
                   DWORD sector, /* Sector address (LBA) */
-                  BYTE count    /* Number of sectors to read (1..255) */
+                  UINT count    /* Number of sectors to read (1..) */
 )
 {
     DRESULT read_result = RES_ERROR;
@@ -76,7 +103,7 @@ DRESULT disk_read(BYTE drv,     /* Physical drive number (0..) */
 
 #ifdef PHY_DRIV_MMC
 
-        read_result = mmc_di_if_read(sector, buff, count);
+        read_result = disk_cache_read(buff, sector, count);
 
 #endif
 
@@ -101,7 +128,7 @@ DRESULT disk_read(BYTE drv,     /* Physical drive number (0..) */
 DRESULT disk_write(BYTE pdrv,        /* Physical drive number (0..) */
                    const BYTE *buff, /* Data to be written */
                    DWORD sector,     /* Sector address (LBA) */
-                   BYTE count        /* Number of sectors to write (1..255) */
+                   UINT count        /* Number of sectors to write (1..) */
 )
 {
     DRESULT write_result = RES_ERROR;
@@ -111,7 +138,7 @@ DRESULT disk_write(BYTE pdrv,        /* Physical drive number (0..) */
 
 #ifdef PHY_DRIV_MMC
 
-        write_result = mmc_di_if_write(buff, sector, (count * 512));
+        write_result = disk_cache_write(buff, sector, count);
 
 #endif
 
@@ -136,6 +163,7 @@ DRESULT disk_ioctl(BYTE pdrv, /* Physical drive number (0..) */
                    void *buff /* Buffer to send/receive control data */
 )
 {
+    DRESULT ioctl_result = RES_OK;
 
     if (0u == pdrv)
     {
@@ -145,6 +173,9 @@ DRESULT disk_ioctl(BYTE pdrv, /* Physical drive number (0..) */
 
         case CTRL_SYNC:
 
+            /* Write back the sectors held dirty in the cache */
+            ioctl_result = disk_cache_flush();
+
             break;
 
         case CTRL_POWER:
@@ -214,7 +245,7 @@ DRESULT disk_ioctl(BYTE pdrv, /* Physical drive number (0..) */
         }
     }
 
-    return (DRESULT)0;
+    return ioctl_result;
 }
 
 
@@ -1078,6 +1078,27 @@ DWORD clmt_clust (	/* <2:Error, >=2:Cluster number */
 	}
 	return cl + *tbl;	/* Return the cluster number */
 }
+
+
+static
+DWORD clmt_sects (	/* 0:Error, >0:Sectors up to the end of the fragment */
+	FIL* fp,		/* Pointer to the file object */
+	DWORD ofs		/* File offset on a sector boundary */
+)
+{
+	DWORD cl, ncl, *tbl;
+
+
+	tbl = fp->cltbl + 1;	/* Top of CLMT */
+	cl = ofs / SS(fp->fs) / fp->fs->csize;	/* Cluster order from top of the file */
+	for (;;) {
+		ncl = *tbl++;			/* Number of cluters in the fragment */
+		if (!ncl) return 0;		/* End of table? (error) */
+		if (cl < ncl) break;	/* In this fragment? */
+		cl -= ncl; tbl++;		/* Next fragment */
+	}
+	return (ncl - cl) * fp->fs->csize - (ofs / SS(fp->fs) & (fp->fs->csize - 1));
+}
 #endif	/* _USE_FASTSEEK */
 
 
@@ -2458,6 +2479,9 @@ FRESULT f_read (
 	FRESULT res;
 	DWORD clst, sect, remain;
 	UINT rcnt, cc;
+#if _USE_FASTSEEK
+	DWORD fcc;
+#endif
 	BYTE csect, *rbuff = (BYTE*)buff;
 
 
@@ -2496,10 +2520,19 @@ FRESULT f_read (
 			sect += csect;
 			cc = btr / SS(fp->fs);				/* When remaining bytes >= sector size, */
 			if (cc) {							/* Read maximum contiguous sectors directly */
+#if _USE_FASTSEEK
+				fcc = fp->cltbl ? clmt_sects(fp, fp->fptr) : 0;
+				if (fcc) {						/* Clip at the end of the contiguous fragment */
+					if (cc > fcc) cc = fcc;
+				} else
+#endif
 				if (csect + cc > fp->fs->csize)	/* Clip at cluster boundary */
 					cc = fp->fs->csize - csect;
-				if (disk_read(fp->fs->drv, rbuff, sect, (BYTE)cc) != RES_OK)
+				if (disk_read(fp->fs->drv, rbuff, sect, cc) != RES_OK)
 					ABORT(fp->fs, FR_DISK_ERR);
+#if _USE_FASTSEEK
+				fp->clust += (csect + cc - 1) / fp->fs->csize;	/* Last cluster read */
+#endif
 #if !_FS_READONLY && _FS_MINIMIZE <= 2			/* Replace one of the read sectors with cached data if it contains a dirty sector */
 #if _FS_TINY
 				if (fp->fs->wflag && fp->fs->winsect - sect < cc)
@@ -2559,6 +2592,9 @@ FRESULT f_write (
 	FRESULT res;
 	DWORD clst, sect;
 	UINT wcnt, cc;
+#if _USE_FASTSEEK
+	DWORD fcc;
+#endif
 	const BYTE *wbuff = (const BYTE*)buff;
 	BYTE csect;
 
@@ -2610,10 +2646,19 @@ FRESULT f_write (
 			sect += csect;
 			cc = btw / SS(fp->fs);			/* When remaining bytes >= sector size, */
 			if (cc) {						/* Write maximum contiguous sectors directly */
+#if _USE_FASTSEEK
+				fcc = fp->cltbl ? clmt_sects(fp, fp->fptr) : 0;
+				if (fcc) {					/* Clip at the end of the contiguous fragment */
+					if (cc > fcc) cc = fcc;
+				} else
+#endif
 				if (csect + cc > fp->fs->csize)	/* Clip at cluster boundary */
 					cc = fp->fs->csize - csect;
-				if (disk_write(fp->fs->drv, wbuff, sect, (BYTE)cc) != RES_OK)
+				if (disk_write(fp->fs->drv, wbuff, sect, cc) != RES_OK)
 					ABORT(fp->fs, FR_DISK_ERR);
+#if _USE_FASTSEEK
+				fp->clust += (csect + cc - 1) / fp->fs->csize;	/* Last cluster written */
+#endif
 #if _FS_TINY
 				if (fp->fs->winsect - sect < cc) {	/* Refill sector cache if it gets invalidated by the direct write */
 					mem_cpy(fp->fs->win, wbuff + ((fp->fs->winsect - sect) * SS(fp->fs)), SS(fp->fs));
@@ -3800,6 +3845,80 @@ FRESULT f_forward (
 
 
 
+#if _USE_EXPAND && !_FS_READONLY
+/*-----------------------------------------------------------------------*/
+/* Allocate a Contiguous Blocks to the File                              */
+/*-----------------------------------------------------------------------*/
+
+FRESULT f_expand (
+	FIL* fp,		/* Pointer to the file object */
+	DWORD fsz,		/* File size to be expanded to */
+	BYTE opt		/* Operation mode 0:Find and prepare or 1:Find and allocate */
+)
+{
+	FRESULT res;
+	FATFS *fs;
+	DWORD n, clst, stcl, scl, ncl, tcl, lclst;
+
+
+	res = validate(fp);						/* Check validity of the object */
+	if (res != FR_OK) LEAVE_FF(fp->fs, res);
+	if (fp->flag & FA__ERROR)				/* Check abort flag */
+		LEAVE_FF(fp->fs, FR_INT_ERR);
+	if (fsz == 0 || fp->fsize != 0 || !(fp->flag & FA_WRITE))
+		LEAVE_FF(fp->fs, FR_DENIED);
+	fs = fp->fs;
+	n = (DWORD)fs->csize * SS(fs);			/* Cluster size */
+	tcl = fsz / n + ((fsz % n) ? 1 : 0);	/* Number of clusters required */
+	stcl = fs->last_clust; lclst = 0;
+	if (stcl < 2 || stcl >= fs->n_fatent) stcl = 2;
+
+	scl = clst = stcl; ncl = 0;
+	for (;;) {	/* Find a contiguous cluster block */
+		n = get_fat(fs, clst);
+		if (n == 1) { res = FR_INT_ERR; break; }
+		if (n == 0xFFFFFFFF) { res = FR_DISK_ERR; break; }
+		if (n == 0) {	/* Is it a free cluster? */
+			if (++ncl == tcl) break;	/* Break if a contiguous cluster block is found */
+		} else {
+			scl = clst + 1; ncl = 0;	/* Not a free cluster */
+		}
+		if (++clst >= fs->n_fatent) {	/* A block cannot wrap around the end of the FAT */
+			clst = scl = 2; ncl = 0;
+		}
+		if (clst == stcl) { res = FR_DENIED; break; }	/* No contiguous cluster? */
+	}
+	if (res == FR_OK) {	/* A contiguous free area is found */
+		if (opt) {		/* Allocate it now */
+			for (clst = scl, n = tcl; n; clst++, n--) {	/* Create a cluster chain on the FAT */
+				res = put_fat(fs, clst, (n == 1) ? 0x0FFFFFFF : clst + 1);
+				if (res != FR_OK) break;
+				lclst = clst;
+			}
+		} else {		/* Set it as suggested point for next allocation */
+			lclst = scl - 1;
+		}
+	}
+
+	if (res == FR_OK) {
+		fs->last_clust = lclst;		/* Set suggested start cluster to start next */
+		if (opt) {	/* Is it allocated now? */
+			fp->sclust = scl;		/* Update object allocation information */
+			fp->fsize = fsz;
+			fp->flag |= FA__WRITTEN;
+			if (fs->free_clust != 0xFFFFFFFF) {	/* Update FSINFO */
+				fs->free_clust -= tcl;
+				fs->fsi_flag = 1;
+			}
+		}
+	}
+
+	LEAVE_FF(fs, res);
+}
+#endif /* _USE_EXPAND && !_FS_READONLY */
+
+
+
 #if _USE_MKFS && !_FS_READONLY
 /*-----------------------------------------------------------------------*/
 /* Create File System on the Drive                                       */
@@ -0,0 +1,176 @@
+/*******************************************************************************
+ * Copyright 2022 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Opens files in FatFs fast seek mode, with the cluster link map built
+ * automatically, and creates files in one contiguous block.
+ *
+ */
+
+/*-------------------------- Header file section -----------------------------*/
+#include "ff_stream.h"
+#include <stddef.h>
+
+#if _USE_FASTSEEK
+/*-------------------------- Local definition section ------------------------*/
+/* Sector size of a volume, as in ff.c */
+#if _MAX_SS != 512
+#define SS(fs)  ((fs)->ssize)
+#else
+#define SS(fs)  512U
+#endif
+
+/*------------------------ Local function declaration section ----------------*/
+static FRESULT ff_stream_map(FIL *fp, DWORD *clmt, UINT clmt_items);
+
+/*------------------------- Local function definition section ----------------*/
+/*
+ * Builds the cluster link map of an open file. Leaves the file in normal seek
+ * mode if the map does not fit or the file has no clusters.
+ */
+static FRESULT ff_stream_map(FIL *fp, DWORD *clmt, UINT clmt_items)
+{
+    FRESULT result;
+
+    if ((NULL == clmt) || (clmt_items < FF_STREAM_CLMT_ITEMS(1u)) ||
+        (0u == fp->sclust))
+    {
+        return FR_OK;
+    }
+
+    fp->cltbl = clmt;
+    clmt[0] = clmt_items;
+    result = f_lseek(fp, CREATE_LINKMAP);
+
+    if (FR_NOT_ENOUGH_CORE == result)
+    {
+        /* Too many fragments, follow the FAT instead */
+        result = FR_OK;
+        fp->cltbl = NULL;
+    }
+    else if (FR_OK != result)
+    {
+        fp->cltbl = NULL;
+    }
+
+    return result;
+}
+
+/*------------------------ Global function definition section ----------------*/
+FRESULT ff_stream_open(FIL *fp, const TCHAR *path, BYTE mode, DWORD *clmt,
+                       UINT clmt_items)
+{
+    FRESULT result = f_open(fp, path, mode);
+
+    if (FR_OK == result)
+    {
+        result = ff_stream_map(fp, clmt, clmt_items);
+        if (FR_OK != result)
+        {
+            (void)f_close(fp);
+        }
+    }
+
+    return result;
+}
+
+#if _USE_EXPAND && (_FS_MINIMIZE == 0)
+FRESULT ff_stream_create(FIL *fp, const TCHAR *path, DWORD size, DWORD *clmt,
+                         UINT clmt_items)
+{
+    FRESULT result = f_open(fp, path, FA_CREATE_ALWAYS | FA_WRITE | FA_READ);
+
+    if (FR_OK != result)
+    {
+        return result;
+    }
+
+    result = f_expand(fp, size, 1u);
+    if (FR_OK == result)
+    {
+        /* Write the chain and the directory entry now rather than when the
+         * file is closed */
+        result = f_sync(fp);
+    }
+    if (FR_OK == result)
+    {
+        result = ff_stream_map(fp, clmt, clmt_items);
+    }
+
+    if (FR_OK != result)
+    {
+        (void)f_close(fp);
+        (void)f_unlink(path);
+    }
+
+    return result;
+}
+
+FRESULT ff_stream_finish(FIL *fp, DWORD size)
+{
+    FRESULT result = FR_INVALID_PARAMETER;
+    FRESULT close_result;
+
+    if (size <= fp->fsize)
+    {
+        result = f_lseek(fp, size);
+        if (FR_OK == result)
+        {
+            result = f_truncate(fp);
+        }
+    }
+
+    close_result = f_close(fp);
+
+    return (FR_OK != result) ? result : close_result;
+}
+#endif /* _USE_EXPAND && (_FS_MINIMIZE == 0) */
+
+DWORD ff_stream_sector(const FIL *fp, DWORD ofs, DWORD *count)
+{
+    const DWORD *tbl;
+    DWORD cluster;
+    DWORD sector;
+    DWORD left;
+
+    if ((NULL == fp->cltbl) || (ofs >= fp->fsize))
+    {
+        return 0u;
+    }
+
+    tbl = fp->cltbl + 1;
+    cluster = ofs / SS(fp->fs) / fp->fs->csize;
+    sector = ofs / SS(fp->fs) % fp->fs->csize;
+
+    /* Each fragment is a length and a start cluster, ended by a 0 length */
+    while (0u != tbl[0])
+    {
+        if (cluster < tbl[0])
+        {
+            if (NULL != count)
+            {
+                *count = ((tbl[0] - cluster) * fp->fs->csize) - sector;
+
+                /* Sectors of the file from ofs on */
+                left = (DWORD)(((fp->fsize - 1u) / SS(fp->fs)) -
+                               (ofs / SS(fp->fs)) + 1u);
+                if (*count > left)
+                {
+                    *count = left;
+                }
+            }
+
+            return fp->fs->database +
+                   ((tbl[1] + cluster - 2u) * fp->fs->csize) + sector;
+        }
+
+        cluster -= tbl[0];
+        tbl += 2;
+    }
+
+    return 0u;
+}
+#endif /* _USE_FASTSEEK */
+
+/* End of file */
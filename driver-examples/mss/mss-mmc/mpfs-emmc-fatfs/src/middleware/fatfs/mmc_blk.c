@@ -0,0 +1,399 @@
+/*******************************************************************************
+ * Copyright 2022 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Asynchronous block request layer for the eMMC command queue.
+ *
+ * Submitted requests wait in a FIFO. Whenever the device is idle the queue is
+ * turned into one batch of command queue tasks, which are all started with one
+ * doorbell so that the device can use its internal parallelism. A request
+ * which continues the sectors and the buffer of a task already in the batch is
+ * merged into that task. The next batch is started from the completion
+ * interrupt of the previous one.
+ *
+ */
+
+/*-------------------------- Header file section -----------------------------*/
+#include "drivers/mss/mss_mmc/mss_mmc.h"
+#include "mmc_blk.h"
+#include "mmc_di_if.h"
+#include "mpfs_hal/mss_hal.h"
+
+#ifdef PHY_DRIV_MMC
+/*-------------------------- Local variable section --------------------------*/
+static mmc_blk_request_t *g_queue_head = NULL;
+static mmc_blk_request_t *g_queue_tail = NULL;
+
+/* Requests in the batch the device is working on */
+static mmc_blk_request_t *g_active = NULL;
+
+static mss_mmc_cq_task_t g_tasks[MMC_BLK_MAX_TASKS];
+static mmc_blk_stats_t g_stats;
+
+/* Taken with the local interrupts disabled, as clients may be on any hart */
+static volatile long g_lock = 0;
+
+/*------------------------ Local function declaration section ----------------*/
+static uint64_t mmc_blk_lock(void);
+static void mmc_blk_unlock(uint64_t saved_psr);
+static uint8_t mmc_blk_conflicts(const mmc_blk_request_t *request);
+static uint8_t mmc_blk_add_to_batch(mmc_blk_request_t *request,
+                                    uint8_t *task_count);
+static mmc_blk_request_t *mmc_blk_start_batch(void);
+static void mmc_blk_complete(mmc_blk_request_t *done, DRESULT result,
+                             uint8_t in_isr);
+static void mmc_blk_complete_handler(uint32_t status);
+
+/*------------------------- Local function definition section ----------------*/
+static uint64_t mmc_blk_lock(void)
+{
+    uint64_t saved_psr = disable_interrupts();
+
+    while (0 != __sync_lock_test_and_set(&g_lock, 1))
+    {
+        ;
+    }
+
+    return saved_psr;
+}
+
+static void mmc_blk_unlock(uint64_t saved_psr)
+{
+    __sync_lock_release(&g_lock);
+    restore_interrupts(saved_psr);
+}
+
+/*
+ * The device may run the tasks of a batch in any order, so a request may only
+ * join the batch if it does not overlap a request already in it where either
+ * of them writes.
+ */
+static uint8_t mmc_blk_conflicts(const mmc_blk_request_t *request)
+{
+    const mmc_blk_request_t *other;
+
+    for (other = g_active; NULL != other; other = other->next)
+    {
+        if (((0u != request->write) || (0u != other->write)) &&
+            (request->sector < (other->sector + other->count)) &&
+            (other->sector < (request->sector + request->count)))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/*
+ * Adds a request to the batch being built, extending a task which ends where
+ * the request starts, both on the device and in memory, or using new tasks.
+ * Returns false if the batch has no room for it.
+ */
+static uint8_t mmc_blk_add_to_batch(mmc_blk_request_t *request,
+                                    uint8_t *task_count)
+{
+    mss_mmc_cq_task_t *task;
+    UINT remaining = request->count;
+    BYTE *buffer = request->buffer;
+    DWORD sector = request->sector;
+    UINT sectors;
+    uint8_t index;
+
+    for (index = 0u; index < *task_count; index++)
+    {
+        task = &g_tasks[index];
+        if ((task->write == request->write) &&
+            ((task->sector + (task->size / DISCIO_DRIV_MMC_SECTOR_SIZE)) ==
+             request->sector) &&
+            ((task->buffer + task->size) == request->buffer) &&
+            ((task->size + (request->count * DISCIO_DRIV_MMC_SECTOR_SIZE)) <=
+             MSS_MMC_CQ_MAX_TASK_SIZE))
+        {
+            task->size += request->count * DISCIO_DRIV_MMC_SECTOR_SIZE;
+            g_stats.merged++;
+            return true;
+        }
+    }
+
+    if ((*task_count + ((remaining + MMC_BLK_TASK_SECTORS - 1u) /
+                        MMC_BLK_TASK_SECTORS)) > MMC_BLK_MAX_TASKS)
+    {
+        return false;
+    }
+
+    while (0u != remaining)
+    {
+        sectors = (remaining > MMC_BLK_TASK_SECTORS) ?
+                  MMC_BLK_TASK_SECTORS : remaining;
+
+        task = &g_tasks[*task_count];
+        task->buffer = buffer;
+        task->sector = sector;
+        task->size = sectors * DISCIO_DRIV_MMC_SECTOR_SIZE;
+        task->write = request->write;
+        (*task_count)++;
+
+        buffer += task->size;
+        sector += sectors;
+        remaining -= sectors;
+    }
+
+    return true;
+}
+
+/*
+ * Moves requests from the head of the queue into a new batch and starts it.
+ * Stops at the first request which does not fit, so that a request is never
+ * overtaken by a later one it conflicts with. Called with the lock held.
+ * Returns the requests of a batch which failed to start, to be completed by
+ * the caller once the lock is released.
+ */
+static mmc_blk_request_t *mmc_blk_start_batch(void)
+{
+    mmc_blk_request_t *request;
+    mmc_blk_request_t *active_tail = NULL;
+    mmc_blk_request_t *failed = NULL;
+    mss_mmc_status_t mmc_status;
+    uint8_t task_count = 0u;
+
+    if ((NULL != g_active) || (NULL == g_queue_head))
+    {
+        return NULL;
+    }
+
+    while (NULL != g_queue_head)
+    {
+        request = g_queue_head;
+        if ((true == mmc_blk_conflicts(request)) ||
+            (false == mmc_blk_add_to_batch(request, &task_count)))
+        {
+            break;
+        }
+
+        g_queue_head = request->next;
+        request->next = NULL;
+        request->state = MMC_BLK_ACTIVE;
+        if (NULL == active_tail)
+        {
+            g_active = request;
+        }
+        else
+        {
+            active_tail->next = request;
+        }
+        active_tail = request;
+    }
+
+    if (NULL == g_queue_head)
+    {
+        g_queue_tail = NULL;
+    }
+
+    mmc_status = MSS_MMC_cq_submit(g_tasks, task_count);
+    if (MSS_MMC_TRANSFER_IN_PROGRESS == mmc_status)
+    {
+        g_stats.tasks += task_count;
+        g_stats.batches++;
+    }
+    else
+    {
+        g_stats.errors++;
+        failed = g_active;
+        g_active = NULL;
+    }
+
+    return failed;
+}
+
+/*
+ * Sets the result of completed requests and tells their owners. Called
+ * without the lock held, from the MMC interrupt if in_isr is set.
+ */
+static void mmc_blk_complete(mmc_blk_request_t *done, DRESULT result,
+                             uint8_t in_isr)
+{
+    mmc_blk_request_t *request;
+#if defined(USING_FREERTOS)
+    BaseType_t higher_priority_task_woken = pdFALSE;
+#endif
+
+    while (NULL != done)
+    {
+        request = done;
+        done = request->next;
+        request->next = NULL;
+        request->result = result;
+        __sync_synchronize();
+        request->state = MMC_BLK_DONE;
+
+#if defined(USING_FREERTOS)
+        if (NULL != request->waiter)
+        {
+            if (true == in_isr)
+            {
+                vTaskNotifyGiveFromISR(request->waiter,
+                                       &higher_priority_task_woken);
+            }
+            else
+            {
+                (void)xTaskNotifyGive(request->waiter);
+            }
+        }
+#endif
+        if (NULL != request->callback)
+        {
+            request->callback(request);
+        }
+    }
+
+#if defined(USING_FREERTOS)
+    if (true == in_isr)
+    {
+        portYIELD_FROM_ISR(higher_priority_task_woken);
+    }
+#else
+    (void)in_isr;
+#endif
+}
+
+/*
+ * Called by the MMC driver from the MMC interrupt when a batch completes or
+ * fails. Starts the next batch before completing the requests, so that the
+ * device is kept busy while the callbacks run.
+ */
+static void mmc_blk_complete_handler(uint32_t status)
+{
+    mmc_blk_request_t *done;
+    mmc_blk_request_t *failed;
+    uint64_t saved_psr;
+    DRESULT result;
+
+    (void)status;
+
+    result = (MSS_MMC_TRANSFER_SUCCESS == MSS_MMC_get_transfer_status())
+             ? RES_OK : RES_ERROR;
+
+    saved_psr = mmc_blk_lock();
+    done = g_active;
+    g_active = NULL;
+    if (RES_OK != result)
+    {
+        g_stats.errors++;
+    }
+    failed = mmc_blk_start_batch();
+    mmc_blk_unlock(saved_psr);
+
+    mmc_blk_complete(done, result, true);
+    mmc_blk_complete(failed, RES_ERROR, true);
+}
+
+/*------------------------ Global function definition section ----------------*/
+DSTATUS mmc_blk_init(void)
+{
+    if (MSS_MMC_INIT_SUCCESS != MSS_MMC_cq_init())
+    {
+        return STA_NOINIT;
+    }
+
+    MSS_MMC_set_handler(mmc_blk_complete_handler);
+
+    return 0u;
+}
+
+DRESULT mmc_blk_submit(mmc_blk_request_t *request)
+{
+    mmc_blk_request_t *failed;
+    uint64_t saved_psr;
+
+    if ((NULL == request) || (NULL == request->buffer) ||
+        (0u == request->count) || (request->count > MMC_BLK_MAX_SECTORS))
+    {
+        return RES_PARERR;
+    }
+
+    request->state = MMC_BLK_QUEUED;
+    request->result = RES_OK;
+    request->next = NULL;
+#if defined(USING_FREERTOS)
+    request->waiter = NULL;
+#endif
+
+    saved_psr = mmc_blk_lock();
+    g_stats.requests++;
+    if (NULL == g_queue_tail)
+    {
+        g_queue_head = request;
+    }
+    else
+    {
+        g_queue_tail->next = request;
+    }
+    g_queue_tail = request;
+    failed = mmc_blk_start_batch();
+    mmc_blk_unlock(saved_psr);
+
+    mmc_blk_complete(failed, RES_ERROR, false);
+
+    return RES_OK;
+}
+
+DRESULT mmc_blk_wait(mmc_blk_request_t *request)
+{
+#if defined(USING_FREERTOS)
+    request->waiter = xTaskGetCurrentTaskHandle();
+    while (MMC_BLK_DONE != request->state)
+    {
+        (void)ulTaskNotifyTake(pdTRUE, MMC_BLK_WAIT_TICKS);
+    }
+    request->waiter = NULL;
+#else
+    /*
+     * Interrupts are disabled while the state is checked so that the
+     * completion cannot slip in between the check and the WFI.
+     */
+    __disable_irq();
+    while (MMC_BLK_DONE != request->state)
+    {
+        __asm("wfi");
+        __enable_irq();
+        __disable_irq();
+    }
+    __enable_irq();
+#endif
+
+    request->state = MMC_BLK_IDLE;
+
+    return request->result;
+}
+
+DRESULT mmc_blk_transfer(BYTE *buff, DWORD sector, UINT count, BYTE write)
+{
+    mmc_blk_request_t request = {0};
+    DRESULT result;
+
+    request.buffer = buff;
+    request.sector = sector;
+    request.count = count;
+    request.write = write;
+
+    result = mmc_blk_submit(&request);
+    if (RES_OK == result)
+    {
+        result = mmc_blk_wait(&request);
+    }
+
+    return result;
+}
+
+void mmc_blk_get_stats(mmc_blk_stats_t *stats)
+{
+    uint64_t saved_psr = mmc_blk_lock();
+
+    *stats = g_stats;
+    mmc_blk_unlock(saved_psr);
+}
+
+#endif /* PHY_DRIV_MMC */
+/* End of file */
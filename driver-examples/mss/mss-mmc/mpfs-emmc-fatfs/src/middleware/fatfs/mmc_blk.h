@@ -0,0 +1,126 @@
+/*******************************************************************************
+ * Copyright 2022 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Asynchronous block request layer for the eMMC command queue. Requests from
+ * FatFs and other clients are queued, merged where they are adjacent and sent
+ * to the eMMC command queue engine in batches of tasks.
+ *
+ */
+#ifndef MMC_BLK_H
+#define MMC_BLK_H
+
+/*-------------------------- Header file section -----------------------------*/
+#include "diskio.h"
+#include <stdint.h>
+
+#if defined(USING_FREERTOS)
+#include "FreeRTOS.h"
+#include "task.h"
+#endif
+
+#ifdef PHY_DRIV_MMC
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* Command queue tasks sent to the device in one batch, at most
+ * MSS_MMC_CQ_MAX_TASKS */
+#ifndef MMC_BLK_MAX_TASKS
+#define MMC_BLK_MAX_TASKS           (16u)
+#endif
+
+/* Sectors moved by one task, 64KB */
+#define MMC_BLK_TASK_SECTORS        (128u)
+
+/* Largest request accepted by mmc_blk_submit() */
+#define MMC_BLK_MAX_SECTORS         (MMC_BLK_MAX_TASKS * MMC_BLK_TASK_SECTORS)
+
+#if defined(USING_FREERTOS)
+/* Longest a task blocks in mmc_blk_wait() before checking its request again */
+#define MMC_BLK_WAIT_TICKS          (pdMS_TO_TICKS(10u))
+#endif
+
+typedef enum
+{
+    MMC_BLK_IDLE,       /* not submitted, or completed and collected */
+    MMC_BLK_QUEUED,     /* waiting for a batch */
+    MMC_BLK_ACTIVE,     /* part of the batch the device is working on */
+    MMC_BLK_DONE        /* completed, result is valid */
+} mmc_blk_state_t;
+
+typedef struct mmc_blk_request mmc_blk_request_t;
+
+/* Called from the MMC interrupt when a request completes */
+typedef void (*mmc_blk_callback_t)(mmc_blk_request_t *request);
+
+/*
+ * A block request. The client fills in the fields down to context and keeps
+ * the request, and its buffer, untouched until it has completed. The buffer
+ * must be 4 byte aligned for the eMMC DMA.
+ */
+struct mmc_blk_request
+{
+    BYTE *buffer;
+    DWORD sector;
+    UINT count;                     /* sectors, 1 to MMC_BLK_MAX_SECTORS */
+    BYTE write;                     /* non-zero to write buffer to the device */
+    mmc_blk_callback_t callback;    /* may be NULL */
+    void *context;                  /* for the client's use */
+
+    /* Owned by the block layer */
+    volatile BYTE state;
+    volatile DRESULT result;
+#if defined(USING_FREERTOS)
+    TaskHandle_t waiter;
+#endif
+    mmc_blk_request_t *next;
+};
+
+/* Counters of the work done by the block layer */
+typedef struct
+{
+    uint32_t requests;              /* requests submitted */
+    uint32_t merged;                /* requests added to another's task */
+    uint32_t tasks;                 /* command queue tasks sent */
+    uint32_t batches;               /* doorbells rung */
+    uint32_t errors;                /* batches which failed */
+} mmc_blk_stats_t;
+
+/*----------------- Global function declaration section ----------------*/
+/*
+ * Enables the command queue of an initialised eMMC device and takes over the
+ * MMC transfer completion handler. Returns 0, or STA_NOINIT if the device or
+ * the host cannot use the command queue.
+ */
+DSTATUS mmc_blk_init(void);
+
+/*
+ * Queues a request and returns without waiting for it. Requests which do not
+ * overlap a queued write may be run in any order.
+ */
+DRESULT mmc_blk_submit(mmc_blk_request_t *request);
+
+/*
+ * Waits for a submitted request to complete and returns its result. Must be
+ * called on the hart which takes the MMC interrupt. The hart sleeps in WFI, or
+ * the task blocks under FreeRTOS, while it waits.
+ */
+DRESULT mmc_blk_wait(mmc_blk_request_t *request);
+
+/* Submits a request for count sectors and waits for it */
+DRESULT mmc_blk_transfer(BYTE *buff, DWORD sector, UINT count, BYTE write);
+
+/* Copies the block layer counters */
+void mmc_blk_get_stats(mmc_blk_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PHY_DRIV_MMC */
+
+#endif /* MMC_BLK_H */
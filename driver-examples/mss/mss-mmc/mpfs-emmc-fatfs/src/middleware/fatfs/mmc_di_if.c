@@ -13,15 +13,97 @@
 #include "drivers/mss/mss_mmc/mss_mmc_if.h"
 #include "drivers/mss/mss_mmc/mss_mmc_regs.h"
 #include "drivers/mss/mss_mmc/mss_mmc_types.h"
+#include "mmc_blk.h"
 #include "mmc_di_if.h"
 #include "mpfs_hal/mss_hal.h"
+#include <string.h>
+
+#if defined(USING_FREERTOS)
+#include "FreeRTOS.h"
+#include "semphr.h"
+#endif
 
 #ifdef PHY_DRIV_MMC
+
+#if (MMC_DI_IF_READAHEAD_SECTORS > MMC_BLK_MAX_SECTORS)
+#error "MMC_DI_IF_READAHEAD_SECTORS must not be larger than MMC_BLK_MAX_SECTORS"
+#endif
+
+/*-------------------------- Local type section ------------------------------*/
+/* A transfer waiting for the MMC completion interrupt */
+typedef struct
+{
+    volatile uint8_t complete;      /* set by the completion handler */
+    volatile uint32_t irq_status;   /* SRS12 passed to the completion handler */
+    volatile mss_mmc_status_t trs_status; /* driver state at completion */
+} mmc_di_if_request_t;
+
+#if (MMC_DI_IF_READAHEAD_SECTORS > 0u)
+typedef enum
+{
+    MMC_READAHEAD_EMPTY,
+    MMC_READAHEAD_LOADING,          /* read started, not yet collected */
+    MMC_READAHEAD_VALID
+} mmc_readahead_state_t;
+
+/* One of the two read-ahead buffers */
+typedef struct
+{
+    DWORD sector;                   /* first sector held or being read */
+    UINT count;
+    uint8_t state;
+    BYTE *data;
+    mmc_di_if_request_t request;    /* used by ADMA2 transfers */
+    mmc_blk_request_t blk_request;  /* used by command queue transfers */
+} mmc_readahead_t;
+#endif
+
 /*-------------------------- Local variable section --------------------------*/
 static uint8_t g_mmc_initialized = false;
 
+/* Set when transfers go through the command queue block layer */
+static uint8_t g_mmc_use_cq = false;
+
+/* The MMC controller runs one transfer at a time */
+static mmc_di_if_request_t * volatile g_active_request = NULL;
+
+#if defined(USING_FREERTOS)
+static SemaphoreHandle_t g_transfer_done = NULL;
+#endif
+
+#if (MMC_DI_IF_READAHEAD_SECTORS > 0u)
+static BYTE g_readahead_data[2][MMC_DI_IF_READAHEAD_SECTORS *
+                                DISCIO_DRIV_MMC_SECTOR_SIZE]
+    __attribute__((aligned(4)));
+static mmc_readahead_t g_readahead[2];
+
+/* Sector following the last read, and reads in a row which followed on */
+static DWORD g_next_sector = 0u;
+static uint32_t g_sequential_reads = 0u;
+#endif
+
 /*------------------------ Local function declaration section ----------------*/
 static void mmc_reset_block(void);
+static void mmc_transfer_complete_handler(uint32_t status);
+static mss_mmc_status_t mmc_wait_transfer(mmc_di_if_request_t *request);
+static mss_mmc_status_t mmc_start_transfer(mmc_di_if_request_t *request,
+                                           const BYTE *write_buff,
+                                           BYTE *read_buff,
+                                           DWORD sector, UINT count);
+static DRESULT mmc_finish_transfer(mmc_di_if_request_t *request,
+                                   mss_mmc_status_t mmc_status);
+static DRESULT mmc_run_transfer(const BYTE *write_buff, BYTE *read_buff,
+                                DWORD sector, UINT count);
+static DRESULT mmc_transfer_sectors(const BYTE *write_buff, BYTE *read_buff,
+                                    DWORD sector, UINT count);
+#if (MMC_DI_IF_READAHEAD_SECTORS > 0u)
+static void mmc_readahead_start(mmc_readahead_t *readahead, DWORD sector);
+static uint8_t mmc_readahead_collect(mmc_readahead_t *readahead);
+static mmc_readahead_t *mmc_readahead_find(DWORD sector);
+static void mmc_readahead_refill(const mmc_readahead_t *readahead);
+static void mmc_readahead_invalidate(DWORD sector, UINT count);
+static DRESULT mmc_readahead_read(BYTE *buff, DWORD sector, UINT count);
+#endif
 
 /*------------------------- Local function definition section ----------------*/
 /*This function will reset mmc block*/
@@ -32,6 +114,388 @@ static void mmc_reset_block(void)
     SYSREG->SOFT_RESET_CR &= ~(uint32_t)(SOFT_RESET_CR_MMC_MASK);
 }
 
+/*
+ * Called by the MMC driver from the MMC interrupt when a transfer completes or
+ * fails. Signals the request waiting in mmc_wait_transfer().
+ */
+static void mmc_transfer_complete_handler(uint32_t status)
+{
+    mmc_di_if_request_t *request = g_active_request;
+
+    if (NULL != request)
+    {
+        request->irq_status = status;
+        request->trs_status = MSS_MMC_get_transfer_status();
+        request->complete = true;
+        g_active_request = NULL;
+
+#if defined(USING_FREERTOS)
+        BaseType_t higher_priority_task_woken = pdFALSE;
+
+        (void)xSemaphoreGiveFromISR(g_transfer_done,
+                                    &higher_priority_task_woken);
+        portYIELD_FROM_ISR(higher_priority_task_woken);
+#endif
+    }
+}
+
+/*
+ * Waits for the transfer of request to complete, or for the controller to go
+ * idle if request is NULL. The hart sleeps in WFI, or the task blocks on a
+ * semaphore under FreeRTOS, until the MMC interrupt arrives. The driver state
+ * is also checked as some command errors end a transfer without calling the
+ * completion handler.
+ */
+static mss_mmc_status_t mmc_wait_transfer(mmc_di_if_request_t *request)
+{
+#if defined(USING_FREERTOS)
+    while (((NULL == request) || (false == request->complete)) &&
+           (MSS_MMC_TRANSFER_IN_PROGRESS == MSS_MMC_get_transfer_status()))
+    {
+        (void)xSemaphoreTake(g_transfer_done, MMC_DI_IF_WAIT_TICKS);
+    }
+#else
+    /*
+     * Interrupts are disabled while the state is checked so that the
+     * completion cannot slip in between the check and the WFI. A pending
+     * interrupt still ends the WFI and is taken once they are enabled again.
+     */
+    __disable_irq();
+    while (((NULL == request) || (false == request->complete)) &&
+           (MSS_MMC_TRANSFER_IN_PROGRESS == MSS_MMC_get_transfer_status()))
+    {
+        __asm("wfi");
+        __enable_irq();
+        __disable_irq();
+    }
+    __enable_irq();
+#endif
+
+    return MSS_MMC_get_transfer_status();
+}
+
+/*
+ * Starts an ADMA2 transfer of count sectors, at most
+ * MMC_DI_IF_ADMA2_MAX_SECTORS, once any earlier transfer has finished.
+ * Returns MSS_MMC_TRANSFER_IN_PROGRESS if the transfer was started.
+ */
+static mss_mmc_status_t mmc_start_transfer(mmc_di_if_request_t *request,
+                                           const BYTE *write_buff,
+                                           BYTE *read_buff,
+                                           DWORD sector, UINT count)
+{
+    mss_mmc_status_t mmc_status;
+    uint32_t size = (uint32_t)count * DISCIO_DRIV_MMC_SECTOR_SIZE;
+
+    /* Another transfer may still be using the controller */
+    (void)mmc_wait_transfer(NULL);
+
+    request->complete = false;
+    request->irq_status = 0u;
+    g_active_request = request;
+
+    if (NULL != write_buff)
+    {
+        mmc_status = MSS_MMC_adma2_write(write_buff, sector, size);
+    }
+    else
+    {
+        mmc_status = MSS_MMC_adma2_read(sector, read_buff, size);
+    }
+
+    if (MSS_MMC_TRANSFER_IN_PROGRESS != mmc_status)
+    {
+        g_active_request = NULL;
+    }
+
+    return mmc_status;
+}
+
+/*
+ * Waits for a transfer started by mmc_start_transfer() and returns RES_OK if
+ * the whole transfer completed without error. mmc_status is the value
+ * mmc_start_transfer() returned.
+ */
+static DRESULT mmc_finish_transfer(mmc_di_if_request_t *request,
+                                   mss_mmc_status_t mmc_status)
+{
+    if (MSS_MMC_TRANSFER_IN_PROGRESS == mmc_status)
+    {
+        mmc_status = mmc_wait_transfer(request);
+    }
+
+    if (g_active_request == request)
+    {
+        g_active_request = NULL;
+    }
+
+    if (true == request->complete)
+    {
+        mmc_status = (0u != (request->irq_status & SRS12_ERROR_INTERRUPT)) ?
+                     MSS_MMC_TRANSFER_FAIL : request->trs_status;
+    }
+
+    return (MSS_MMC_TRANSFER_SUCCESS == mmc_status) ? RES_OK : RES_ERROR;
+}
+
+/*
+ * Starts a transfer and waits for it to complete. Returns RES_OK if the whole
+ * transfer completed without error.
+ */
+static DRESULT mmc_run_transfer(const BYTE *write_buff, BYTE *read_buff,
+                                DWORD sector, UINT count)
+{
+    mmc_di_if_request_t request;
+
+    return mmc_finish_transfer(&request,
+                               mmc_start_transfer(&request, write_buff,
+                                                  read_buff, sector, count));
+}
+
+/*
+ * Transfers count sectors in as few transfers as the command queue or ADMA2
+ * path allows.
+ */
+static DRESULT mmc_transfer_sectors(const BYTE *write_buff, BYTE *read_buff,
+                                    DWORD sector, UINT count)
+{
+    DRESULT result = RES_OK;
+    UINT max_count = (true == g_mmc_use_cq) ? MMC_BLK_MAX_SECTORS :
+                     MMC_DI_IF_ADMA2_MAX_SECTORS;
+    UINT chunk;
+    uint32_t offset;
+
+    while ((0u != count) && (RES_OK == result))
+    {
+        chunk = (count > max_count) ? max_count : count;
+
+        if (true == g_mmc_use_cq)
+        {
+            result = mmc_blk_transfer((NULL != write_buff) ?
+                                      (BYTE *)write_buff : read_buff,
+                                      sector, chunk,
+                                      (NULL != write_buff) ? true : false);
+        }
+        else
+        {
+            result = mmc_run_transfer(write_buff, read_buff, sector, chunk);
+        }
+
+        offset = chunk * DISCIO_DRIV_MMC_SECTOR_SIZE;
+        if (NULL != write_buff)
+        {
+            write_buff += offset;
+        }
+        else
+        {
+            read_buff += offset;
+        }
+        sector += chunk;
+        count -= chunk;
+    }
+
+    return result;
+}
+
+#if (MMC_DI_IF_READAHEAD_SECTORS > 0u)
+/*
+ * Starts reading a read-ahead buffer from sector without waiting for it. The
+ * read is cut short at the end of the drive.
+ */
+static void mmc_readahead_start(mmc_readahead_t *readahead, DWORD sector)
+{
+    mss_mmc_status_t mmc_status;
+    UINT count = MMC_DI_IF_READAHEAD_SECTORS;
+
+    readahead->state = MMC_READAHEAD_EMPTY;
+    if (sector >= DISCIO_DRIV_MMC_SECTOR_COUNT)
+    {
+        return;
+    }
+    if ((DISCIO_DRIV_MMC_SECTOR_COUNT - sector) < count)
+    {
+        count = DISCIO_DRIV_MMC_SECTOR_COUNT - sector;
+    }
+
+    readahead->sector = sector;
+    readahead->count = count;
+
+    if (true == g_mmc_use_cq)
+    {
+        readahead->blk_request.buffer = readahead->data;
+        readahead->blk_request.sector = sector;
+        readahead->blk_request.count = count;
+        readahead->blk_request.write = false;
+        readahead->blk_request.callback = NULL;
+        if (RES_OK == mmc_blk_submit(&readahead->blk_request))
+        {
+            readahead->state = MMC_READAHEAD_LOADING;
+        }
+    }
+    else
+    {
+        mmc_status = mmc_start_transfer(&readahead->request, NULL,
+                                        readahead->data, sector, count);
+        if (MSS_MMC_TRANSFER_IN_PROGRESS == mmc_status)
+        {
+            readahead->state = MMC_READAHEAD_LOADING;
+        }
+    }
+}
+
+/*
+ * Waits for a read-ahead buffer being loaded. Returns true if the buffer
+ * holds valid data.
+ */
+static uint8_t mmc_readahead_collect(mmc_readahead_t *readahead)
+{
+    DRESULT result;
+
+    if (MMC_READAHEAD_LOADING == readahead->state)
+    {
+        if (true == g_mmc_use_cq)
+        {
+            result = mmc_blk_wait(&readahead->blk_request);
+        }
+        else
+        {
+            result = mmc_finish_transfer(&readahead->request,
+                                         MSS_MMC_TRANSFER_IN_PROGRESS);
+
+            /* Without the completion the driver state may belong to a later
+             * transfer */
+            if (false == readahead->request.complete)
+            {
+                result = RES_ERROR;
+            }
+        }
+
+        readahead->state = (RES_OK == result) ? MMC_READAHEAD_VALID :
+                           MMC_READAHEAD_EMPTY;
+    }
+
+    return (MMC_READAHEAD_VALID == readahead->state) ? true : false;
+}
+
+/* Returns the read-ahead buffer which holds or is loading sector */
+static mmc_readahead_t *mmc_readahead_find(DWORD sector)
+{
+    uint32_t index;
+
+    for (index = 0u; index < 2u; index++)
+    {
+        if ((MMC_READAHEAD_EMPTY != g_readahead[index].state) &&
+            (sector >= g_readahead[index].sector) &&
+            ((sector - g_readahead[index].sector) < g_readahead[index].count))
+        {
+            return &g_readahead[index];
+        }
+    }
+
+    return NULL;
+}
+
+/*
+ * Starts loading the other buffer with the sectors following readahead, so
+ * that the card keeps reading while the current buffer is used.
+ */
+static void mmc_readahead_refill(const mmc_readahead_t *readahead)
+{
+    mmc_readahead_t *other = (readahead == &g_readahead[0]) ?
+                             &g_readahead[1] : &g_readahead[0];
+    DWORD next = readahead->sector + readahead->count;
+
+    if ((MMC_READAHEAD_EMPTY != other->state) && (next == other->sector))
+    {
+        return;
+    }
+
+    (void)mmc_readahead_collect(other);
+    mmc_readahead_start(other, next);
+}
+
+/* Drops read-ahead data which a write to the drive makes stale */
+static void mmc_readahead_invalidate(DWORD sector, UINT count)
+{
+    uint32_t index;
+    mmc_readahead_t *readahead;
+
+    for (index = 0u; index < 2u; index++)
+    {
+        readahead = &g_readahead[index];
+        if ((MMC_READAHEAD_EMPTY != readahead->state) &&
+            (sector < (readahead->sector + readahead->count)) &&
+            (readahead->sector < (sector + count)))
+        {
+            (void)mmc_readahead_collect(readahead);
+            readahead->state = MMC_READAHEAD_EMPTY;
+        }
+    }
+}
+
+/*
+ * Reads count sectors. Once MMC_DI_IF_READAHEAD_TRIGGER reads in a row have
+ * each started where the previous one ended, the sectors which follow are read
+ * into the two read-ahead buffers in turn, and later reads are copied from
+ * them while the card fills the other buffer.
+ */
+static DRESULT mmc_readahead_read(BYTE *buff, DWORD sector, UINT count)
+{
+    mmc_readahead_t *readahead;
+    UINT chunk;
+
+    if (sector == g_next_sector)
+    {
+        if (g_sequential_reads < MMC_DI_IF_READAHEAD_TRIGGER)
+        {
+            g_sequential_reads++;
+        }
+    }
+    else
+    {
+        g_sequential_reads = 0u;
+    }
+    g_next_sector = sector + count;
+
+    while (0u != count)
+    {
+        readahead = mmc_readahead_find(sector);
+        if ((NULL == readahead) &&
+            (g_sequential_reads >= MMC_DI_IF_READAHEAD_TRIGGER) &&
+            (count < MMC_DI_IF_READAHEAD_SECTORS))
+        {
+            /* A stream with nothing read ahead, start it at this read */
+            readahead = &g_readahead[0];
+            (void)mmc_readahead_collect(readahead);
+            mmc_readahead_start(readahead, sector);
+        }
+
+        if ((NULL == readahead) || (false == mmc_readahead_collect(readahead)))
+        {
+            return mmc_transfer_sectors(NULL, buff, sector, count);
+        }
+
+        chunk = readahead->count - (UINT)(sector - readahead->sector);
+        if (chunk > count)
+        {
+            chunk = count;
+        }
+
+        (void)memcpy(buff, &readahead->data[(sector - readahead->sector) *
+                                            DISCIO_DRIV_MMC_SECTOR_SIZE],
+                     chunk * DISCIO_DRIV_MMC_SECTOR_SIZE);
+
+        mmc_readahead_refill(readahead);
+
+        buff += chunk * DISCIO_DRIV_MMC_SECTOR_SIZE;
+        sector += chunk;
+        count -= chunk;
+    }
+
+    return RES_OK;
+}
+#endif /* MMC_DI_IF_READAHEAD_SECTORS */
+
 /*------------------------ Global function definition section ----------------*/
 /* This function will initialise the MMC */
 DSTATUS mmc_di_if_init(void)
@@ -71,6 +535,25 @@ DSTATUS mmc_di_if_init(void)
 
         if (MSS_MMC_INIT_SUCCESS == ret_status)
         {
+#if defined(USING_FREERTOS)
+            if (NULL == g_transfer_done)
+            {
+                g_transfer_done = xSemaphoreCreateBinary();
+            }
+#endif
+            MSS_MMC_set_handler(mmc_transfer_complete_handler);
+#if (MMC_DI_IF_USE_CQ != 0)
+            /* Falls back to single ADMA2 transfers if the device has no
+             * command queue */
+            if (0u == mmc_blk_init())
+            {
+                g_mmc_use_cq = true;
+            }
+#endif
+#if (MMC_DI_IF_READAHEAD_SECTORS > 0u)
+            g_readahead[0].data = g_readahead_data[0];
+            g_readahead[1].data = g_readahead_data[1];
+#endif
             g_mmc_initialized = true;
             Stat = false;
         }
@@ -81,66 +564,24 @@ DSTATUS mmc_di_if_init(void)
 }
 
 /* MMC write function */
-DRESULT mmc_di_if_write(const BYTE *buff, DWORD sector, BYTE count)
+DRESULT mmc_di_if_write(const BYTE *buff, DWORD sector, UINT count)
 {
-    DRESULT status = RES_ERROR;
-    mss_mmc_status_t mmc_status = MSS_MMC_TRANSFER_FAIL;
-
-    /* Check status */
-    do
-    {
-        mmc_main_plic_IRQHandler();
-        mmc_status = MSS_MMC_get_transfer_status();
-    } while (MSS_MMC_TRANSFER_IN_PROGRESS == mmc_status);
-
-    /* Write to physical memory */
-    mmc_status = MSS_MMC_adma2_write(buff, sector, (count * 512));
-
-    /* Check status */
-    if (MSS_MMC_TRANSFER_IN_PROGRESS == mmc_status)
-    {
-        do
-        {
-            mmc_main_plic_IRQHandler();
-            mmc_status = MSS_MMC_get_transfer_status();
-        } while (MSS_MMC_TRANSFER_IN_PROGRESS == mmc_status);
-    }
+#if (MMC_DI_IF_READAHEAD_SECTORS > 0u)
+    mmc_readahead_invalidate(sector, count);
+#endif
 
-    status = (MSS_MMC_TRANSFER_SUCCESS == mmc_status) ? RES_ERROR : RES_OK;
-    return status;
+    return mmc_transfer_sectors(buff, NULL, sector, count);
 }
 
 /* MMC Read function */
-DRESULT mmc_di_if_read(DWORD sector, BYTE *buff, BYTE count)
+DRESULT mmc_di_if_read(DWORD sector, BYTE *buff, UINT count)
 {
-
-    DRESULT status = RES_ERROR;
-    mss_mmc_status_t mmc_status = MSS_MMC_TRANSFER_FAIL;
-    /* Check status */
-    do
-    {
-        mmc_main_plic_IRQHandler();
-        mmc_status = MSS_MMC_get_transfer_status();
-    } while (MSS_MMC_TRANSFER_IN_PROGRESS == mmc_status);
-
-    /* Read physical memory */
-    mmc_status = MSS_MMC_adma2_read(sector, buff, (count * 512));
-
-    /* Check status */
-    if (MSS_MMC_TRANSFER_IN_PROGRESS == mmc_status)
-    {
-        do
-        {
-            mmc_main_plic_IRQHandler();
-            mmc_status = MSS_MMC_get_transfer_status();
-        } while (MSS_MMC_TRANSFER_IN_PROGRESS == mmc_status);
-    }
-
-    status = (MSS_MMC_TRANSFER_SUCCESS != mmc_status) ? RES_ERROR : RES_OK;
-    return status;
+#if (MMC_DI_IF_READAHEAD_SECTORS > 0u)
+    return mmc_readahead_read(buff, sector, count);
+#else
+    return mmc_transfer_sectors(NULL, buff, sector, count);
+#endif
 }
 
 #endif
 /* End of file */
-
-
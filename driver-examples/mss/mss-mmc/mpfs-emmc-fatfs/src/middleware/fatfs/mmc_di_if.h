@@ -28,10 +28,37 @@ extern "C"
 #define DISCIO_DRIV_MMC_BLOCK_SIZE   (0x400U) /* This size is given as minimum
 number of write blocks that can be erased in a single erase command */
 
+/* Largest ADMA2 transfer, longer requests are split */
+#define MMC_DI_IF_ADMA2_MAX_SECTORS   (65535u)
+
+/* Sectors in each of the two read-ahead buffers. 0 turns read-ahead off. */
+#ifndef MMC_DI_IF_READAHEAD_SECTORS
+#define MMC_DI_IF_READAHEAD_SECTORS   (256u)
+#endif
+
+/* Reads in a row, each starting where the last one ended, before read-ahead
+ * starts */
+#ifndef MMC_DI_IF_READAHEAD_TRIGGER
+#define MMC_DI_IF_READAHEAD_TRIGGER   (2u)
+#endif
+
+/* Set to 0 to use single ADMA2 transfers even if the device has a command
+ * queue */
+#ifndef MMC_DI_IF_USE_CQ
+#define MMC_DI_IF_USE_CQ   (1)
+#endif
+
+#if defined(USING_FREERTOS)
+/* Ticks a task blocks for before checking the transfer state again */
+#ifndef MMC_DI_IF_WAIT_TICKS
+#define MMC_DI_IF_WAIT_TICKS   (pdMS_TO_TICKS(10u))
+#endif
+#endif
+
 /*----------------- Global function declaration section ----------------*/
 DSTATUS mmc_di_if_init(void);
-DRESULT mmc_di_if_write(const BYTE *buff, DWORD sector, BYTE count);
-DRESULT mmc_di_if_read(DWORD sector, BYTE *buff, BYTE count);
+DRESULT mmc_di_if_write(const BYTE *buff, DWORD sector, UINT count);
+DRESULT mmc_di_if_read(DWORD sector, BYTE *buff, UINT count);
 
 #ifdef __cplusplus
 }
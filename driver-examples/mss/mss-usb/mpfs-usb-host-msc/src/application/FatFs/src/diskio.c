@@ -9,6 +9,7 @@
 
 #include "ff.h"			/* Obtains integer types */
 #include "diskio.h"		/* Declarations of disk functions */
+#include "diskio_cache.h"
 #include "drivers/mss/mss_usb/mss_usb_host_msc.h"
 
 /* Definitions of physical drive number for each drive */
@@ -20,6 +21,38 @@
 #define SUCCESS        0U
 #define ERROR          1U
 
+/*-----------------------------------------------------------------------*/
+/* Device behind the sector cache                                        */
+/*-----------------------------------------------------------------------*/
+
+static DRESULT usb_msc_read(BYTE *buff, DWORD sector, UINT count)
+{
+    if(SUCCESS == MSS_USBH_MSC_read(buff, sector, count))
+    {
+        while(MSS_USBH_MSC_is_scsi_req_complete());
+        return(RES_OK);
+    }
+
+    return(RES_ERROR);
+}
+
+static DRESULT usb_msc_write(const BYTE *buff, DWORD sector, UINT count)
+{
+    if(SUCCESS == MSS_USBH_MSC_write((uint8_t*)buff, sector, count))
+    {
+        while(MSS_USBH_MSC_is_scsi_req_complete());
+        return(RES_OK);
+    }
+
+    return(RES_ERROR);
+}
+
+static const disk_cache_device_t g_cache_device =
+{
+    usb_msc_read,
+    usb_msc_write
+};
+
 /*-----------------------------------------------------------------------*/
 /* Get Drive Status                                                      */
 /*-----------------------------------------------------------------------*/
@@ -41,6 +74,16 @@ DSTATUS disk_initialize (
 	BYTE pdrv				/* Physical drive nmuber to identify the drive */
 )
 {
+    /*
+     * Sectors written before a remount are written back to the device. Those
+     * of a device which has been released were dropped by disk_cache_discard()
+     * so that they are not written to a newly attached one.
+     */
+    if (RES_OK != disk_cache_init(&g_cache_device))
+    {
+        return STA_NOINIT;
+    }
+
     return 0; /* success */
 }
 
@@ -68,16 +111,7 @@ DRESULT disk_read (
     }
     else if(USBH_MSC_DEVICE_READY == MSS_USBH_MSC_get_state())
     {
-
-        if(SUCCESS == MSS_USBH_MSC_read(buff, sector, count))
-        {
-            while(MSS_USBH_MSC_is_scsi_req_complete());
-            return(RES_OK);
-        }
-        else
-        {
-            return(RES_ERROR);
-        }
+        return(disk_cache_read(buff, sector, count));
     }
     else
     {
@@ -111,15 +145,7 @@ DRESULT disk_write (
     }
     else if(USBH_MSC_DEVICE_READY == MSS_USBH_MSC_get_state())
     {
-        if(SUCCESS == MSS_USBH_MSC_write((uint8_t*)buff, sector, count))
-        {
-            while(MSS_USBH_MSC_is_scsi_req_complete());
-            return(RES_OK);
-        }
-        else
-        {
-            return(RES_ERROR);
-        }
+        return(disk_cache_write(buff, sector, count));
     }
     else
     {
@@ -153,7 +179,12 @@ DRESULT disk_ioctl (
 
     switch (cmd) {
     case CTRL_SYNC:
-        break;
+        if(USBH_MSC_DEVICE_READY != MSS_USBH_MSC_get_state())
+        {
+            return RES_NOTRDY;
+        }
+        /* Write back the sectors held dirty in the cache */
+        return disk_cache_flush();
     case CTRL_POWER:
         break;
     case CTRL_LOCK:
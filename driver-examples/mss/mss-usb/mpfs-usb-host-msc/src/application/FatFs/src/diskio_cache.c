@@ -0,0 +1,334 @@
+/*******************************************************************************
+ * Copyright 2022 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Write-back sector cache used by the FatFs disk I/O layer.
+ *
+ * Each cache line holds one sector. A sector missing from the cache replaces
+ * the least recently used line, which is written to the device first if it is
+ * dirty. Short writes only update the cache. Long requests go straight to the
+ * device, and the cache lines they cover are kept in step with it.
+ *
+ */
+
+/*-------------------------- Header file section -----------------------------*/
+#include "diskio_cache.h"
+#include <string.h>
+
+/*-------------------------- Local type section ------------------------------*/
+typedef struct
+{
+    DWORD sector;
+    uint32_t last_used;         /* value of g_clock when last used */
+    BYTE valid;
+    BYTE dirty;                 /* newer than the sector on the device */
+} disk_cache_line_t;
+
+/*-------------------------- Local variable section --------------------------*/
+static const disk_cache_device_t *g_device = NULL;
+static disk_cache_stats_t g_stats;
+static volatile BYTE g_discard = 0u;
+
+#if (DISK_CACHE_SECTORS > 0u)
+static disk_cache_line_t g_lines[DISK_CACHE_SECTORS];
+static BYTE g_data[DISK_CACHE_SECTORS][DISK_CACHE_SECTOR_SIZE]
+    __attribute__((aligned(4)));
+static uint32_t g_clock = 0u;
+
+/*------------------------ Local function declaration section ----------------*/
+static void disk_cache_empty(void);
+static uint32_t disk_cache_find(DWORD sector);
+static DRESULT disk_cache_write_back(uint32_t line);
+static DRESULT disk_cache_alloc(DWORD sector, uint32_t *line);
+
+/*------------------------- Local function definition section ----------------*/
+/* Empties the cache, dropping any dirty sectors */
+static void disk_cache_empty(void)
+{
+    (void)memset(g_lines, 0, sizeof(g_lines));
+    g_clock = 0u;
+}
+
+/* Returns the line holding sector, or DISK_CACHE_SECTORS */
+static uint32_t disk_cache_find(DWORD sector)
+{
+    uint32_t line;
+
+    for (line = 0u; line < DISK_CACHE_SECTORS; line++)
+    {
+        if ((0u != g_lines[line].valid) && (sector == g_lines[line].sector))
+        {
+            break;
+        }
+    }
+
+    return line;
+}
+
+static DRESULT disk_cache_write_back(uint32_t line)
+{
+    DRESULT result = RES_OK;
+
+    if (0u != g_lines[line].dirty)
+    {
+        result = g_device->write(g_data[line], g_lines[line].sector, 1u);
+        if (RES_OK == result)
+        {
+            g_lines[line].dirty = 0u;
+            g_stats.write_backs++;
+        }
+    }
+
+    return result;
+}
+
+/*
+ * Picks a line for sector, a free one if there is one or else the least
+ * recently used one, writing it back first if it is dirty. The line is left
+ * invalid for the caller to fill.
+ */
+static DRESULT disk_cache_alloc(DWORD sector, uint32_t *line)
+{
+    uint32_t index;
+    uint32_t victim = 0u;
+    DRESULT result;
+
+    for (index = 0u; index < DISK_CACHE_SECTORS; index++)
+    {
+        if (0u == g_lines[index].valid)
+        {
+            victim = index;
+            break;
+        }
+
+        if ((g_clock - g_lines[index].last_used) >
+            (g_clock - g_lines[victim].last_used))
+        {
+            victim = index;
+        }
+    }
+
+    result = disk_cache_write_back(victim);
+    if (RES_OK == result)
+    {
+        g_lines[victim].valid = 0u;
+        g_lines[victim].sector = sector;
+        *line = victim;
+    }
+
+    return result;
+}
+#endif /* DISK_CACHE_SECTORS */
+
+/*------------------------ Global function definition section ----------------*/
+DRESULT disk_cache_init(const disk_cache_device_t *device)
+{
+    DRESULT result = RES_OK;
+
+    /* Anything FatFs left dirty before a remount belongs to this device */
+    if ((0u == g_discard) && (NULL != g_device))
+    {
+        result = disk_cache_flush();
+    }
+
+    if (RES_OK == result)
+    {
+        g_discard = 0u;
+#if (DISK_CACHE_SECTORS > 0u)
+        disk_cache_empty();
+#endif
+        (void)memset(&g_stats, 0, sizeof(g_stats));
+        g_device = device;
+    }
+
+    return result;
+}
+
+void disk_cache_discard(void)
+{
+    g_discard = 1u;
+}
+
+DRESULT disk_cache_read(BYTE *buff, DWORD sector, UINT count)
+{
+    DRESULT result = RES_OK;
+#if (DISK_CACHE_SECTORS > 0u)
+    uint32_t line;
+    UINT index;
+#endif
+
+    if ((NULL == g_device) || (0u != g_discard))
+    {
+        return RES_NOTRDY;
+    }
+
+#if (DISK_CACHE_SECTORS > 0u)
+    if (count < DISK_CACHE_BYPASS_SECTORS)
+    {
+        for (index = 0u; (index < count) && (RES_OK == result); index++)
+        {
+            line = disk_cache_find(sector + index);
+            if (DISK_CACHE_SECTORS != line)
+            {
+                g_stats.hits++;
+            }
+            else
+            {
+                result = disk_cache_alloc(sector + index, &line);
+                if (RES_OK == result)
+                {
+                    result = g_device->read(g_data[line], sector + index, 1u);
+                }
+                if (RES_OK == result)
+                {
+                    g_lines[line].valid = 1u;
+                    g_stats.misses++;
+                }
+            }
+
+            if (RES_OK == result)
+            {
+                g_lines[line].last_used = ++g_clock;
+                (void)memcpy(&buff[index * DISK_CACHE_SECTOR_SIZE],
+                             g_data[line], DISK_CACHE_SECTOR_SIZE);
+            }
+        }
+
+        return result;
+    }
+#endif
+
+    result = g_device->read(buff, sector, count);
+    g_stats.bypassed += count;
+
+#if (DISK_CACHE_SECTORS > 0u)
+    /* Sectors not yet written back are newer than the device's copy */
+    for (line = 0u; (line < DISK_CACHE_SECTORS) && (RES_OK == result); line++)
+    {
+        if ((0u != g_lines[line].dirty) && (g_lines[line].sector >= sector) &&
+            ((g_lines[line].sector - sector) < count))
+        {
+            (void)memcpy(&buff[(g_lines[line].sector - sector) *
+                               DISK_CACHE_SECTOR_SIZE],
+                         g_data[line], DISK_CACHE_SECTOR_SIZE);
+        }
+    }
+#endif
+
+    return result;
+}
+
+DRESULT disk_cache_write(const BYTE *buff, DWORD sector, UINT count)
+{
+    DRESULT result = RES_OK;
+#if (DISK_CACHE_SECTORS > 0u)
+    uint32_t line;
+    UINT index;
+#endif
+
+    if ((NULL == g_device) || (0u != g_discard))
+    {
+        return RES_NOTRDY;
+    }
+
+#if (DISK_CACHE_SECTORS > 0u)
+    if (count < DISK_CACHE_BYPASS_SECTORS)
+    {
+        for (index = 0u; (index < count) && (RES_OK == result); index++)
+        {
+            line = disk_cache_find(sector + index);
+            if (DISK_CACHE_SECTORS != line)
+            {
+                g_stats.hits++;
+            }
+            else
+            {
+                /* The whole sector is replaced, so it need not be read */
+                result = disk_cache_alloc(sector + index, &line);
+            }
+
+            if (RES_OK == result)
+            {
+                (void)memcpy(g_data[line],
+                             &buff[index * DISK_CACHE_SECTOR_SIZE],
+                             DISK_CACHE_SECTOR_SIZE);
+                g_lines[line].valid = 1u;
+                g_lines[line].dirty = 1u;
+                g_lines[line].last_used = ++g_clock;
+            }
+        }
+
+        return result;
+    }
+#endif
+
+    result = g_device->write(buff, sector, count);
+    g_stats.bypassed += count;
+
+#if (DISK_CACHE_SECTORS > 0u)
+    /* Keep cached copies of the sectors written in step with the device */
+    for (line = 0u; (line < DISK_CACHE_SECTORS) && (RES_OK == result); line++)
+    {
+        if ((0u != g_lines[line].valid) && (g_lines[line].sector >= sector) &&
+            ((g_lines[line].sector - sector) < count))
+        {
+            (void)memcpy(g_data[line],
+                         &buff[(g_lines[line].sector - sector) *
+                               DISK_CACHE_SECTOR_SIZE],
+                         DISK_CACHE_SECTOR_SIZE);
+            g_lines[line].dirty = 0u;
+        }
+    }
+#endif
+
+    return result;
+}
+
+DRESULT disk_cache_flush(void)
+{
+    DRESULT result = RES_OK;
+#if (DISK_CACHE_SECTORS > 0u)
+    uint32_t line;
+    uint32_t next;
+
+    if ((NULL == g_device) || (0u != g_discard))
+    {
+        return RES_NOTRDY;
+    }
+
+    /* Lowest sector first, so that the device sees a forward sweep */
+    do
+    {
+        next = DISK_CACHE_SECTORS;
+        for (line = 0u; line < DISK_CACHE_SECTORS; line++)
+        {
+            if ((0u != g_lines[line].dirty) &&
+                ((DISK_CACHE_SECTORS == next) ||
+                 (g_lines[line].sector < g_lines[next].sector)))
+            {
+                next = line;
+            }
+        }
+
+        if (DISK_CACHE_SECTORS != next)
+        {
+            result = disk_cache_write_back(next);
+        }
+    } while ((DISK_CACHE_SECTORS != next) && (RES_OK == result));
+#endif
+
+    return result;
+}
+
+void disk_cache_get_stats(disk_cache_stats_t *stats, BYTE clear)
+{
+    *stats = g_stats;
+
+    if (0u != clear)
+    {
+        (void)memset(&g_stats, 0, sizeof(g_stats));
+    }
+}
+
+/* End of file */
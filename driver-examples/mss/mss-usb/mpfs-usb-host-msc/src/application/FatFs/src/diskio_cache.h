@@ -0,0 +1,101 @@
+/*******************************************************************************
+ * Copyright 2022 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Write-back sector cache used by the FatFs disk I/O layer. It keeps recently
+ * used sectors, mostly the FAT and directory sectors FatFs reads and writes
+ * over and over, in memory and writes changed sectors to the device when they
+ * are evicted or when FatFs asks for a CTRL_SYNC.
+ *
+ * The cache does not know about the device. diskio.c passes it the functions
+ * which read and write the device through disk_cache_init().
+ *
+ * The cache has no lock. Apart from disk_cache_discard(), its functions must
+ * only be called from one context, which is the case when FatFs is used by a
+ * single task or main loop with FF_FS_REENTRANT disabled.
+ *
+ */
+#ifndef DISKIO_CACHE_H
+#define DISKIO_CACHE_H
+
+/*-------------------------- Header file section -----------------------------*/
+#include "ff.h"
+#include "diskio.h"
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* Sectors held by the cache. 0 passes every request straight to the device. */
+#ifndef DISK_CACHE_SECTORS
+#define DISK_CACHE_SECTORS          (32u)
+#endif
+
+/*
+ * Requests of this many sectors or more are file data rather than metadata.
+ * They go straight to the device so that they do not flush the FAT and
+ * directory sectors out of the cache.
+ */
+#ifndef DISK_CACHE_BYPASS_SECTORS
+#define DISK_CACHE_BYPASS_SECTORS   (4u)
+#endif
+
+/* Sector size the cache works with. Other devices bypass the cache. */
+#define DISK_CACHE_SECTOR_SIZE      (512u)
+
+/* Device access functions */
+typedef struct
+{
+    DRESULT (*read)(BYTE *buff, DWORD sector, UINT count);
+    DRESULT (*write)(const BYTE *buff, DWORD sector, UINT count);
+} disk_cache_device_t;
+
+/* Counters of the work done by the cache */
+typedef struct
+{
+    uint32_t hits;              /* sectors found in the cache */
+    uint32_t misses;            /* sectors read from the device into the cache */
+    uint32_t write_backs;       /* dirty sectors written to the device */
+    uint32_t bypassed;          /* sectors of requests sent to the device */
+} disk_cache_stats_t;
+
+/*----------------- Global function declaration section ----------------*/
+/*
+ * Writes back the dirty sectors held for the current device, then empties the
+ * cache and sets the device it works for. Called when the drive is
+ * initialised. If the write back fails the cache is left as it is and the
+ * error is returned. Nothing is written if disk_cache_discard() was called.
+ */
+DRESULT disk_cache_init(const disk_cache_device_t *device);
+
+/*
+ * Drops everything held in the cache, without writing dirty sectors, before
+ * the next cache operation. Called when the device has gone away so that its
+ * sectors are not written to another device. May be called from an interrupt
+ * handler.
+ */
+void disk_cache_discard(void);
+
+/* Reads count sectors, from the cache where they are held */
+DRESULT disk_cache_read(BYTE *buff, DWORD sector, UINT count);
+
+/*
+ * Writes count sectors. Short writes stay in the cache until the sector is
+ * evicted or the cache is flushed.
+ */
+DRESULT disk_cache_write(const BYTE *buff, DWORD sector, UINT count);
+
+/* Writes every dirty sector to the device, in sector order */
+DRESULT disk_cache_flush(void);
+
+/* Copies the cache counters, and clears them if clear is non-zero */
+void disk_cache_get_stats(disk_cache_stats_t *stats, BYTE clear);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DISKIO_CACHE_H */
@@ -0,0 +1,76 @@
+/*******************************************************************************
+ * Copyright 2022 Microchip FPGA Embedded Systems Solutions.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Opens files in FatFs fast seek mode, with the cluster link map built
+ * automatically. Reads, writes and seeks of such a file look up the clusters
+ * in the map instead of following the chain in the FAT.
+ *
+ * Files written at a steady rate, such as logs, can be created with their
+ * space reserved in one contiguous block. Writing them then needs no FAT or
+ * directory updates until they are finished, and their sectors can be written
+ * directly with disk_write().
+ *
+ */
+#ifndef FF_STREAM_H
+#define FF_STREAM_H
+
+/*-------------------------- Header file section -----------------------------*/
+#include "ff.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/* Items of a cluster link map for a file made of up to fragments fragments */
+#define FF_STREAM_CLMT_ITEMS(fragments)     ((2u * (fragments)) + 2u)
+
+/*----------------- Global function declaration section ----------------*/
+/*
+ * Opens a file as f_open() does and builds its cluster link map in clmt, an
+ * array of clmt_items DWORDs which must stay in place until the file is
+ * closed. If the map does not fit, or the file is empty, the file is left in
+ * normal seek mode and FR_OK is still returned. fp->cltbl tells which mode
+ * the file is in.
+ *
+ * A file in fast seek mode cannot grow beyond the clusters it had when it was
+ * opened. A write past them stops as if the drive were full.
+ */
+FRESULT ff_stream_open(FIL *fp, const TCHAR *path, BYTE mode, DWORD *clmt,
+                       UINT clmt_items);
+
+/*
+ * Creates, or replaces, a file of size bytes held in one contiguous block of
+ * clusters, and opens it for reading and writing in fast seek mode. The FAT
+ * chain and the directory entry are written once, before returning. clmt
+ * needs FF_STREAM_CLMT_ITEMS(1) items. Returns FR_DENIED if the drive has no
+ * free block large enough, in which case no file is left behind.
+ *
+ * The file pointer starts at 0. Data can then be written with f_write(), or
+ * with disk_write() to the sectors given by ff_stream_sector(), and the file
+ * is ended with ff_stream_finish().
+ */
+FRESULT ff_stream_create(FIL *fp, const TCHAR *path, FSIZE_t size,
+                         DWORD *clmt, UINT clmt_items);
+
+/*
+ * Returns the drive sector which holds byte ofs of a file in fast seek mode,
+ * or 0 if ofs is beyond the end of the file. If count is not NULL, it is set
+ * to the number of sectors of the file which follow on from that sector on
+ * the drive, including it.
+ */
+LBA_t ff_stream_sector(const FIL *fp, FSIZE_t ofs, DWORD *count);
+
+/*
+ * Sets the size of a file made by ff_stream_create() to the size bytes
+ * written, frees the clusters beyond them and closes the file.
+ */
+FRESULT ff_stream_finish(FIL *fp, FSIZE_t size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FF_STREAM_H */
@@ -24,6 +24,7 @@ extern "C" {
 #include "drivers/mss/mss_usb/mss_usb_host.h"
 #include "drivers/mss/mss_usb/mss_usb_host_msc.h"
 #include "drivers/mss/mss_usb/mss_usb_common_cif.h"
+#include "FatFs/src/diskio_cache.h"
 
 #define MAX_ELEMENT_COUNT                               20u
 
@@ -311,6 +312,8 @@ static void MSC_DEV_ready(void) {
  * Print message on terminal
  */
 static void MSC_DEV_driver_released(void) {
+    /* Sectors the cache holds for the device must not reach the next one */
+    disk_cache_discard();
     g_msc_driver_released = 1u;
     MSS_UART_polled_tx_string(&g_mss_uart1_lo,
             (uint8_t*) "\n\n\rUSBH MSC driver released\n\r");